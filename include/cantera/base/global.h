@@ -202,6 +202,15 @@ void suppress_deprecation_warnings();
 //! @copydoc Application::Messages::setLogger
 void setLogger(Logger* logwriter);
 
+//! Temporarily pass the log messages written by the calling thread to a
+//! different logger
+/*!
+ * Log messages are stored separately for each thread, so this only affects
+ * messages written by the thread which calls this function.
+ * @copydetails Application::Messages::redirectLogger
+ */
+Logger* redirectLogger(Logger* logwriter);
+
 //! Return the conversion factor to convert unit std::string 'unit'
 //! to SI units.
 /*!
@@ -80,5 +80,36 @@ public:
     }
 };
 
+//! A Logger that collects the messages in a string.
+/*!
+ * This can be used to capture the output of objects that accept their own
+ * logger, such as Sim1D::setLogger().
+ * @ingroup textlogs
+ */
+class StringLogger : public Logger
+{
+public:
+    virtual void write(const std::string& msg) {
+        m_text += msg;
+    }
+
+    virtual void writeendl() {
+        m_text += "\n";
+    }
+
+    //! The messages written since the last call to clear()
+    const std::string& text() const {
+        return m_text;
+    }
+
+    //! Discard the messages written so far
+    void clear() {
+        m_text.clear();
+    }
+
+protected:
+    std::string m_text;
+};
+
 }
 #endif
@@ -0,0 +1,82 @@
+/**
+ *  @file parallel.h
+ *  Simple helpers for evaluating independent tasks on multiple threads
+ */
+
+#ifndef CT_PARALLEL_H
+#define CT_PARALLEL_H
+
+#include "ct_defs.h"
+#include <exception>
+#include <thread>
+
+namespace Cantera
+{
+
+//! Number of threads that can run concurrently on this machine, or 1 if
+//! this cannot be determined.
+inline size_t hardwareThreads()
+{
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+//! Evaluate `f(i)` for each `i` in `[0, n)`, using up to `nthreads` threads
+/*!
+ * The range is split into contiguous blocks of nearly equal size, one for
+ * each thread, and the calling thread evaluates the first block. The calls
+ * for different values of `i` must be independent of each other. If each call
+ * writes only results indexed by `i`, the results do not depend on the number
+ * of threads used.
+ *
+ * If any call throws an exception, the remaining calls in the same block are
+ * skipped, and the first exception (in the order of the blocks) is rethrown
+ * after all of the threads have finished.
+ *
+ * @param n         Number of tasks
+ * @param nthreads  Maximum number of threads to use, including the calling
+ *                  thread. A value of 0 means hardwareThreads().
+ * @param f         Function to call for each task, with signature
+ *                  `void f(size_t i)`
+ */
+template <class F>
+void parallel_for(size_t n, size_t nthreads, F f)
+{
+    if (nthreads == 0) {
+        nthreads = hardwareThreads();
+    }
+    nthreads = std::min(nthreads, n);
+    if (nthreads <= 1) {
+        for (size_t i = 0; i < n; i++) {
+            f(i);
+        }
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(nthreads);
+    auto runBlock = [&](size_t t) {
+        try {
+            for (size_t i = t * n / nthreads; i < (t + 1) * n / nthreads; i++) {
+                f(i);
+            }
+        } catch (...) {
+            errors[t] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < nthreads; t++) {
+        threads.emplace_back(runBlock, t);
+    }
+    runBlock(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& err : errors) {
+        if (err) {
+            std::rethrow_exception(err);
+        }
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,145 @@
+/**
+ *  @file BlockTridiagMatrix.h
+ *   Declarations for the class BlockTridiagMatrix, for matrices made up of
+ *   dense blocks on the main, first lower, and first upper block diagonals.
+ */
+
+#ifndef CT_BLOCKTRIDIAGMATRIX_H
+#define CT_BLOCKTRIDIAGMATRIX_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+//! A square matrix with dense blocks on the main block diagonal and on the
+//! block diagonals immediately above and below it.
+/*!
+ * Block `p` on the main diagonal is a square matrix of size `n_p`, where the
+ * block sizes may differ from each other. The only other nonzero blocks are
+ * the `n_p` by `n_{p-1}` block to the left of each diagonal block and the
+ * `n_p` by `n_{p+1}` block to the right of it. This is the structure of the
+ * Jacobian of a three-point finite difference scheme, where each block
+ * corresponds to one grid point.
+ *
+ * The matrix is factored using block LU decomposition (the block Thomas
+ * algorithm). Only the diagonal blocks are factored, using LAPACK with
+ * partial pivoting within each block. The off-diagonal blocks are updated
+ * using level-3 BLAS. Compared to the equivalent banded matrix, this does not
+ * operate on the zero elements between the blocks, and the factorization is
+ * stored in place of the original matrix.
+ *
+ * Since no pivoting is done between blocks, factorization will fail if one
+ * of the diagonal blocks of the factored matrix is singular, even if the
+ * matrix itself is not.
+ *
+ * @ingroup numerics
+ */
+class BlockTridiagMatrix
+{
+public:
+    //! Create an empty matrix
+    BlockTridiagMatrix();
+
+    //! Create a matrix with the specified block sizes, and set all elements
+    //! to zero
+    /*!
+     * @param sizes  Number of rows (and columns) in each diagonal block
+     */
+    explicit BlockTridiagMatrix(const std::vector<size_t>& sizes);
+
+    //! Change the block sizes. All elements are set to zero.
+    void resize(const std::vector<size_t>& sizes);
+
+    //! Set all elements to zero
+    void zero();
+
+    //! Number of rows (and columns) in the matrix
+    size_t nRows() const {
+        return m_n;
+    }
+
+    //! Number of diagonal blocks
+    size_t nBlocks() const {
+        return m_size.size();
+    }
+
+    //! Number of rows in diagonal block `p`
+    size_t blockSize(size_t p) const {
+        return m_size[p];
+    }
+
+    //! Index of the first row of diagonal block `p`
+    size_t blockStart(size_t p) const {
+        return m_start[p];
+    }
+
+    //! Pointer to the elements of the block in block row `p` and block column
+    //! `q`, where `q` is one of `p-1`, `p` or `p+1`. The block is stored in
+    //! column-major order, with a leading dimension equal to blockSize(p).
+    doublereal* block(size_t p, size_t q);
+
+    //! Reference to the element in row `i` and column `j`. Throws an
+    //! exception if the element is outside the nonzero blocks.
+    doublereal& operator()(size_t i, size_t j);
+
+    //! Value of the element in row `i` and column `j`
+    doublereal operator()(size_t i, size_t j) const;
+
+    //! Multiply the matrix by the vector `b`, and write the result to `prod`
+    void mult(const doublereal* b, doublereal* prod) const;
+
+    //! Factor the matrix in place
+    /*!
+     * @returns 0 if successful. Otherwise, one plus the index of the row
+     *     where a zero pivot was found, and the matrix is left in an
+     *     undefined state.
+     */
+    int factor();
+
+    //! Solve the linear system A*x = b, where A is this matrix
+    /*!
+     * The matrix is factored first if necessary.
+     *
+     * @param[in,out] b  On input, the right-hand side vector. On output, the
+     *     solution.
+     * @returns 0 if successful. Otherwise, the value returned by factor().
+     */
+    int solve(doublereal* b);
+
+    //! True if the matrix has been factored
+    bool factored() const {
+        return m_factored;
+    }
+
+protected:
+    //! Index in #m_data of the element in row `i` and column `j`, or `npos`
+    //! if the element is outside the nonzero blocks.
+    size_t locate(size_t i, size_t j) const;
+
+    size_t m_n; //!< Total number of rows
+    std::vector<size_t> m_size; //!< Size of each diagonal block
+    std::vector<size_t> m_start; //!< First row of each diagonal block
+
+    //! For each block row, the offsets in #m_data of the blocks to the left
+    //! of, on, and to the right of the diagonal
+    std::vector<size_t> m_offset;
+
+    //! Index of the diagonal block containing each row
+    std::vector<size_t> m_row_block;
+
+    //! Matrix elements, or the factored matrix. After factorization, the
+    //! diagonal blocks contain the LU factors of the Schur complements, and
+    //! the blocks to the right of the diagonal are overwritten by the
+    //! products of their inverses with the original upper blocks.
+    vector_fp m_data;
+
+    //! Pivot indices for the diagonal blocks
+    vector_int m_ipiv;
+
+    bool m_factored;
+};
+
+}
+
+#endif
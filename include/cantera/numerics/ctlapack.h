@@ -11,6 +11,7 @@
 // map BLAS names to names with or without a trailing underscore.
 #ifndef LAPACK_FTN_TRAILING_UNDERSCORE
 
+#define _DGEMM_   dgemm
 #define _DGEMV_   dgemv
 #define _DGETRF_  dgetrf
 #define _DGETRS_  dgetrs
@@ -32,6 +33,7 @@
 
 #else
 
+#define _DGEMM_   dgemm_
 #define _DGEMV_   dgemv_
 #define _DGETRF_  dgetrf_
 #define _DGETRS_  dgetrs_
@@ -82,6 +84,20 @@ extern "C" {
                 const integer* incY);
 #endif
 
+#ifdef LAPACK_FTN_STRING_LEN_AT_END
+    int _DGEMM_(const char* transa, const char* transb, const integer* m,
+                const integer* n, const integer* k, const doublereal* alpha,
+                const doublereal* a, const integer* lda, const doublereal* b,
+                const integer* ldb, const doublereal* beta, doublereal* c,
+                const integer* ldc, ftnlen trsizea, ftnlen trsizeb);
+#else
+    int _DGEMM_(const char* transa, ftnlen trsizea, const char* transb,
+                ftnlen trsizeb, const integer* m, const integer* n,
+                const integer* k, const doublereal* alpha, const doublereal* a,
+                const integer* lda, const doublereal* b, const integer* ldb,
+                const doublereal* beta, doublereal* c, const integer* ldc);
+#endif
+
     int _DGETRF_(const integer* m, const integer* n,
                  doublereal* a, integer* lda, integer* ipiv,
                  integer* info);
@@ -230,6 +246,24 @@ inline void ct_dgemv(ctlapack::storage_t storage,
 #endif
 }
 
+inline void ct_dgemm(ctlapack::transpose_t transa,
+                     ctlapack::transpose_t transb, size_t m, size_t n,
+                     size_t k, doublereal alpha, const doublereal* a,
+                     size_t lda, const doublereal* b, size_t ldb,
+                     doublereal beta, doublereal* c, size_t ldc)
+{
+    integer f_m = (int) m, f_n = (int) n, f_k = (int) k;
+    integer f_lda = (int) lda, f_ldb = (int) ldb, f_ldc = (int) ldc;
+    ftnlen trsize = 1;
+#ifdef LAPACK_FTN_STRING_LEN_AT_END
+    _DGEMM_(&no_yes[transa], &no_yes[transb], &f_m, &f_n, &f_k, &alpha, a,
+            &f_lda, b, &f_ldb, &beta, c, &f_ldc, trsize, trsize);
+#else
+    _DGEMM_(&no_yes[transa], trsize, &no_yes[transb], trsize, &f_m, &f_n,
+            &f_k, &alpha, a, &f_lda, b, &f_ldb, &beta, c, &f_ldc);
+#endif
+}
+
 inline void ct_dgbsv(int n, int kl, int ku, int nrhs,
                      doublereal* a, int lda, integer* ipiv, doublereal* b, int ldb,
                      int& info)
@@ -264,6 +264,16 @@ public:
         return (m_rdt == 0.0 ? m_atol_ss[n] : m_atol_ts[n]);
     }
 
+    //! Steady-state relative tolerance of the nth component.
+    doublereal steadyRtol(size_t n) const {
+        return m_rtol_ss[n];
+    }
+
+    //! Steady-state absolute tolerance of the nth component.
+    doublereal steadyAtol(size_t n) const {
+        return m_atol_ss[n];
+    }
+
     //! Upper bound on the nth component.
     doublereal upperBound(size_t n) const {
         return m_max[n];
@@ -330,6 +340,33 @@ public:
     virtual void eval(size_t j, doublereal* x, doublereal* r,
                       integer* mask, doublereal rdt=0.0);
 
+    //! Returns true if the columns of the Jacobian for local point `j` can be
+    //! computed by evalJacobian(), instead of by finite differences of the
+    //! residual function.
+    /*!
+     * Only StFlow provides these columns, for its interior points. The
+     * boundary domains (Inlet1D, Outlet1D, Symm1D, Surf1D, ReactingSurf1D,
+     * etc.) always use finite differences. They have a single point, and
+     * their equations and those of the adjacent flow points that they modify
+     * are cheap to difference compared to the interior of the flow domain.
+     */
+    virtual bool analyticJacobian(size_t j) const {
+        return false;
+    }
+
+    //! Compute the columns of the steady-state Jacobian for each local point
+    //! `j` for which analyticJacobian(j) returns true.
+    /*!
+     * The elements of each column in the rows for points `j-1`, `j` and
+     * `j+1` are stored in `jac`. The residual function must have been
+     * evaluated at `x` immediately before this method is called.
+     *
+     * @param x  Global solution vector. Elements may be perturbed temporarily,
+     *     but are restored on return.
+     * @param jac  Jacobian matrix
+     */
+    virtual void evalJacobian(doublereal* x, MultiJac& jac) {}
+
     virtual doublereal residual(doublereal* x, size_t n, size_t j) {
         throw CanteraError("Domain1D::residual","residual function must be overloaded in derived class "+id());
     }
@@ -384,6 +421,15 @@ public:
      */
     virtual void restore(const XML_Node& dom, doublereal* soln, int loglevel);
 
+    //! Get the scalar values, other than the solution and the grid, which
+    //! are needed to restore the state of this domain from a SolutionFile.
+    //! The base class version stores nothing.
+    virtual void getAttributes(std::map<std::string, doublereal>& attribs) const {}
+
+    //! Set the scalar values stored by getAttributes(). Values which are not
+    //! present in `attribs` are left unchanged.
+    virtual void setAttributes(const std::map<std::string, doublereal>& attribs) {}
+
     size_t size() const {
         return m_nv*m_points;
     }
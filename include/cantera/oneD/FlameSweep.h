@@ -0,0 +1,151 @@
+/**
+ * @file FlameSweep.h
+ */
+
+#ifndef CT_FLAMESWEEP_H
+#define CT_FLAMESWEEP_H
+
+#include "Sim1D.h"
+
+namespace Cantera
+{
+
+class XML_Node;
+
+/**
+ * Solves a list of independent flame problems, such as the flame speeds for
+ * a table of equivalence ratios, pressures and unburned gas temperatures, on
+ * several threads at once.
+ *
+ * Each thread solves the cases using its own copy of a template simulation.
+ * The copies are made on the threads that use them, and include the domains,
+ * the phase, kinetics and transport managers used by the flow domains, the
+ * settings of each domain that are saved with Sim1D::save(), the bounds,
+ * the grid refinement settings and the solver options (see
+ * Sim1D::copyOptions()). Copies can be made of simulations which consist of
+ * AxiStagnFlow and FreeFlame domains and of Inlet1D, Outlet1D, OutletRes1D,
+ * Symm1D, Surf1D and Empty1D boundaries. The copies evaluate the residual on
+ * a single thread, regardless of StFlow::setThreads().
+ *
+ * Each case is described by a vector of parameter values. The conditions for
+ * a case are applied to a copy of the template by setCase(), which must be
+ * implemented by a derived class. The starting estimate for each case is the
+ * converged solution of the nearest case that has already been solved, where
+ * the distance between cases is measured with each parameter scaled by its
+ * range over all cases. Before any case has been solved, the solution of the
+ * template is used.
+ *
+ * The messages written while solving each case are kept separately, and can
+ * be retrieved with log().
+ * @ingroup onedim
+ */
+class FlameSweep
+{
+public:
+    //! Constructor
+    /*!
+     * @param sim  The template simulation. Its domains, phases and other
+     *     managers are not modified by the sweep, and must not be modified
+     *     while solve() is running.
+     */
+    FlameSweep(Sim1D& sim);
+
+    virtual ~FlameSweep();
+
+    //! Set the number of threads used to solve the cases
+    /*!
+     * @param nthreads  Number of threads, including the calling thread. A
+     *     value of 0 means the number of hardware threads.
+     */
+    void setThreads(size_t nthreads);
+
+    //! Number of threads used to solve the cases. See setThreads().
+    size_t threads() const {
+        return m_nthreads;
+    }
+
+    //! Add a case, described by the parameter values `params`, which are
+    //! passed to setCase(). All cases must have the same number of
+    //! parameters. Returns the index of the case.
+    size_t addCase(const vector_fp& params);
+
+    //! Number of cases
+    size_t nCases() const {
+        return m_params.size();
+    }
+
+    //! Parameter values for case `i`
+    const vector_fp& parameters(size_t i) const;
+
+    //! Solve all of the cases
+    /*!
+     * Cases are assigned to the threads in the order in which they were
+     * added, as the threads become available, so cases which are close to
+     * each other should be added consecutively. Cases that fail to converge
+     * do not stop the sweep; see converged().
+     *
+     * @param loglevel  Controls the amount of diagnostic output, which is
+     *     written separately for each case. See Sim1D::solve().
+     * @param refine_grid  If true, the grid is refined.
+     */
+    void solve(int loglevel=0, bool refine_grid=true);
+
+    //! True if case `i` was solved by the last call to solve()
+    bool converged(size_t i) const;
+
+    //! Log messages written while solving case `i`, including the error
+    //! message if it did not converge
+    const std::string& log(size_t i) const;
+
+    //! Apply the conditions of case `i` to the template simulation, and set
+    //! its grid and solution to the converged solution for that case.
+    void restoreCase(size_t i);
+
+protected:
+    //! Apply the conditions for a case to a simulation
+    /*!
+     * Called on the thread that solves the case, with a copy of the template
+     * simulation, and by restoreCase() with the template itself. This should
+     * change only the objects that belong to `sim`, i.e. its domains and the
+     * phase, kinetics and transport managers of its flow domains, which can
+     * be obtained with StFlow::phase(), StFlow::kinetics() and
+     * StFlow::transport().
+     *
+     * @param sim  The simulation to modify
+     * @param params  The parameter values for the case
+     */
+    virtual void setCase(Sim1D& sim, const vector_fp& params);
+
+    //! A copy of the template simulation, and the objects it uses
+    struct Instance;
+
+    //! Make a copy of the template simulation
+    void makeInstance(Instance& inst);
+
+    //! Index of the solved case nearest to case `i`, or npos if no case
+    //! has been solved.
+    size_t nearestSolved(size_t i) const;
+
+    //! The template simulation
+    Sim1D* m_sim;
+
+    //! Number of threads
+    size_t m_nthreads;
+
+    //! Parameter values for each case
+    std::vector<vector_fp> m_params;
+
+    //! Solution of the template, used as the initial estimate for cases
+    //! without a solved neighbor
+    std::unique_ptr<XML_Node> m_initial;
+
+    //! Converged solution of each case, or NULL
+    std::vector<std::unique_ptr<XML_Node>> m_solutions;
+
+    //! Log messages for each case
+    std::vector<std::string> m_logs;
+};
+
+}
+
+#endif
@@ -8,6 +8,7 @@
 #define CT_MULTIJAC_H
 
 #include "cantera/numerics/BandMatrix.h"
+#include "cantera/numerics/BlockTridiagMatrix.h"
 #include "OneDim.h"
 
 namespace Cantera
@@ -48,9 +49,38 @@ public:
         return m_age;
     }
 
-    //! Increment the Jacobian age.
+    //! Increment the Jacobian age. Called once for each Newton iteration
+    //! that uses this Jacobian.
     void incrementAge() {
+        if (!m_new) {
+            m_nreuse++;
+        }
+        m_new = false;
         m_age++;
+        m_max_age_used = std::max(m_max_age_used, m_age);
+    }
+
+    //! Number of Newton iterations that used a Jacobian evaluated for an
+    //! earlier iteration
+    int nReused() const {
+        return m_nreuse;
+    }
+
+    //! Largest age reached by any of the Jacobians evaluated by this object
+    int maxAgeUsed() const {
+        return m_max_age_used;
+    }
+
+    //! Record that no acceptable damped Newton step could be found using the
+    //! current Jacobian
+    void incrementFailures() {
+        m_nfailures++;
+    }
+
+    //! Number of times that no acceptable damped Newton step could be found
+    //! using the current Jacobian
+    int nFailures() const {
+        return m_nfailures;
     }
 
     void updateTransient(doublereal rdt, integer* mask);
@@ -66,7 +96,145 @@ public:
 
     void incrementDiagonal(int j, doublereal d);
 
+    //! Use grouped ("colored") finite differences to evaluate the Jacobian
+    /*!
+     * The residual at each point depends only on the solution at that point
+     * and at its two neighbors, so the columns for points that are three or
+     * more points apart have no nonzero rows in common. With coloring
+     * enabled, eval() perturbs the same component at every third point at
+     * once, and obtains the entries for all of these columns from a single
+     * evaluation of the full residual function. This reduces the number of
+     * residual evaluations from the total number of unknowns to three times
+     * the largest number of components at any point, and gives the same
+     * Jacobian as perturbing one unknown at a time.
+     *
+     * Domains are told that a colored evaluation is in progress through
+     * coloredEval(), and should then evaluate the residual at all points the
+     * same way as they do for a single perturbed point.
+     */
+    void setColoring(bool color) {
+        m_color = color;
+    }
+
+    //! True if the Jacobian is evaluated using grouped finite differences.
+    //! See setColoring().
+    bool coloring() const {
+        return m_color;
+    }
+
+    //! True while the residual function is being evaluated for a group of
+    //! perturbed columns of the Jacobian.
+    bool coloredEval() const {
+        return m_colored_eval;
+    }
+
+    //! Use the Jacobian columns computed by the domains, where available
+    /*!
+     * If enabled, each domain is asked to compute the columns of the Jacobian
+     * for its points directly (see Domain1D::evalJacobian), and only the
+     * remaining columns are computed by finite differences, one column at a
+     * time, even if coloring is enabled.
+     */
+    void setAnalytic(bool analytic) {
+        m_analytic = analytic;
+    }
+
+    //! True if the domains compute their own Jacobian columns where
+    //! possible. See setAnalytic().
+    bool analytic() const {
+        return m_analytic;
+    }
+
+    //! The perturbation of a solution component with value `x` used for the
+    //! finite difference columns. Domains that compute their own columns
+    //! should use the same perturbation for any finite difference
+    //! derivatives, so that the two types of columns are consistent.
+    doublereal perturbation(doublereal x) const {
+        return m_atol + fabs(x)*m_rtol;
+    }
+
+    //! Factor and solve the Jacobian as a block-tridiagonal matrix
+    /*!
+     * The Jacobian is still assembled in banded form, but is copied into a
+     * BlockTridiagMatrix with one block for each grid point before it is
+     * factored. Block LU factorization does not operate on the zeros within
+     * the band, and for large mechanisms requires several times fewer
+     * operations than banded LU factorization. The storage for the banded
+     * LU factors is not used.
+     *
+     * If any of the diagonal blocks encountered during the block
+     * factorization is singular, the banded LU factorization, which pivots
+     * across the whole band, is used instead.
+     */
+    void setBlockSolver(bool block);
+
+    //! True if the Jacobian is solved as a block-tridiagonal matrix. See
+    //! setBlockSolver().
+    bool blockSolver() const {
+        return m_block;
+    }
+
+    //! Set the maximum number of Broyden updates applied between evaluations
+    //! of the Jacobian
+    /*!
+     * If `maxUpdates` is greater than zero, broydenUpdate() corrects the
+     * factored Jacobian after each Newton step, so that Newton steps using a
+     * Jacobian several iterations old are closer to those obtained with a new
+     * Jacobian. The default of zero disables the updates.
+     */
+    void setBroydenUpdates(size_t maxUpdates) {
+        m_max_updates = maxUpdates;
+    }
+
+    //! Maximum number of Broyden updates between evaluations of the Jacobian.
+    //! See setBroydenUpdates().
+    size_t broydenUpdates() const {
+        return m_max_updates;
+    }
+
+    //! Apply a rank-one ("good") Broyden update to the factored Jacobian
+    /*!
+     * The updated Jacobian `J'` is the one closest to the current Jacobian
+     * `J` which satisfies the secant condition `J' dx = df`, where the
+     * distance is measured using the inner product with weights `w`. The
+     * matrix
+     * itself and its factorization are not modified. Instead, solve() applies
+     * the Sherman-Morrison formula for each of the updates to the solution
+     * obtained from the factorization. The updates are discarded when the
+     * Jacobian is factored again, for example after it is re-evaluated or
+     * the transient terms are changed.
+     *
+     * @param dx  Change in the solution vector
+     * @param df  Corresponding change in the residual vector
+     * @param w   Weight for each component of the solution vector. If NULL,
+     *     all weights are 1.
+     * @returns true if the update was applied. The update is skipped if the
+     *     maximum number of updates has been reached or if the updated
+     *     Jacobian would be singular.
+     */
+    bool broydenUpdate(const doublereal* dx, const doublereal* df,
+                       const doublereal* w=0);
+
+    //! Total number of Broyden updates applied to Jacobians evaluated by this
+    //! object
+    int nBroydenUpdates() const {
+        return m_nupdates;
+    }
+
+    virtual int factor();
+    using BandMatrix::solve;
+
+    //! Solve the linear system using the factored Jacobian, including the
+    //! Broyden updates applied since it was factored
+    virtual int solve(doublereal* b, size_t nrhs=1, size_t ldb=0);
+
 protected:
+    //! Evaluate the Jacobian one column at a time
+    void evalColumns(doublereal* x0, doublereal* resid0, double rdt);
+
+    //! Evaluate the Jacobian using grouped finite differences
+    void evalColored(doublereal* x0, doublereal* resid0);
+
     //! Residual evaluator for this Jacobian
     /*!
      * This is a pointer to the residual evaluator. This object isn't owned by
@@ -83,6 +251,38 @@ protected:
     int m_age;
     size_t m_size;
     size_t m_points;
+
+    bool m_color; //!< If true, use grouped finite differences
+    bool m_colored_eval; //!< True during a grouped residual evaluation
+    bool m_analytic; //!< If true, use the Jacobian columns from the domains
+
+    //! True for each point whose columns are computed by finite differences
+    std::vector<bool> m_fd_point;
+
+    bool m_block; //!< If true, factor as a block-tridiagonal matrix
+
+    //! True if the current factorization is stored in #m_blocks
+    bool m_block_factored;
+
+    //! Block-tridiagonal copy of the Jacobian, with one block for each point
+    BlockTridiagMatrix m_blocks;
+
+    //! Unperturbed values and reciprocal perturbations of the columns in the
+    //! current group. Length #m_points.
+    vector_fp m_xsave, m_rdx;
+
+    size_t m_max_updates; //!< Maximum number of Broyden updates
+
+    //! Vectors defining the Broyden updates to the inverse Jacobian. The
+    //! solution after update `i` is `y + m_bu[i] * (m_bv[i] . y)`, where `y`
+    //! is the solution after update `i-1`.
+    std::vector<vector_fp> m_bu, m_bv;
+
+    bool m_new; //!< True if the Jacobian has not been used yet
+    int m_nreuse; //!< Number of Newton iterations using an old Jacobian
+    int m_max_age_used; //!< Largest Jacobian age reached
+    int m_nfailures; //!< Number of failed damped Newton steps
+    int m_nupdates; //!< Number of Broyden updates
 };
 }
 
@@ -75,6 +75,12 @@ protected:
     //! Work arrays of size #m_n used in solve().
     vector_fp m_x, m_stp, m_stp1;
 
+    //! Residual at the solution passed to the last call to step()
+    vector_fp m_resid;
+
+    //! Work arrays of size #m_n used for the Broyden updates in solve()
+    vector_fp m_resid0, m_dx, m_wt;
+
     int m_maxAge;
 
     //! number of variables
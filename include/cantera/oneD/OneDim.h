@@ -185,9 +185,13 @@ public:
     }
 
     /*!
-     * Take time steps using Backward Euler.
+     * Take time steps using Backward Euler. The step size is increased after
+     * successful steps and decreased after failed steps, as set by
+     * setTimeStepController() and setTimeStepFactor().
      *
-     * @param nsteps number of steps
+     * @param nsteps number of steps. If the switched evolution relaxation
+     *     controller is used, fewer steps are taken if the maximum time step
+     *     is reached.
      * @param dt initial step size
      * @param x current solution vector
      * @param r solution vector after time stepping
@@ -209,6 +213,11 @@ public:
     void save(const std::string& fname, std::string id,
               const std::string& desc, doublereal* sol, int loglevel);
 
+    //! Add the solution `sol` to `root` as a child element "simulation", in
+    //! the format written to a file by save()
+    XML_Node& save(XML_Node& root, const std::string& id,
+                   const std::string& desc, doublereal* sol);
+
     // options
     void setMinTimeStep(doublereal tmin) {
         m_tmin = tmin;
@@ -219,6 +228,29 @@ public:
     void setTimeStepFactor(doublereal tfactor) {
         m_tfactor = tfactor;
     }
+
+    //! Select the method used by timeStep() to increase the time step
+    /*!
+     * By default, the time step is multiplied by 1.5 after each successful
+     * step that did not require a new Jacobian. If `ser` is true, the
+     * switched evolution relaxation (SER) method is used instead: after each
+     * successful step, the factor is the ratio of the weighted steady-state
+     * residual norms before and after the step, raised to the power
+     * `exponent`. While the residual decreases, the time step grows at least
+     * as fast as with the default method and at most by `maxFactor`; if the
+     * residual increases, the time step is reduced by up to `maxFactor`
+     * before the Newton iteration fails. Once the maximum time step is
+     * reached, timeStep() returns so that a steady-state solution can be
+     * attempted. In both cases, the Jacobian is reused between steps, with
+     * only its transient terms updated when the time step changes.
+     *
+     * @param ser  If true, use the SER method
+     * @param exponent  Exponent applied to the ratio of residual norms
+     * @param maxFactor  Largest factor by which the time step is changed
+     *     after a successful step
+     */
+    void setTimeStepController(bool ser, doublereal exponent=1.0,
+                               doublereal maxFactor=4.0);
     void setJacAge(int ss_age, int ts_age=-1) {
         m_ss_jac_age = ss_age;
         if (ts_age > 0) {
@@ -228,6 +260,29 @@ public:
         }
     }
 
+    //! Evaluate the Jacobian using grouped ("colored") finite differences,
+    //! which requires far fewer residual evaluations for large grids. See
+    //! MultiJac::setColoring().
+    void setJacobianColoring(bool color);
+
+    //! Use the Jacobian columns computed directly by the domains where they
+    //! are available, instead of finite differences. Currently, these are
+    //! the columns for the interior points of flow domains; the boundary
+    //! domains and the flow points next to them use finite differences. See
+    //! MultiJac::setAnalytic() and Domain1D::analyticJacobian().
+    void setAnalyticJacobian(bool analytic);
+
+    //! Solve the Newton iteration equations by block-tridiagonal LU
+    //! factorization of the Jacobian instead of banded LU factorization. See
+    //! MultiJac::setBlockSolver().
+    void setBlockTridiagonalSolver(bool block);
+
+    //! Correct the Jacobian with up to `maxUpdates` Broyden updates between
+    //! evaluations, instead of using it unchanged. See
+    //! MultiJac::setBroydenUpdates(). The default of zero disables the
+    //! updates.
+    void setBroydenUpdates(size_t maxUpdates);
+
     /**
      * Save statistics on function and Jacobian evaluation, and reset the
      * counters. Statistics are saved only if the number of Jacobian
@@ -236,6 +291,13 @@ public:
      * - number of grid points
      * - number of Jacobian evaluations
      * - CPU time spent evaluating Jacobians
+     * - number of Newton iterations that reused a Jacobian from an earlier
+     *   iteration, and the largest Jacobian age reached
+     * - number of times no damped Newton step could be found with the
+     *   current Jacobian
+     * - number of Broyden updates applied to the Jacobian
+     * - number of successful and failed time steps, and the number of
+     *   Jacobian evaluations while taking time steps
      * - number of non-Jacobian function evaluations
      * - CPU time spent evaluating functions
      */
@@ -244,6 +306,18 @@ public:
     //! Clear saved statistics
     void clearStats();
 
+    //! Number of successful time steps taken by timeStep() since the last
+    //! call to clearStats()
+    int nTimeSteps() const;
+
+    //! Number of time steps that failed and were retried with a smaller step
+    //! since the last call to clearStats()
+    int nTimeStepFailures() const;
+
+    //! Number of Jacobian evaluations while taking time steps since the last
+    //! call to clearStats()
+    int nTimeStepJacobians() const;
+
     //! Set a function that will be called every time #eval is called.
     //! Can be used to provide keyboard interrupt support in the high-level
     //! language interfaces.
@@ -280,6 +354,27 @@ protected:
     // options
     int m_ss_jac_age, m_ts_jac_age;
 
+    //! If true, the Jacobian is evaluated using grouped finite differences
+    bool m_jac_coloring;
+
+    //! If true, the domains compute their own Jacobian columns where possible
+    bool m_jac_analytic;
+
+    //! If true, the Jacobian is factored as a block-tridiagonal matrix
+    bool m_jac_block;
+
+    //! Maximum number of Broyden updates between Jacobian evaluations
+    size_t m_jac_broyden;
+
+    //! If true, timeStep() uses the SER time step controller
+    bool m_ser;
+
+    //! Exponent used by the SER time step controller
+    doublereal m_ser_exponent;
+
+    //! Largest change of the time step by the SER controller after one step
+    doublereal m_ser_factor;
+
     //! Function called at the start of every call to #eval.
     Func1* m_interrupt;
 
@@ -290,8 +385,20 @@ private:
     std::vector<size_t> m_gridpts;
     vector_int m_jacEvals;
     vector_fp m_jacElapsed;
+    vector_int m_jacReused;
+    vector_int m_jacMaxAge;
+    vector_int m_jacFailures;
+    vector_int m_jacUpdates;
     vector_int m_funcEvals;
     vector_fp m_funcElapsed;
+
+    //! Successful time steps, failed time steps and Jacobian evaluations
+    //! during time stepping on the current grid
+    int m_nsteps, m_nstepFailures, m_nstepJacs;
+
+    vector_int m_timeSteps;
+    vector_int m_timeStepFailures;
+    vector_int m_timeStepJacs;
 };
 
 }
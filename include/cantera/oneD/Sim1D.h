@@ -10,6 +10,9 @@
 namespace Cantera
 {
 
+class Logger;
+class SolutionFile;
+
 /**
  * One-dimensional simulations. Class Sim1D extends class OneDim by storing
  * the solution vector, and by adding a hybrid Newton/time-stepping solver.
@@ -23,7 +26,14 @@ public:
      * This constructor is provided to make the class default-constructible, but
      * is not meant to be used in most applications.  Use the next constructor
      */
-    Sim1D() {}
+    Sim1D() :
+        m_logger(0),
+        m_coarse_levels(0),
+        m_coarse_tol_factor(1.0),
+        m_cont_param(0),
+        m_cont_callback(0),
+        m_cont_minstep(1.0e-3),
+        m_cont_maxstep(20.0) {}
 
     /**
      * Standard constructor.
@@ -94,6 +104,24 @@ public:
     void saveResidual(const std::string& fname, const std::string& id,
                       const std::string& desc, int loglevel=1);
 
+    //! Add the current solution to `root`, in the same format as used by
+    //! save() for files, as a child element with the given id.
+    XML_Node& save(XML_Node& root, const std::string& id,
+                   const std::string& desc="");
+
+    //! Add the current grid and solution to a binary solution file
+    /*!
+     * Only the grid and the solution are stored; see SolutionFile.
+     *
+     * @param file  The file to write to
+     * @param id  The id of the solution. An existing solution with the same
+     *     id is replaced.
+     * @param desc  A description of the solution
+     * @param loglevel  Controls the amount of diagnostic output
+     */
+    void save(SolutionFile& file, const std::string& id,
+              const std::string& desc, int loglevel=1);
+
     /// Print to stream s the current solution for all domains.
     void showSolution(std::ostream& s);
     void showSolution();
@@ -133,9 +161,56 @@ public:
      */
     void setGridMin(int dom, double gridmin);
 
+    //! Use coarser grids and relaxed tolerances to speed up solve()
+    /*!
+     * Before solving on the current grid, solve() solves the problem on up
+     * to `levels` successively coarser grids, each obtained by removing every
+     * other interior point of the domains with at least 9 points, with the
+     * exception of the fixed temperature point of a FreeFlame. The coarsest
+     * grid is solved first, and each solution is interpolated onto the next
+     * finer grid as its initial estimate. The coarse grids are solved with
+     * the steady-state tolerances multiplied by `tol_factor`.
+     *
+     * When the grid is refined, the intermediate grids are also solved with
+     * the relaxed tolerances. Once refinement adds no more points, the
+     * problem is solved with the original tolerances, and the grid is
+     * refined again if needed.
+     *
+     * @param levels  Number of coarse grids. A value of 0 disables the
+     *     coarse grid solutions.
+     * @param tol_factor  Factor multiplying the steady-state tolerances for
+     *     the coarse and intermediate grids. A value of 1.0 disables the
+     *     relaxed tolerances.
+     */
+    void setCoarseGridSolve(size_t levels, doublereal tol_factor=10.0);
+
     //! Initialize the solution with a previously-saved solution.
     void restore(const std::string& fname, const std::string& id, int loglevel=2);
 
+    //! Initialize the solution from the "simulation" element `soln`, created
+    //! by one of the save() methods.
+    void restore(const XML_Node& soln, int loglevel=2);
+
+    //! Initialize the grid and solution with a solution from a binary
+    //! solution file.
+    /*!
+     * The stored components are matched to the components of each domain by
+     * name. Components which are not in the file, such as species that are
+     * not in the mechanism used to compute the stored solution, are set to
+     * zero. Settings which are not stored in the file, such as the
+     * tolerances, pressure and inlet conditions, are not changed. As with
+     * the other restore() methods, the temperature profile used by flow
+     * domains when the energy equation is disabled is set to the restored
+     * temperature, and the stored attributes of each domain, such as the
+     * fixed temperature point of a FreeFlame, are restored.
+     *
+     * @param file  The file to read from
+     * @param id  The id of the solution
+     * @param loglevel  Controls the amount of diagnostic output
+     */
+    void restore(const SolutionFile& file, const std::string& id,
+                 int loglevel=2);
+
     void getInitialSoln();
 
     void setSolution(const doublereal* soln) {
@@ -150,6 +225,127 @@ public:
 
     void evalSSJacobian();
 
+    //! Copy the solver options from another simulation
+    /*!
+     * The options copied are the time step settings, the Jacobian and
+     * Newton iteration options set through the methods of OneDim, the
+     * continuation step limits, and the coarse grid options. The functions
+     * and logger set with setInterrupt(), setContinuationParameter(),
+     * setContinuationCallback() and setLogger() are not copied.
+     */
+    void copyOptions(const Sim1D& other);
+
+    //! Set the logger used for the messages written by this simulation
+    /*!
+     * While solve(), refine(), restore(), showSolution(),
+     * solveContinuation() or solveArclength() is running, log messages
+     * written by the calling thread are passed to `logger` instead of the
+     * logger installed with setLogger(Logger*). This allows the output of
+     * simulations run concurrently on different threads to be kept apart.
+     * The logger is not owned by this object.
+     *
+     * @param logger  Pointer to a logger object, or NULL to use the global
+     *     logger.
+     */
+    void setLogger(Logger* logger) {
+        m_logger = logger;
+    }
+
+    /**
+     * @name Continuation
+     *
+     * These methods compute a sequence of solutions for different values of a
+     * parameter, such as the inlet mass flux, the pressure, or the inlet
+     * composition. Each solution is used as the starting estimate for the
+     * next one, on the same grid, so that only the first solution requires
+     * time stepping. The parameter is changed by calling the `eval` method of
+     * the function set with setContinuationParameter(), which should modify
+     * the domains accordingly; its return value is ignored.
+     */
+    //@{
+
+    //! Set the function used to change the value of the continuation
+    //! parameter.
+    void setContinuationParameter(Func1* setter) {
+        m_cont_param = setter;
+    }
+
+    //! Set a function to be called with the value of the parameter after each
+    //! converged solution. If it returns a negative value, the continuation
+    //! is stopped.
+    void setContinuationCallback(Func1* callback) {
+        m_cont_callback = callback;
+    }
+
+    //! Set the smallest and largest step sizes allowed during continuation,
+    //! as multiples of the initial step size. The defaults are 0.001 and 20.
+    void setContinuationStepLimits(doublereal minRatio, doublereal maxRatio);
+
+    //! Natural parameter continuation from `p0` to `p1`
+    /*!
+     * The problem is first solved for `p0` using solve(). The parameter is
+     * then changed in steps towards `p1`. The starting estimate for each
+     * step is extrapolated linearly from the last two solutions, and only
+     * Newton iterations are used to solve the steady-state problem. If they
+     * fail, the previous grid and solution are restored and the step size is
+     * halved. After each successful step, the step size is increased by 50%.
+     *
+     * @param p0  Initial value of the parameter
+     * @param p1  Final value of the parameter
+     * @param dp  Initial step size. Only its magnitude is used.
+     * @param loglevel  Controls the amount of diagnostic output.
+     * @param refine_grid  If true, the grid is refined after each step.
+     * @returns true if the solution for `p1` was found. Otherwise, the last
+     *     converged solution is kept.
+     */
+    bool solveContinuation(doublereal p0, doublereal p1, doublereal dp,
+                           int loglevel=0, bool refine_grid=true);
+
+    //! Pseudo-arclength continuation starting from `p0`
+    /*!
+     * After solving the problem for `p0` using solve(), takes steps of size
+     * `ds` along the solution curve in the space of the solution and the
+     * parameter. Unlike solveContinuation(), this can follow the solution
+     * around turning points, such as the extinction point of a counterflow
+     * diffusion flame as a function of the strain rate. Each step uses the
+     * secant through the last two solutions as the predictor, which is then
+     * corrected by Newton iterations on the steady-state equations augmented
+     * with the pseudo-arclength condition. Both the solution and the
+     * parameter are scaled when measuring the arclength: each component is
+     * divided by its largest magnitude in the domain, and the parameter is
+     * divided by `p0`. Far from turning points, the relative change in the
+     * parameter for each step is therefore about `ds`.
+     *
+     * If the corrector fails, the step size is halved. If it converges in
+     * six iterations or less, the step size is increased by 50%. Values of
+     * the parameter where it reaches a local extremum are available from
+     * turningPoints().
+     *
+     * @param p0  Initial value of the parameter
+     * @param ds  Initial step size. The sign determines whether the parameter
+     *     initially increases or decreases.
+     * @param nsteps  Number of steps to take
+     * @param loglevel  Controls the amount of diagnostic output.
+     * @param refine_grid  If true, the grid is refined after each step.
+     * @returns the number of steps taken
+     */
+    size_t solveArclength(doublereal p0, doublereal ds, size_t nsteps,
+                          int loglevel=0, bool refine_grid=true);
+
+    //! Values of the parameter for each converged solution found by the last
+    //! call to solveContinuation() or solveArclength()
+    const vector_fp& continuationParameters() const {
+        return m_cont_params;
+    }
+
+    //! Values of the parameter at the turning points passed by the last call
+    //! to solveArclength(), estimated by quadratic interpolation
+    const vector_fp& turningPoints() const {
+        return m_turning_points;
+    }
+
+    //@}
+
 protected:
     //! the solution vector
     vector_fp m_x;
@@ -164,6 +360,33 @@ protected:
     //! solution
     vector_int m_steps;
 
+    //! Logger used while solving, if not NULL. See setLogger().
+    Logger* m_logger;
+
+    //! Number of coarse grids solved before the current grid. See
+    //! setCoarseGridSolve().
+    size_t m_coarse_levels;
+
+    //! Factor multiplying the steady-state tolerances on coarse and
+    //! intermediate grids
+    doublereal m_coarse_tol_factor;
+
+    //! Function used to set the continuation parameter
+    Func1* m_cont_param;
+
+    //! Function called after each converged continuation step
+    Func1* m_cont_callback;
+
+    //! Smallest and largest continuation step sizes, relative to the initial
+    //! step size
+    doublereal m_cont_minstep, m_cont_maxstep;
+
+    //! Parameter values of the solutions found by the last continuation
+    vector_fp m_cont_params;
+
+    //! Turning points found by the last arclength continuation
+    vector_fp m_turning_points;
+
 private:
     /// Calls method _finalize in each domain.
     void finalize();
@@ -173,6 +396,71 @@ private:
      * @return 0 if successful, -1 on failure
      */
     int newtonSolve(int loglevel);
+
+    //! Solve the steady-state problem on the current grid, taking time steps
+    //! whenever the Newton iteration fails
+    /*!
+     * @param dt  The initial time step. On return, the last time step taken.
+     * @param loglevel  Controls the amount of diagnostic output
+     */
+    void solveSteady(doublereal& dt, int loglevel);
+
+    //! Solve on successively coarser versions of the current grid, and
+    //! interpolate the solutions back onto the current grid. See
+    //! setCoarseGridSolve().
+    void solveCoarseGrids(doublereal& dt, int loglevel);
+
+    //! Set the value of the continuation parameter
+    void setParameter(doublereal p);
+
+    //! Call the continuation callback. Returns true if the continuation
+    //! should be stopped.
+    bool continuationStopped(doublereal p);
+
+    //! Solve the steady-state problem using only Newton iterations, refining
+    //! the grid if requested
+    /*!
+     * @return true if successful
+     */
+    bool continuationSolve(int loglevel, bool refine_grid);
+
+    //! Get the grid of each domain
+    void getGrids(std::vector<vector_fp>& grids) const;
+
+    //! Replace the grid of each domain and the solution vector
+    void setGrids(const std::vector<vector_fp>& grids, const vector_fp& x);
+
+    //! Replace the grid of each domain, and linearly interpolate the current
+    //! solution onto the new grids
+    void regrid(const std::vector<vector_fp>& grids);
+
+    //! Linearly interpolate a vector defined on the grids `grids` onto the
+    //! current grid
+    void interpolate(const std::vector<vector_fp>& grids, const vector_fp& v,
+                     vector_fp& out) const;
+
+    //! Move each component of `x` inside the bounds of its domain
+    void applyBounds(doublereal* x) const;
+
+    //! Weights used to scale the solution vector for arclength continuation
+    void continuationWeights(vector_fp& w);
+
+    //! Pseudo-arclength inner product of `(x, xp)` and `(y, yp)`
+    doublereal arclengthDot(const vector_fp& x, doublereal xp,
+                            const vector_fp& y, doublereal yp,
+                            const vector_fp& w, doublereal wp) const;
+
+    //! Predictor-corrector step for arclength continuation
+    /*!
+     * Starting from the solution in #m_x with parameter value `p0`, solves
+     * for the solution `x` and parameter `p` on the hyperplane at distance
+     * `ds` along the tangent `(t, tp)`.
+     *
+     * @return the number of corrector iterations, or -1 on failure
+     */
+    int arclengthStep(vector_fp& x, doublereal& p, doublereal p0,
+                      const vector_fp& t, doublereal tp, doublereal ds,
+                      const vector_fp& w, doublereal wp, int loglevel);
 };
 
 }
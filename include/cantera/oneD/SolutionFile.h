@@ -0,0 +1,168 @@
+/**
+ * @file SolutionFile.h
+ * Binary storage for the solutions of one-dimensional simulations
+ */
+
+#ifndef CT_SOLUTIONFILE_H
+#define CT_SOLUTIONFILE_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <ctime>
+
+namespace Cantera
+{
+
+/**
+ * A file containing any number of named solutions of one-dimensional
+ * simulations, stored in a compact binary format. Solutions are written with
+ * Sim1D::save(SolutionFile&, ...) and read with
+ * Sim1D::restore(const SolutionFile&, ...).
+ *
+ * Unlike the CTML files written by Sim1D::save(const std::string&, ...), the
+ * values are stored without conversion to text, so a restored solution is
+ * identical to the saved one. For each solution, the file contains the
+ * description, the time when it was saved, and for each domain, its id, the
+ * names of its components, any named scalar attributes (such as the fixed
+ * temperature point of a FreeFlame), the grid, and the solution values. The
+ * other settings of the domains, such as the tolerances and the inlet
+ * conditions, are not stored.
+ *
+ * Where supported, the file is mapped into memory when it is opened, so only
+ * the parts of the file which are accessed are read from disk. The domain
+ * data returned by domains() points directly into the mapped file.
+ *
+ * The file starts with a 16-byte header, consisting of the text "CT1DSOLN",
+ * the format version, and a byte order mark, each as 4-byte integers. The
+ * solutions follow, each starting at a multiple of 8 bytes. The last part of
+ * the file is an index listing the id, offset and size of each solution,
+ * followed by the offset of the index and the text "CT1DSOLN". A new solution
+ * is written in place of the index, after which the index is written again,
+ * so adding a solution does not rewrite the existing ones. If a solution is
+ * added with the id of an existing solution, the index entry is changed to
+ * refer to the new solution, but the space used by the old solution is not
+ * reclaimed.
+ *
+ * All integers are 8-byte unsigned integers unless noted otherwise, and
+ * strings are stored as their length followed by their characters. Values
+ * are stored using the byte order of the machine writing the file, and
+ * files written on a machine with a different byte order cannot be read.
+ *
+ * @ingroup onedim
+ */
+class SolutionFile
+{
+public:
+    //! The solution for one domain, as stored in the file
+    struct DomainData {
+        //! The id of the domain
+        std::string id;
+
+        //! Number of grid points
+        size_t nPoints;
+
+        //! Names of the solution components
+        std::vector<std::string> components;
+
+        //! Grid point locations. Array of length #nPoints.
+        const doublereal* grid;
+
+        //! Solution values, in the same order as in the solution vector of
+        //! a Sim1D, i.e. the value of component `n` at point `j` is
+        //! `values[n + j*components.size()]`.
+        const doublereal* values;
+
+        //! Other named scalar values needed to restore the domain, such as
+        //! the fixed temperature point of a FreeFlame. See
+        //! Domain1D::getAttributes().
+        std::map<std::string, doublereal> attributes;
+    };
+
+    //! Open the solution file `fname`. If the file does not exist, it is
+    //! created when the first solution is added.
+    explicit SolutionFile(const std::string& fname);
+
+    virtual ~SolutionFile();
+
+    SolutionFile(const SolutionFile&) = delete;
+    SolutionFile& operator=(const SolutionFile&) = delete;
+
+    //! The name of the file
+    const std::string& fileName() const {
+        return m_fname;
+    }
+
+    //! Number of solutions in the file
+    size_t nSolutions() const {
+        return m_entries.size();
+    }
+
+    //! The ids of the solutions in the file, in the order they were added
+    std::vector<std::string> solutionIds() const;
+
+    //! True if the file contains a solution with the given id
+    bool hasSolution(const std::string& id) const;
+
+    //! The description of solution `id`
+    std::string description(const std::string& id) const;
+
+    //! The time when solution `id` was saved
+    std::time_t saveTime(const std::string& id) const;
+
+    //! The data for each domain of solution `id`. The grid and solution
+    //! arrays point into the memory holding the file, and remain valid until
+    //! a solution is added or this object is destroyed.
+    std::vector<DomainData> domains(const std::string& id) const;
+
+    //! Add a solution to the file, replacing any solution with the same id.
+    /*!
+     * @param id    The id of the solution
+     * @param desc  A description of the solution
+     * @param domains  The solution for each domain
+     */
+    void addSolution(const std::string& id, const std::string& desc,
+                     const std::vector<DomainData>& domains);
+
+protected:
+    //! Location of a solution in the file
+    struct Entry {
+        std::string id;
+        size_t offset;
+        size_t size;
+    };
+
+    //! Map the file into memory, and read the index
+    void mapFile();
+
+    //! Release the memory holding the contents of the file
+    void unmapFile();
+
+    //! The entry for solution `id`
+    const Entry& entry(const std::string& id) const;
+
+    //! The name of the file
+    std::string m_fname;
+
+    //! The solutions in the file
+    std::vector<Entry> m_entries;
+
+    //! The offset of the index, where the next solution is written
+    size_t m_indexOffset;
+
+    //! The contents of the file
+    const char* m_data;
+
+    //! The size of the file, in bytes
+    size_t m_size;
+
+    //! True if #m_data points to a memory-mapped file
+    bool m_mapped;
+
+    //! Holds the contents of the file on systems where the file is read
+    //! rather than mapped into memory
+    vector_fp m_buffer;
+};
+
+}
+
+#endif
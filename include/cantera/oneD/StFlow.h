@@ -65,6 +65,9 @@ public:
     Kinetics& kinetics() {
         return *m_kin;
     }
+    Transport& transport() {
+        return *m_trans;
+    }
 
     virtual void init() {
     }
@@ -75,11 +78,13 @@ public:
      */
     void setThermo(IdealGasPhase& th) {
         m_thermo = &th;
+        clearThreadCopies();
     }
 
     //! Set the kinetics manager. The kinetics manager must
     void setKinetics(Kinetics& kin) {
         m_kin = &kin;
+        clearThreadCopies();
     }
 
     //! set the transport manager
@@ -216,6 +221,16 @@ public:
         }
     }
 
+    //! Return the emissivity at the left boundary
+    doublereal leftEmissivity() const {
+        return m_epsilon_left;
+    }
+
+    //! Return the emissivity at the right boundary
+    doublereal rightEmissivity() const {
+        return m_epsilon_right;
+    }
+
     void fixTemperature(size_t j=npos) {
         bool changed = false;
         if (j == npos) {
@@ -239,6 +254,33 @@ public:
         }
     }
 
+    //! Set the number of threads used to evaluate the residual
+    /*!
+     * When the residual is evaluated at all points, including each group of
+     * columns of a colored Jacobian (see MultiJac::setColoring), the
+     * thermodynamic properties, reaction rates, mixture-averaged transport
+     * properties, and residual equations are evaluated for contiguous ranges
+     * of grid points on separate threads. Each additional thread uses its own
+     * copies of the phase, kinetics, and transport managers, which are made
+     * at the next evaluation of the residual. Changes made to the original
+     * objects after that, for example to the reaction rate multipliers, are
+     * not seen by the copies until setThreads(), setThermo(), setKinetics(),
+     * or setTransport() is called again. The results do not depend on the
+     * number of threads.
+     *
+     * Multicomponent transport properties are always evaluated on the calling
+     * thread.
+     *
+     * @param nthreads  Number of threads, including the calling thread. A
+     *     value of 0 means the number of hardware threads.
+     */
+    void setThreads(size_t nthreads);
+
+    //! Number of threads used to evaluate the residual. See setThreads().
+    size_t threads() const {
+        return m_nthreads;
+    }
+
     bool doEnergy(size_t j) {
         return m_do_energy[j];
     }
@@ -280,15 +322,46 @@ public:
     virtual void eval(size_t j, doublereal* x, doublereal* r,
                       integer* mask, doublereal rdt);
 
+    //! Columns for all points except the two points nearest each boundary
+    //! are computed by evalJacobian().
+    virtual bool analyticJacobian(size_t j) const;
+
+    /*!
+     * Compute the Jacobian columns for the interior points directly from the
+     * discretized equations. As for the finite difference Jacobian, the
+     * transport properties are held fixed. The derivatives of the local
+     * thermochemical properties (density, heat capacity, species production
+     * rates, enthalpies, and radiative heat loss) are found by perturbing the
+     * temperature and mass fractions at each point separately, which
+     * requires only one evaluation of the reaction rates per component.
+     */
+    virtual void evalJacobian(doublereal* x, MultiJac& jac);
+
     //! Evaluate all residual components at the right boundary.
     virtual void evalRightBoundary(doublereal* x, doublereal* res,
                                    integer* diag, doublereal rdt) = 0;
 
     //! Evaluate the residual corresponding to the continuity equation at all
-    //! interior grid points.
+    //! interior grid points. May be called for different points at the same
+    //! time from different threads (see setThreads()).
     virtual void evalContinuity(size_t j, doublereal* x, doublereal* r,
                                 integer* diag, doublereal rdt) = 0;
 
+    //! Derivatives of the residual of the continuity equation at interior
+    //! point `i`, as computed by evalContinuity().
+    /*!
+     * @param i  Point at which the residual is evaluated
+     * @param j  Point of the solution component, one of `i-1`, `i`, or `i+1`
+     * @param[out] d_rhou  Derivative with respect to rho*u at point `j`
+     * @param[out] d_rhoV  Derivative with respect to rho*V at point `j`
+     * @param[out] d_T  Derivative with respect to T at point `j`, other than
+     *     through the density
+     */
+    virtual void continuityDerivs(size_t i, size_t j, doublereal& d_rhou,
+                                  doublereal& d_rhoV, doublereal& d_T) const {
+        throw NotImplementedError("StFlow::continuityDerivs");
+    }
+
 protected:
     doublereal component(const doublereal* x, size_t i, size_t j) const {
         return x[index(i,j)];
@@ -308,23 +381,74 @@ protected:
 
     //! Write the net production rates at point `j` into array `m_wdot`
     void getWdot(doublereal* x, size_t j) {
-        setGas(x,j);
-        m_kin->getNetProductionRates(&m_wdot(0,j));
+        getWdot(x, j, *m_thermo, *m_kin);
+    }
+
+    //! Write the net production rates at point `j` into array `m_wdot`,
+    //! using the phase `gas` and its kinetics manager `kin`
+    void getWdot(const doublereal* x, size_t j, IdealGasPhase& gas,
+                 Kinetics& kin) {
+        setGas(x, j, gas);
+        kin.getNetProductionRates(&m_wdot(0,j));
     }
 
     /**
      * Update the thermodynamic properties from point j0 to point j1
      * (inclusive), based on solution x.
      */
-    void updateThermo(const doublereal* x, size_t j0, size_t j1) {
+    void updateThermo(const doublereal* x, size_t j0, size_t j1);
+
+    //! Update the thermodynamic properties from point j0 to point j1
+    //! (inclusive) using the phase `gas`
+    void updateThermo(const doublereal* x, size_t j0, size_t j1,
+                      IdealGasPhase& gas) {
         for (size_t j = j0; j <= j1; j++) {
-            setGas(x,j);
-            m_rho[j] = m_thermo->density();
-            m_wtm[j] = m_thermo->meanMolecularWeight();
-            m_cp[j] = m_thermo->cp_mass();
+            setGas(x, j, gas);
+            m_rho[j] = gas.density();
+            m_wtm[j] = gas.meanMolecularWeight();
+            m_cp[j] = gas.cp_mass();
         }
     }
 
+    //! Set the state of `gas` to be consistent with the solution at point j
+    void setGas(const doublereal* x, size_t j, IdealGasPhase& gas) const;
+
+    //! Evaluate the residual equations at points `jmin` to `jmax`
+    //! (inclusive), using the phase `gas` and its kinetics manager `kin`.
+    //! Called by eval() after the properties have been updated.
+    void evalPoints(doublereal* x, doublereal* rsd, integer* diag,
+                    doublereal rdt, size_t jmin, size_t jmax,
+                    IdealGasPhase& gas, Kinetics& kin);
+
+    //! Number of threads to use for evaluating `npoints` points. Small
+    //! ranges of points, such as those evaluated for a single column of the
+    //! Jacobian, are evaluated on the calling thread.
+    size_t nThreadsFor(size_t npoints) const {
+        return std::max<size_t>(std::min(m_nthreads, npoints / 16), 1);
+    }
+
+    //! Make the copies of the phase, kinetics, and transport managers used
+    //! by each thread other than the calling thread, if they do not already
+    //! exist
+    void makeThreadCopies();
+
+    //! Delete the copies of the phase, kinetics and transport managers
+    void clearThreadCopies() {
+        m_thread_thermo.clear();
+        m_thread_kin.clear();
+        m_thread_trans.clear();
+    }
+
+    //! The phase used by thread `t`, where thread 0 is the calling thread
+    IdealGasPhase& threadPhase(size_t t) {
+        return t ? *m_thread_thermo[t-1] : *m_thermo;
+    }
+
+    //! The kinetics manager used by thread `t`
+    Kinetics& threadKinetics(size_t t) {
+        return t ? *m_thread_kin[t-1] : *m_kin;
+    }
+
     //--------------------------------
     // central-differenced derivatives
     //--------------------------------
@@ -427,6 +551,25 @@ protected:
     //! Update the diffusive mass fluxes.
     void updateDiffFluxes(const doublereal* x, size_t j0, size_t j1);
 
+    //! Derivatives of the diffusive mass fluxes at the midpoint between `m`
+    //! and `m+1` with respect to the temperature (column 0) and the mass
+    //! fractions (columns 1 to #m_nsp) at point `j`, which is either `m` or
+    //! `m+1`. The transport properties are held fixed.
+    void getFluxDerivs(const doublereal* x, size_t m, size_t j, Array2D& dF);
+
+    //! Radiative heat loss per unit volume at point `j` [W/m^3]
+    /*!
+     * @param x  Local solution vector
+     * @param j  Grid point
+     * @param wtm  Mean molecular weight, used to compute the mole fractions of
+     *     the radiating species
+     * @param rad_left  Radiative heat flux from the left boundary
+     * @param rad_right  Radiative heat flux from the right boundary
+     */
+    doublereal radiativeHeatLoss(const doublereal* x, size_t j, doublereal wtm,
+                                 doublereal rad_left,
+                                 doublereal rad_right) const;
+
     //---------------------------------------------------------
     //             member data
     //---------------------------------------------------------
@@ -467,6 +610,11 @@ protected:
     doublereal m_epsilon_left;
     doublereal m_epsilon_right;
 
+    //! Radiative heat flux from each boundary, from the last evaluation of
+    //! the residual that was not part of a colored Jacobian evaluation
+    doublereal m_boundary_rad_left;
+    doublereal m_boundary_rad_right;
+
     //! Indices within the ThermoPhase of the radiating species. First index is
     //! for CO2, second is for H2O.
     std::vector<size_t> m_kRadiating;
@@ -496,6 +644,43 @@ protected:
 
 private:
     vector_fp m_ybar;
+
+    //! Number of threads used to evaluate the residual
+    size_t m_nthreads;
+
+    //! @name Copies of the phase, kinetics, and transport managers
+    //! Element `t-1` of each vector is used by thread `t`. Transport managers
+    //! are only copied for mixture-averaged transport.
+    //! @{
+    std::vector<std::unique_ptr<IdealGasPhase>> m_thread_thermo;
+    std::vector<std::unique_ptr<Kinetics>> m_thread_kin;
+    std::vector<std::unique_ptr<Transport>> m_thread_trans;
+    //! @}
+
+    //! Temperatures, pressures and mole fractions at the midpoints, used to
+    //! evaluate the mixture-averaged transport properties for many points
+    //! at once
+    vector_fp m_tbar;
+    vector_fp m_pbar;
+    vector_fp m_xbar;
+
+    //! @name Work arrays used by evalJacobian()
+    //! @{
+    Array2D m_jac_hRT; //!< Species enthalpies (h/RT) at each point
+    Array2D m_jac_cpR; //!< Species heat capacities (cp/R) at each point
+
+    //! Derivatives of density, specific heat capacity, and radiative heat
+    //! loss with respect to T and Y_k at the current point
+    vector_fp m_jac_drho, m_jac_dcp, m_jac_dqrad;
+    Array2D m_jac_dwdot; //!< Derivatives of the production rates
+    vector_fp m_jac_dhRT; //!< Derivatives of h/RT with respect to T
+    vector_fp m_jac_dcpR; //!< Derivatives of cp/R with respect to T
+
+    //! Derivatives of the fluxes at the midpoints to the left and right of
+    //! the current point
+    Array2D m_jac_dFleft, m_jac_dFright;
+    vector_fp m_jac_work;
+    //! @}
 };
 
 /**
@@ -514,6 +699,8 @@ public:
                                    integer* diag, doublereal rdt);
     virtual void evalContinuity(size_t j, doublereal* x, doublereal* r,
                                 integer* diag, doublereal rdt);
+    virtual void continuityDerivs(size_t i, size_t j, doublereal& d_rhou,
+                                  doublereal& d_rhoV, doublereal& d_T) const;
 
     virtual std::string flowType() {
         return "Axisymmetric Stagnation";
@@ -616,6 +803,8 @@ public:
                                    integer* diag, doublereal rdt);
     virtual void evalContinuity(size_t j, doublereal* x, doublereal* r,
                                 integer* diag, doublereal rdt);
+    virtual void continuityDerivs(size_t i, size_t j, doublereal& d_rhou,
+                                  doublereal& d_rhoV, doublereal& d_T) const;
 
     virtual std::string flowType() {
         return "Free Flame";
@@ -628,6 +817,10 @@ public:
 
     virtual XML_Node& save(XML_Node& o, const doublereal* const sol);
 
+    //! Stores the fixed temperature point as `z_fixed` and `t_fixed`
+    virtual void getAttributes(std::map<std::string, doublereal>& attribs) const;
+    virtual void setAttributes(const std::map<std::string, doublereal>& attribs);
+
     //! Location of the point where temperature is fixed
     doublereal m_zfixed;
 
@@ -18,5 +18,7 @@
 #include "oneD/MultiNewton.h"
 #include "oneD/MultiJac.h"
 #include "oneD/StFlow.h"
+#include "oneD/FlameSweep.h"
+#include "oneD/SolutionFile.h"
 #endif
 
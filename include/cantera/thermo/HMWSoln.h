@@ -2212,6 +2212,10 @@ private:
      */
     Array2D m_Psi_ijk_coeff;
 
+    //! Indices n of the Psi_ijk interactions which have nonzero coefficients.
+    //! Only these are updated when the temperature changes.
+    std::vector<size_t> m_Psi_ijk_nonzero;
+
     //! Lambda coefficient for the ij interaction
     /*!
      * Array of 2D data used in the Pitzer/HMW formulation. Lambda_nj[n][j]
@@ -2668,6 +2672,17 @@ private:
     void calc_thetas(int z1, int z2,
                      double* etheta, double* etheta_prime) const;
 
+    //! Calculate the functions g(x) and hfunc(x) for each cation-anion pair
+    /*!
+     * The results are stored in m_gfunc_IJ, m_hfunc_IJ, m_g2func_IJ and
+     * m_h2func_IJ. They only depend on the ionic strength, so the values are
+     * shared by the activity coefficient routine and the routines for its
+     * temperature and pressure derivatives.
+     *
+     * @param is Ionic strength
+     */
+    void calc_gfuncs(double is) const;
+
     //! Set up a counter variable for keeping track of symmetric binary
     //! interactions amongst the solute species.
     /*!
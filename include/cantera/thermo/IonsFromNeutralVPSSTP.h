@@ -334,19 +334,16 @@ private:
     //! been identified.
     void initLengths();
 
-    //! Update the activity coefficients
+    //! Update the activity coefficients and their derivatives
     /*!
-     * This function will be called to update the internally stored natural
-     * logarithm of the activity coefficients
+     * The natural logarithm of the activity coefficients, their derivatives
+     * wrt temperature, and the diagonal components of their derivatives wrt
+     * log(mole fraction) and log(number of moles) are obtained from the
+     * neutral molecule phase and mapped onto the ions in a single pass. The
+     * results are stored internally and are only recomputed when the
+     * temperature, pressure or composition changes.
      */
-    void s_update_lnActCoeff() const;
-
-    //! Update the temperature derivative of the ln activity coefficients
-    /*!
-     * This function will be called to update the internally stored temperature
-     * derivative of the natural logarithm of the activity coefficients
-     */
-    void s_update_dlnActCoeffdT() const;
+    void s_update_lnActCoeff_all() const;
 
     //! Update the change in the ln activity coefficients
     /*!
@@ -356,24 +353,6 @@ private:
      */
     void s_update_dlnActCoeff() const;
 
-    //! Update the derivative of the log of the activity coefficients wrt
-    //! log(mole fraction)
-    /*!
-     * This function will be called to update the internally stored
-     * derivative of the natural logarithm of the activity coefficients
-     * wrt logarithm of the mole fractions.
-     */
-    void s_update_dlnActCoeff_dlnX_diag() const;
-
-    //! Update the derivative of the log of the activity coefficients wrt
-    //! log(number of moles) - diagonal components
-    /*!
-     * This function will be called to update the internally stored derivative
-     * of the natural logarithm of the activity coefficients wrt logarithm of
-     * the number of moles of given species.
-     */
-    void s_update_dlnActCoeff_dlnN_diag() const;
-
     //! Update the derivative of the log of the activity coefficients
     //! wrt log(number of moles) - diagonal components
     /*!
@@ -400,46 +400,16 @@ private:
     //! identified.
     void initLengths();
 
-    //! Update the activity coefficients
+    //! Update the activity coefficients and all of their derivatives
     /*!
-     * This function will be called to update the internally stored natural
-     * logarithm of the activity coefficients
+     * The natural logarithm of the activity coefficients, their first and
+     * second derivatives wrt temperature, and their derivatives wrt the log
+     * of the mole fractions (diagonal only) and the log of the mole numbers
+     * (diagonal and full matrix) are all evaluated in a single pass over the
+     * binary interaction terms. The results are stored internally and are
+     * only recomputed when the temperature or the composition changes.
      */
-    void s_update_lnActCoeff() const;
-
-    //! Update the derivative of the log of the activity coefficients wrt T
-    /*!
-     * This function will be called to update the internally stored derivative
-     * of the natural logarithm of the activity coefficients wrt temperature.
-     */
-    void s_update_dlnActCoeff_dT() const;
-
-    //! Update the derivative of the log of the activity coefficients wrt
-    //! log(mole fraction)
-    /*!
-     * This function will be called to update the internally stored derivative
-     * of the natural logarithm of the activity coefficients wrt logarithm of
-     * the mole fractions.
-     */
-    void s_update_dlnActCoeff_dlnX_diag() const;
-
-    //! Update the derivative of the log of the activity coefficients wrt
-    //! log(moles) - diagonal only
-    /*!
-     * This function will be called to update the internally stored diagonal
-     * entries for the derivative of the natural logarithm of the activity
-     * coefficients wrt logarithm of the moles.
-     */
-    void s_update_dlnActCoeff_dlnN_diag() const;
-
-    //! Update the derivative of the log of the activity coefficients wrt
-    //! log(moles_m)
-    /*!
-     * This function will be called to update the internally stored derivative
-     * of the natural logarithm of the activity coefficients wrt logarithm of
-     * the mole number of species
-     */
-    void s_update_dlnActCoeff_dlnN() const;
+    void s_update_lnActCoeff_all() const;
 
 protected:
     //! number of binary interaction expressions
@@ -190,6 +190,12 @@ public:
     virtual doublereal critDensity() const;
     virtual doublereal satPressure(doublereal t);
 
+    //! Use a precomputed table to find the density from the temperature and
+    //! pressure. See WaterPropsIAPWS::setDensityTable().
+    void setDensityTable(shared_ptr<WaterDensityTable> table) {
+        m_sub.setDensityTable(table);
+    }
+
     //! Get a pointer to a changeable WaterPropsIAPWS object
     WaterPropsIAPWS* getWater() {
         return &m_sub;
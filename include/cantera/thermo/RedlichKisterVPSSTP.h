@@ -405,42 +405,17 @@ private:
     //! identified.
     void initLengths();
 
-    //! Update the activity coefficients
+    //! Update the activity coefficients and all of their derivatives
     /*!
-     * This function will be called to update the internally stored natural
-     * logarithm of the activity coefficients
+     * The natural logarithm of the activity coefficients, their derivatives
+     * wrt temperature, the derivatives wrt the log of the mole fractions
+     * (diagonal only) and the matrix of derivatives wrt the mole fractions
+     * (see #dlnActCoeff_dX_) are evaluated in a single pass over the binary
+     * interaction terms, sharing the polynomial sums in (X_A - X_B). The
+     * results are stored internally and are only recomputed when the
+     * temperature or the composition changes.
      */
-    void s_update_lnActCoeff() const;
-
-    //! Update the derivative of the log of the activity coefficients wrt T
-    /*!
-     * This function will be called to update the internally stored derivative
-     * of the natural logarithm of the activity coefficients wrt temperature.
-     */
-    void s_update_dlnActCoeff_dT() const;
-
-    //! Internal routine that calculates the derivative of the activity
-    //! coefficients wrt the mole fractions.
-    /*!
-     * This routine calculates the the derivative of the activity coefficients
-     * wrt to mole fraction with all other mole fractions held constant. This is
-     * strictly not permitted. However, if the resulting matrix is multiplied by
-     * a permissible deltaX vector then everything is ok.
-     *
-     * This is the natural way to handle concentration derivatives in this
-     * routine.
-     */
-    void s_update_dlnActCoeff_dX_() const;
-
-    //! Internal routine that calculates the total derivative of the activity
-    //! coefficients with respect to the log of the mole fractions.
-    /*!
-     * This function will be called to update the internally stored vector of
-     * the total derivatives (i.e. not assuming other mole fractions are
-     * constant) of the natural logarithm of the activity coefficients with
-     * respect to the log of the mole fraction.
-     */
-    void s_update_dlnActCoeff_dlnX_diag() const;
+    void s_update_lnActCoeff_all() const;
 
 public:
     //! Utility routine that calculates a literature expression
@@ -492,6 +467,12 @@ protected:
 
     //! Two dimensional array of derivatives of activity coefficients wrt mole
     //! fractions
+    /*!
+     * This is the derivative of the activity coefficients wrt to mole fraction
+     * with all other mole fractions held constant. This is strictly not
+     * permitted. However, if the resulting matrix is multiplied by a
+     * permissible deltaX vector then everything is ok.
+     */
     mutable Array2D dlnActCoeff_dX_;
 };
 
@@ -227,6 +227,28 @@ public:
     virtual doublereal liquidVolEst(doublereal TKelvin, doublereal& pres) const;
     virtual doublereal densityCalc(doublereal TKelvin, doublereal pressure, int phase, doublereal rhoguess);
 
+    //! Calculate the densities for a set of temperatures and pressures at the
+    //! current composition
+    /*!
+     * The composition-dependent mixing sums for the a and b parameters are
+     * evaluated once for the whole set, so each additional state only costs a
+     * solution of the cubic equation of state. When both a liquid and a gas
+     * root exist and the phase is not specified, the root is chosen to be on
+     * the same branch as the solution for the previous state in the set. The
+     * state of the object is not changed.
+     *
+     * @param nStates        Number of states
+     * @param TKelvin        Temperatures (K). Length nStates.
+     * @param presPa         Pressures (Pa). Length nStates.
+     * @param phaseRequested Phase to return the density for. See densityCalc().
+     * @param rho            Output densities (kg/m^3). Length nStates. As for
+     *     densityCalc(), negative values indicate that no root was found for
+     *     the requested phase.
+     */
+    void densitiesCalc(size_t nStates, const doublereal* TKelvin,
+                       const doublereal* presPa, int phaseRequested,
+                       doublereal* rho) const;
+
     virtual doublereal densSpinodalLiquid() const;
     virtual doublereal densSpinodalGas() const;
     virtual doublereal pressureCalc(doublereal TKelvin, doublereal molarVol) const;
@@ -244,7 +266,9 @@ public:
     /*!
      *  The a and the b parameters depend on the mole fraction and the
      *  temperature. This function updates the internal numbers based on the
-     *  state of the object.
+     *  state of the object. The pair interaction terms are only reevaluated
+     *  when the temperature changes, and the mixing sums are only reevaluated
+     *  when the temperature or the composition changes.
      */
     void updateAB();
 
@@ -261,6 +285,7 @@ public:
 
     // Special functions not inherited from MixtureFugacityTP
 
+    //! Temperature derivative of the a parameter at the current conditions
     doublereal da_dt() const;
 
     void calcCriticalConditions(doublereal a, doublereal b, doublereal a0_coeff, doublereal aT_coeff,
@@ -279,6 +304,23 @@ public:
     int NicholsSolve(double TKelvin, double pres, doublereal a, doublereal b,
                      doublereal Vroot[3]) const;
 
+private:
+    //! Choose the molar volume corresponding to the requested phase from the
+    //! roots of the cubic equation of state
+    /*!
+     * @param nSolns         Return value of NicholsSolve()
+     * @param Vroot          Roots found by NicholsSolve()
+     * @param TKelvin        Temperature (K)
+     * @param tcrit          Critical temperature of the mixture (K)
+     * @param phaseRequested Phase to return the molar volume for
+     * @param volguess       Guess for the molar volume, used to pick a root
+     *     when the phase is not specified
+     * @returns the molar volume, or -1.0 or -2.0 if no suitable root was found
+     */
+    doublereal selectRoot(int nSolns, const doublereal Vroot[3],
+                          doublereal TKelvin, doublereal tcrit,
+                          int phaseRequested, doublereal volguess) const;
+
 protected:
     //! boolean indicating whether standard mixing rules are applied
     /*!
@@ -306,6 +348,12 @@ protected:
      */
     doublereal m_a_current;
 
+    //! Value of the temperature derivative of a in the equation of state
+    /*!
+     *  Evaluated along with #m_a_current by updateAB().
+     */
+    doublereal m_dadT_current;
+
     vector_fp a_vec_Curr_;
     vector_fp b_vec_Curr_;
 
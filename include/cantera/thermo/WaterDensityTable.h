@@ -0,0 +1,145 @@
+/**
+ * @file WaterDensityTable.h
+ * Headers for a tabulated representation of the density of water as a
+ * function of temperature and pressure, based on the IAPWS 1995 Formulation
+ * (See class \link Cantera::WaterDensityTable WaterDensityTable\endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_WATERDENSITYTABLE_H
+#define CT_WATERDENSITYTABLE_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+//! Bicubic table of the density of water as a function of (T, ln P)
+/*!
+ * The IAPWS 1995 equation of state is explicit in temperature and density,
+ * so all properties follow in closed form once the density is known. The
+ * expensive step in evaluating a (T, P) state is the iterative solution for
+ * the density carried out by WaterPropsIAPWS::density(). This class stores
+ * the density, its first derivatives and the mixed second derivative on a
+ * uniform grid in temperature and in the logarithm of the pressure, and
+ * evaluates a bicubic Hermite interpolant between the nodes. The derivatives
+ * at the nodes are obtained from the exact equation of state, so the
+ * interpolant is C1-continuous within each phase region.
+ *
+ * Saturation-line handling: each cell of the table is assigned to a single
+ * phase (liquid, gas or supercritical fluid). Cells that are crossed by the
+ * saturation curve, where the density is discontinuous, are marked as unusable
+ * and density() returns -1.0 for points within them.
+ *
+ * Error bounds: when the table is built, the interpolated density at the
+ * center of each cell is compared with the exact solution. Cells where the
+ * relative error exceeds the requested tolerance are also marked as unusable.
+ * The largest error found in the accepted cells is available from maxError().
+ * WaterPropsIAPWS::density() refines the interpolated value against the exact
+ * equation of state, so the table only needs to be accurate enough to provide
+ * a good starting point for Newton's method.
+ *
+ * A table is immutable once constructed, and may be shared between any number
+ * of WaterPropsIAPWS objects; see WaterPropsIAPWS::setDensityTable().
+ *
+ * @ingroup thermoprops
+ */
+class WaterDensityTable
+{
+public:
+    //! Build the table
+    /*!
+     * @param Tmin   Lowest temperature in the table (kelvin)
+     * @param Tmax   Highest temperature in the table (kelvin)
+     * @param Pmin   Lowest pressure in the table (Pascal)
+     * @param Pmax   Highest pressure in the table (Pascal)
+     * @param nT     Number of temperature nodes
+     * @param nP     Number of pressure nodes
+     * @param rtol   Maximum relative error in the density allowed at the
+     *     center of a cell for the cell to be used.
+     */
+    WaterDensityTable(doublereal Tmin = 273.16, doublereal Tmax = 1273.15,
+                      doublereal Pmin = 1.0E3, doublereal Pmax = 1.0E8,
+                      size_t nT = 201, size_t nP = 101,
+                      doublereal rtol = 1.0E-6);
+
+    //! Interpolated density of water (kg m-3)
+    /*!
+     * @param temperature  Kelvin
+     * @param pressure     Pressure in Pascals (Newton/m**2)
+     * @param phase        Requested phase of water: WATER_LIQUID, WATER_GAS,
+     *     WATER_SUPERCRIT or -1 for no preference. A point in a liquid cell is
+     *     not returned if the gas phase is requested, and vice versa.
+     * @returns the density. If the point is outside of the table, in a cell
+     *     crossing the saturation curve, in a cell where the error bound isn't
+     *     met, or in the wrong phase, -1.0 is returned.
+     */
+    doublereal density(doublereal temperature, doublereal pressure,
+                       int phase = -1) const;
+
+    //! Number of cells in the table
+    size_t nCells() const {
+        return m_cellPhase.size();
+    }
+
+    //! Number of cells that can be used for interpolation
+    size_t nValidCells() const;
+
+    //! Largest relative error in the density found at the cell centers of the
+    //! usable cells when the table was built
+    doublereal maxError() const {
+        return m_maxError;
+    }
+
+private:
+    //! Evaluate the interpolant in cell (i, j)
+    /*!
+     * @param i  Temperature index of the lower left node of the cell
+     * @param j  Pressure index of the lower left node of the cell
+     * @param s  Scaled temperature within the cell, 0 <= s <= 1
+     * @param t  Scaled log of the pressure within the cell, 0 <= t <= 1
+     */
+    doublereal interp(size_t i, size_t j, doublereal s, doublereal t) const;
+
+    //! Number of temperature nodes
+    size_t m_nT;
+
+    //! Number of pressure nodes
+    size_t m_nP;
+
+    //! Lowest temperature in the table
+    doublereal m_Tmin;
+
+    //! Temperature spacing
+    doublereal m_dT;
+
+    //! Log of the lowest pressure in the table
+    doublereal m_lnPmin;
+
+    //! Spacing in the log of the pressure
+    doublereal m_dlnP;
+
+    //! Density at each node. Node (i, j) is stored at `i*m_nP + j`.
+    vector_fp m_rho;
+
+    //! Derivative of the density wrt temperature at constant pressure
+    vector_fp m_rho_T;
+
+    //! Derivative of the density wrt ln(P) at constant temperature
+    vector_fp m_rho_lnP;
+
+    //! Mixed second derivative of the density wrt temperature and ln(P)
+    vector_fp m_rho_TlnP;
+
+    //! Phase of each cell (WATER_LIQUID, WATER_GAS or WATER_SUPERCRIT), or -1
+    //! if the cell can't be used. Cell (i, j) is stored at `i*(m_nP-1) + j`.
+    std::vector<int> m_cellPhase;
+
+    //! Largest relative error found in the usable cells
+    doublereal m_maxError;
+};
+
+}
+#endif
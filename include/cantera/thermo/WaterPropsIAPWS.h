@@ -13,6 +13,7 @@
 #define WATERPROPSIAPWS_H
 
 #include "WaterPropsIAPWSphi.h"
+#include "WaterDensityTable.h"
 
 namespace Cantera
 {
@@ -237,6 +238,32 @@ public:
     doublereal density(doublereal temperature, doublereal pressure,
                        int phase = -1, doublereal rhoguess = -1.0);
 
+    //! Use a precomputed table to speed up the calculation of the density
+    /*!
+     * If a table is set, density() first looks up the (T, P) point in the
+     * table. If the point is covered by a usable cell of the matching phase,
+     * the interpolated density is refined with a few undamped Newton
+     * iterations on the exact equation of state, instead of the damped
+     * iteration in WaterPropsIAPWSphi::dfind(). Otherwise, density() falls
+     * back to the exact method. The result is the same as without the table,
+     * to within the convergence tolerance of the iteration.
+     *
+     * When no phase is specified, the phase in the table is selected by
+     * comparing the density guess with the critical density. As without the
+     * table, the gas phase is assumed if no density guess is given either.
+     *
+     * @param table  Table to use, which may be shared with other objects.
+     *     An empty pointer removes the table.
+     */
+    void setDensityTable(shared_ptr<WaterDensityTable> table) {
+        m_densTable = table;
+    }
+
+    //! Table used by density(), if any
+    shared_ptr<WaterDensityTable> densityTable() const {
+        return m_densTable;
+    }
+
     //! Calculates the density given the temperature and the pressure,
     //! and a guess at the density, while not changing the internal state
     /*!
@@ -436,6 +463,10 @@ private:
 
     //! Current state of the system
     mutable int iState;
+
+    //! Optional table used to find the density from the temperature and
+    //! pressure. See setDensityTable().
+    shared_ptr<WaterDensityTable> m_densTable;
 };
 
 }
@@ -116,6 +116,21 @@ public:
      */
     doublereal dfind(doublereal p_red, doublereal tau, doublereal deltaGuess);
 
+    //! Refine an accurate estimate of the reduced density
+    /*!
+     * Carries out a few undamped Newton iterations, starting from a guess that
+     * is already close to the solution, e.g. from a WaterDensityTable. Unlike
+     * dfind(), no attempt is made to recover from a poor initial guess.
+     *
+     * @param p_red       Value of the dimensionless pressure
+     * @param tau         Dimensionless temperature = T_c/T
+     * @param deltaGuess  Initial guess for the dimensionless density
+     *
+     * @returns the dimensionless density, or 0.0 if the iteration didn't
+     *     converge.
+     */
+    doublereal dpolish(doublereal p_red, doublereal tau, doublereal deltaGuess);
+
     //! Calculate the dimensionless Gibbs free energy
     doublereal gibbs_RT() const;
 
@@ -229,6 +229,12 @@ public:
     virtual void initThermoXML(XML_Node& phaseNode, const std::string& id);
     virtual void setParametersFromXML(const XML_Node& eosdata);
 
+    //! Use a precomputed table to find the density from the temperature and
+    //! pressure. See WaterPropsIAPWS::setDensityTable().
+    void setDensityTable(shared_ptr<WaterDensityTable> table) {
+        m_sub.setDensityTable(table);
+    }
+
     //! Get a pointer to a changeable WaterPropsIAPWS object
     WaterPropsIAPWS* getWater() {
         return &m_sub;
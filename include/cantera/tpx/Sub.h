@@ -4,6 +4,8 @@
 
 #include "cantera/base/ctexceptions.h"
 #include <algorithm>
+#include <iosfwd>
+#include <vector>
 
 namespace tpx
 {
@@ -194,6 +196,40 @@ public:
     int TwoPhase();
     //! @}
 
+    //! @name Saturation Table
+    //!
+    //! Evaluating the saturation state at a new temperature requires an
+    //! iterative solution for the saturation pressure, with a nested
+    //! iteration for the liquid and vapor densities at each step, and
+    //! Tsat() adds another iteration around that. A table of the saturation
+    //! pressure and densities, generated once per substance, provides
+    //! starting values close enough to the solution that these iterations
+    //! converge in one or two steps. Results are unchanged to within the
+    //! convergence tolerances of the iterations.
+    //! @{
+
+    //! Tabulate the saturation curve at *n* temperatures between Tmin() and
+    //! Tcrit(). The temperatures are clustered near the critical point,
+    //! where the saturated densities change most rapidly.
+    void buildSatTable(size_t n = 200);
+
+    //! Write the saturation table to a stream, so that it can be reloaded
+    //! with readSatTable() instead of being regenerated
+    void writeSatTable(std::ostream& s) const;
+
+    //! Read a saturation table written by writeSatTable(). The table must
+    //! have been generated for a substance with the same name.
+    void readSatTable(std::istream& s);
+
+    //! Remove the saturation table, if any
+    void clearSatTable();
+
+    //! Number of points in the saturation table
+    size_t nSatTable() const {
+        return m_satT.size();
+    }
+    //! @}
+
     virtual double Pp()=0;
 
     //! Enthaply of a single-phase state
@@ -251,6 +287,27 @@ protected:
     //! Update saturated liquid and vapor densities and saturation pressure
     void update_sat();
 
+    //! Estimate the saturation pressure and the saturated liquid and vapor
+    //! densities at temperature *t* from the saturation table. Returns false
+    //! if *t* is not covered by the table.
+    bool satTableEstimate(double t, double& ps, double& rhf, double& rhv) const;
+
+    //! Estimate the saturation temperature at pressure *p* from the
+    //! saturation table. Returns a negative value if *p* is not covered.
+    double satTableTsat(double p) const;
+
+    //! Temperatures of the points in the saturation table [K]
+    std::vector<double> m_satT;
+
+    //! Log of the saturation pressure at each point in the table
+    std::vector<double> m_satLogP;
+
+    //! Saturated liquid density at each point in the table [kg/m^3]
+    std::vector<double> m_satRhf;
+
+    //! Saturated vapor density at each point in the table [kg/m^3]
+    std::vector<double> m_satRhv;
+
 private:
     void set_Rho(double r0);
     void set_T(double t0);
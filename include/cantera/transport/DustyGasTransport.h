@@ -12,7 +12,7 @@
 
 // Cantera includes
 #include "TransportBase.h"
-#include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/SquareMatrix.h"
 
 namespace Cantera
 {
@@ -110,6 +110,27 @@ public:
                                 const doublereal* const state2, const doublereal delta,
                                 doublereal* const fluxes);
 
+    //! Get the molar fluxes [kmol/m^2/s] between each of a set of pairs of
+    //! nearby points.
+    /*!
+     * This is equivalent to calling getMolarFluxes() for each pair of states
+     * in turn. When successive pairs have similar mean states, as for adjacent
+     * cells in a porous electrode model, the factorization of the H matrix is
+     * reused between them; see setCompositionTolerance().
+     *
+     * @param  npairs  Number of pairs of points
+     * @param  state1  Array of temperature, density, and mass fractions for
+     *                 the first state of each pair. Length npairs*(m_nsp+2).
+     * @param  state2  Array of temperature, density, and mass fractions for
+     *                 the second state of each pair. Length npairs*(m_nsp+2).
+     * @param  delta   Distance from state 1 to state 2 for each pair (m).
+     *                 Length npairs.
+     * @param fluxes   Species molar fluxes for each pair. Length npairs*m_nsp.
+     */
+    void getMolarFluxes(size_t npairs, const doublereal* state1,
+                        const doublereal* state2, const doublereal* delta,
+                        doublereal* fluxes);
+
     // new methods added in this class
 
     //! Set the porosity (dimensionless)
@@ -153,6 +174,21 @@ public:
      */
     void setPermeability(doublereal B);
 
+    //! Set the tolerance for reusing the factorization of the H matrix
+    /*!
+     * The LU factorization of the H matrix is kept between calls, and is
+     * reused if the temperature is unchanged, the relative change in the
+     * pressure is less than `xtol`, and no mole fraction has changed by more
+     * than `xtol` since the factorization was computed. The default value of
+     * zero reuses the factorization only for an identical state, which gives
+     * exact results. Larger values trade accuracy for speed when the fluxes
+     * are evaluated for many similar states.
+     *
+     * @param xtol  Absolute tolerance on the species mole fractions, and
+     *     relative tolerance on the pressure
+     */
+    void setCompositionTolerance(doublereal xtol);
+
     //! Return a reference to the transport manager used to compute the gas
     //! binary diffusion coefficients and the viscosity.
     /*!
@@ -214,10 +250,16 @@ private:
     //! Update the Multicomponent diffusion coefficients that are used in the
     //! approximation
     /*!
-     * This routine updates the H matrix and then inverts it.
+     * This routine computes the inverse of the H matrix from its
+     * factorization.
      */
     void updateMultiDiffCoeffs();
 
+    //! Update the LU factorization of the H matrix for the current state of
+    //! the phase, unless the existing factorization can be reused. See
+    //! setCompositionTolerance().
+    void updateHMatrix();
+
     //! Update the Knudsen diffusion coefficients
     /*!
      * The Knudsen diffusion coefficients are given by the following form
@@ -260,9 +302,32 @@ private:
     //! temperature
     doublereal m_temp;
 
-    //! Multicomponent diffusion coefficients. @see eval_H_matrix()
+    //! Multicomponent diffusion coefficients. @see updateMultiDiffCoeffs()
     DenseMatrix m_multidiff;
 
+    //! The H matrix, and its LU factorization once factored. @see
+    //! eval_H_matrix()
+    SquareMatrix m_hmatrix;
+
+    //! True if #m_hmatrix holds a valid factorization
+    bool m_hmatrix_ok;
+
+    //! True if #m_multidiff holds the inverse of the current factorization
+    bool m_multidiff_ok;
+
+    //! Temperature at which #m_hmatrix was evaluated
+    doublereal m_hmatrix_temp;
+
+    //! Pressure at which #m_hmatrix was evaluated
+    doublereal m_hmatrix_pres;
+
+    //! Mole fractions at which #m_hmatrix was evaluated
+    vector_fp m_hmatrix_x;
+
+    //! Tolerance on the mole fractions for reusing #m_hmatrix. @see
+    //! setCompositionTolerance()
+    doublereal m_xtol;
+
     //! work space of size m_nsp;
     vector_fp m_spwork;
 
@@ -109,6 +109,47 @@ public:
 
     virtual void init(thermo_t* thermo, int mode=0, int log_level=0);
 
+    //! Set the directory used to cache the polynomial fits to the collision
+    //! integrals and the species transport properties
+    /*!
+     * Generating the fits is the most expensive part of initializing a
+     * transport manager for a large mechanism. If a cache directory is set,
+     * the fitted coefficients are written to a file in this directory, named
+     * by a hash of the species transport parameters, molecular weights, heat
+     * capacities, temperature range and fitting mode. Transport managers
+     * initialized later for the same data, in this process or any other,
+     * read the coefficients from this file instead of repeating the fits.
+     *
+     * If no directory has been set, the value of the environment variable
+     * `CANTERA_TRANSPORT_CACHE` is used, if it is defined. An empty string
+     * disables the cache, which is the default.
+     */
+    static void setFitCacheDirectory(const std::string& dir);
+
+    //! The directory used to cache the transport property fits. An empty
+    //! string indicates that the cache is disabled.
+    //! @see setFitCacheDirectory()
+    static std::string fitCacheDirectory();
+
+    //! Set the number of threads used to generate the polynomial fits to the
+    //! collision integrals and the species transport properties
+    /*!
+     * The fits for each species and each species pair are independent, and
+     * are distributed over the threads in a fixed way, so the fitted
+     * coefficients do not depend on the number of threads. If the log level
+     * is greater than 0, the collision integral fits, which may write
+     * messages, are generated on the calling thread only.
+     *
+     * @param nthreads  Number of threads. The default value of 0 uses all
+     *                  of the hardware threads, while 1 generates the fits on
+     *                  the calling thread only.
+     */
+    static void setFitThreads(size_t nthreads);
+
+    //! The number of threads used to generate the transport property fits.
+    //! @see setFitThreads()
+    static size_t fitThreads();
+
 protected:
     GasTransport(ThermoPhase* thermo=0);
 
@@ -118,7 +159,8 @@ protected:
     //! Update the temperature-dependent viscosity terms.
     /**
      * Updates the array of pure species viscosities, and the weighting
-     * functions in the viscosity mixture rule. The flag m_visc_ok is set to true.
+     * functions in the viscosity mixture rule. The flag m_viscwt_ok is set to
+     * true.
      *
      * The formula for the weighting function is from Poling and Prausnitz,
      * Eq. (9-5.14):
@@ -126,9 +168,37 @@ protected:
      *      \phi_{ij} = \frac{ \left[ 1 + \left( \mu_i / \mu_j \right)^{1/2} \left( M_j / M_i \right)^{1/4} \right]^2 }
      *                    {\left[ 8 \left( 1 + M_i / M_j \right) \right]^{1/2}}
      *  \f]
+     *
+     * With \f$ a_i = \mu_i^{1/2} M_i^{-1/4} \f$, this can be written as
+     *  \f[
+     *      \phi_{ij} = c_{ij} \frac{(a_i + a_j)^2}{a_j^2}, \qquad
+     *      c_{ij} = \left[ 8 \left( 1 + M_i / M_j \right) \right]^{-1/2}
+     *  \f]
+     * where \f$ c_{ij} \f$ depends only on the molecular weights, so that
+     * the weighting functions can be updated without any square roots. They
+     * are stored in #m_phi, so that a change in composition only needs a
+     * matrix-vector product.
      */
     virtual void updateViscosity_T();
 
+    //! Evaluate the Wilke mixture rule for the viscosity without forming
+    //! the matrix of weighting functions
+    /*!
+     * This is faster than using #m_phi when the temperature is different
+     * for each evaluation.
+     *
+     * @param visc   Pure species viscosities. Length = m_nsp.
+     * @param a      Species terms \f$ a_k = \mu_k^{1/2} M_k^{-1/4} \f$.
+     *               Length = m_nsp.
+     * @param x      Mole fractions. Length = m_nsp.
+     * @param denom  Work array of length m_nsp. On return, holds the sums
+     *               \f$ \sum_j \phi_{kj} X_j \f$.
+     * @returns the viscosity of the mixture (kg /m /s)
+     * @see updateViscosity_T()
+     */
+    doublereal wilkeViscosity(const double* visc, const double* a,
+                              const double* x, double* denom) const;
+
     //! Update the pure-species viscosities. These are evaluated from the
     //! polynomial fits of the temperature and are assumed to be independent
     //! of pressure.
@@ -141,6 +211,28 @@ protected:
      */
     virtual void updateDiff_T();
 
+    //! Evaluate the polynomial fits to the binary diffusion coefficients at
+    //! unit pressure for all species pairs at a given temperature
+    /*!
+     * @param logt  Natural logarithm of the temperature
+     * @param t32   Temperature to the power 3/2
+     * @param b     Output binary diffusion coefficients, for each species
+     *              pair numbered as for #m_diffcoeffs. Length nsp*(nsp+1)/2.
+     */
+    void evalBinaryDiffFits(double logt, double t32, double* b) const;
+
+    //! Evaluate the sums of `w[j] / D_kj` over the species j != k for each
+    //! species k, where D_kj is the binary diffusion coefficient at unit
+    //! pressure.
+    /*!
+     * @param binv Reciprocals of the binary diffusion coefficients at unit
+     *             pressure, stored as for #m_bdiff_inv.
+     * @param w    Weights for each species. Length = m_nsp.
+     * @param sum  Output sums for each species. Length = m_nsp.
+     */
+    void sumInvBinaryDiff(const double* binv, const double* w,
+                          double* sum) const;
+
     //! @name Initialization
     //! @{
 
@@ -204,6 +296,31 @@ protected:
      */
     void fitProperties(MMCollisionInt& integrals);
 
+    //! Compute the key identifying the fits for the current species data in
+    //! the fit cache
+    /*!
+     * The key is a hash of all of the inputs to fitCollisionIntegrals() and
+     * fitProperties(). Like fitProperties(), this sets the temperature of the
+     * phase, to evaluate the species heat capacities.
+     */
+    std::string fitCacheKey();
+
+    //! Write the fitted coefficients to a stream
+    /*!
+     * @param s    Output stream
+     * @param key  Key identifying the fits, from fitCacheKey()
+     */
+    void writeFits(std::ostream& s, const std::string& key) const;
+
+    //! Read fitted coefficients previously written by writeFits()
+    /*!
+     * @param s    Input stream
+     * @param key  Key identifying the fits, from fitCacheKey()
+     * @returns true if the stream contained a complete set of fits for `key`.
+     *     Otherwise, the fits are left unchanged.
+     */
+    bool readFits(std::istream& s, const std::string& key);
+
     //! Second-order correction to the binary diffusion coefficients
     /*!
      * Calculate second-order corrections to binary diffusion coefficient pair
@@ -273,20 +390,16 @@ protected:
     //! Local copy of the species molecular weights.
     vector_fp m_mw;
 
-    //! Holds square roots of molecular weight ratios
-    /*!
-     *  @code
-     *  m_wratjk(j,k)  = sqrt(mw[j]/mw[k])        j < k
-     *  m_wratjk(k,j)  = sqrt(sqrt(mw[j]/mw[k]))  j < k
-     *  @endcode
-     */
-    DenseMatrix m_wratjk;
+    //! Molecular weight factors in the Wilke mixture rule for the viscosity,
+    //! `m_wilke_c(k,j) = 1/sqrt(8*(1 + mw[k]/mw[j]))`. size = m_nsp * m_nsp
+    DenseMatrix m_wilke_c;
 
-    //! Holds square roots of molecular weight ratios
-    /*!
-     *  `m_wratjk1(j,k)  = sqrt(1.0 + mw[k]/mw[j])        j < k`
-     */
-    DenseMatrix m_wratkj1;
+    //! Inverse fourth roots of the species molecular weights. length = m_nsp.
+    vector_fp m_mw_m14;
+
+    //! Species terms in the Wilke mixture rule for the viscosity,
+    //! `sqrt(visc[k]) * mw[k]^(-1/4)`. length = m_nsp.
+    vector_fp m_wilke_a;
 
     //! vector of square root of species viscosities sqrt(kg /m /s). These are
     //! used in Wilke's rule to calculate the viscosity of the solution.
@@ -334,10 +447,24 @@ protected:
      */
     std::vector<vector_fp> m_diffcoeffs;
 
+    //! Polynomial fits to the binary diffusivities, in coefficient-major order
+    /*!
+     * Coefficient n of the fit for the species pair ic (numbered as for
+     * #m_diffcoeffs) is stored at `m_diffcoeffs_packed[n*npair + ic]`, where
+     * `npair = m_diffcoeffs.size()`. This lets updateDiff_T() evaluate all of
+     * the fits together.
+     */
+    vector_fp m_diffcoeffs_packed;
+
     //! Matrix of binary diffusion coefficients at the reference pressure and
     //! the current temperature Size is nsp x nsp.
     DenseMatrix m_bdiff;
 
+    //! Reciprocals of the binary diffusion coefficients at the reference
+    //! pressure and the current temperature, for each species pair numbered as
+    //! for #m_diffcoeffs. Length is nsp*(nsp+1)/2.
+    vector_fp m_bdiff_inv;
+
     //! temperature fits of the heat conduction
     /*!
      *  Dimensions are number of species (nsp) polynomial order of the collision
@@ -64,9 +64,87 @@ public:
 
     virtual doublereal viscosity();
 
+    //! Evaluate the high-pressure viscosity and binary diffusion coefficients
+    //! at a set of states
+    /*!
+     * The results are the same as those obtained by setting the state of the
+     * phase to each (T, P, X) in turn and calling viscosity() and
+     * getBinaryDiffCoeffs(), but the mixing rules are evaluated directly from
+     * the given states, without updating the phase. The phase is only used if
+     * the viscosity is needed at a state where the Lucas model requires the
+     * saturation pressure of the mixture (reduced temperature <= 1). In that
+     * case, its state is set temporarily and restored afterwards.
+     *
+     * @param npts  Number of states
+     * @param T     Temperatures [K]. Length = npts.
+     * @param P     Pressures [Pa]. Length = npts.
+     * @param X     Normalized mole fractions. The mole fractions for point j
+     *              start at `X[j*ldx]`.
+     * @param ldx   Leading dimension of `X`. Must be at least m_nsp.
+     * @param[out] visc  Mixture viscosities [kg/m/s]. Length = npts. May be
+     *              NULL if the viscosity is not needed.
+     * @param[out] d     Binary diffusion coefficients [m^2/s]. The matrix
+     *              for point j starts at `d[j*ldd*m_nsp]`, and is stored as
+     *              for getBinaryDiffCoeffs() with leading dimension `ldd`.
+     *              May be NULL if not needed.
+     * @param ldd   Leading dimension of the matrices in `d`. Must be at least
+     *              m_nsp.
+     */
+    void getHighPressureProperties(size_t npts, const double* T,
+                                   const double* P, const double* X,
+                                   size_t ldx, double* visc, double* d,
+                                   size_t ldd);
+
+    virtual void init(thermo_t* thermo, int mode=0, int log_level=0);
+
     friend class TransportFactory;
 
 protected:
+    //! Evaluate the species properties used by the corresponding states
+    //! models, which depend only on the species parameters of the phase
+    /*!
+     * The critical properties of each pure species are found using the
+     * critical property functions of the phase, which requires temporarily
+     * setting the composition of the phase to the pure species. Since these
+     * properties do not change, this is done once by init().
+     */
+    void updateSpeciesCriticalProperties();
+
+    //! Evaluate the composition-dependent terms of the Lucas mixing rules for
+    //! the viscosity
+    /*!
+     * @param x    Mole fractions. Length = m_nsp.
+     * @param mmw  Mean molecular weight of the mixture
+     */
+    void updateLucasMixing(const doublereal* x, doublereal mmw);
+
+    //! Evaluate the viscosity using the Lucas method
+    /*!
+     * The composition-dependent terms must have been evaluated for the
+     * mole fractions `x` by updateLucasMixing().
+     *
+     * @param tKelvin  Temperature [K]
+     * @param pres     Pressure [Pa]
+     * @param x        Mole fractions. Length = m_nsp.
+     * @param Pvp_mix  Saturation pressure of the mixture [Pa]. This is only
+     *                 used if the reduced temperature of the mixture,
+     *                 `tKelvin/m_Tc_mix`, is less than or equal to 1.
+     */
+    doublereal lucasViscosity(doublereal tKelvin, doublereal pres,
+                              const doublereal* x, doublereal Pvp_mix);
+
+    //! Evaluate the Takahashi correction factors for the binary diffusion
+    //! coefficients of each species pair
+    /*!
+     * @param T      Temperature [K]
+     * @param P      Pressure [Pa]
+     * @param x      Mole fractions. Length = m_nsp.
+     * @param Pcorr  Output matrix of correction factors, where `Pcorr[j*m_nsp
+     *               + i]` is the factor for the pair (i,j).
+     */
+    void evalTakahashiCorrections(doublereal T, doublereal P,
+                                  const doublereal* x, doublereal* Pcorr);
+
     virtual doublereal Tcrit_i(size_t i);
 
     virtual doublereal Pcrit_i(size_t i);
@@ -80,6 +158,76 @@ protected:
     virtual doublereal FQ_i(doublereal Q, doublereal Tr, doublereal MW);
 
     virtual doublereal setPcorr(doublereal Pr, doublereal Tr);
+
+    //! @name Species properties
+    //!
+    //! These depend only on the species parameters, and are evaluated by
+    //! updateSpeciesCriticalProperties().
+    //! @{
+
+    //! Critical temperatures of the pure species [K]
+    vector_fp m_Tcrit;
+
+    //! Critical pressures of the pure species [Pa]
+    vector_fp m_Pcrit;
+
+    //! Critical molar volumes of the pure species [m^3/kmol]
+    vector_fp m_Vcrit;
+
+    //! Critical compressibilities of the pure species
+    vector_fp m_Zcrit;
+
+    //! Polar correction terms `30.55*(0.292 - Zc)^1.72` for the Lucas
+    //! viscosity model, for species with a reduced dipole moment of at least
+    //! 0.022. Zero for nonpolar species.
+    vector_fp m_FP_polar;
+
+    //! True for species with a reduced dipole moment of at least 0.075, for
+    //! which the polar correction depends on the reduced temperature
+    std::vector<bool> m_FP_Tdep;
+
+    //! Quantum parameter `Q` of the Lucas viscosity model for He, H2 and D2.
+    //! Zero for other species.
+    vector_fp m_FQ_Q;
+
+    //! @}
+
+    //! Mole fractions of the phase, as used by viscosity() and
+    //! getBinaryDiffCoeffs()
+    vector_fp m_hp_molefracs;
+
+    //! @name Composition-dependent terms of the Lucas viscosity model
+    //!
+    //! These are evaluated by updateLucasMixing().
+    //! @{
+
+    //! Pseudo-critical temperature of the mixture [K]
+    doublereal m_Tc_mix;
+
+    //! Pseudo-critical pressure of the mixture [Pa]
+    doublereal m_Pc_mix;
+
+    //! Correction factor for the quantum terms in mixtures of species with
+    //! very different molecular weights
+    doublereal m_lucas_Afac;
+
+    //! Reduced inverse viscosity of the mixture
+    doublereal m_ksi;
+
+    //! State number of the phase composition for which the terms were
+    //! evaluated, or -1 if they are not valid for the composition of the
+    //! phase.
+    int m_lucas_state;
+
+    //! @}
+
+    //! Takahashi correction factors for the binary diffusion coefficients,
+    //! evaluated by evalTakahashiCorrections() at the state given by
+    //! #m_Pcorr_T, #m_Pcorr_P and #m_Pcorr_state.
+    vector_fp m_Pcorr;
+    doublereal m_Pcorr_T;
+    doublereal m_Pcorr_P;
+    int m_Pcorr_state;
 };
 }
 #endif
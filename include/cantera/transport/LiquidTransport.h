@@ -571,6 +571,25 @@ public:
      */
     virtual void getSpeciesFluxesExt(size_t ldf, doublereal* fluxes);
 
+    //! Tabulate the temperature-dependent species transport properties
+    /*!
+     * The species properties given by the LTPspecies objects are evaluated at
+     * `nT` equally spaced temperatures between `Tmin` and `Tmax`. The same is
+     * done for the Stefan-Maxwell interaction parameters, if the model for the
+     * species diffusivity depends only on temperature (the
+     * LTI_Pairwise_Interaction and LTI_StokesEinstein models). Within this
+     * temperature range, the properties are then found by cubic interpolation
+     * instead of by evaluating the temperature model of each species. This is
+     * useful when the properties are needed at many temperatures within a
+     * narrow range. Outside the range, the models are evaluated directly.
+     *
+     * @param Tmin  Lowest temperature in the table [K]
+     * @param Tmax  Highest temperature in the table [K]
+     * @param nT    Number of temperatures in the table, which must be at least
+     *              4. If zero, any existing table is removed.
+     */
+    void setTemperatureTable(doublereal Tmin, doublereal Tmax, size_t nT);
+
 protected:
     //! Returns true if temperature has changed, in which case flags are set to
     //! recompute transport properties.
@@ -750,6 +769,17 @@ protected:
     //! wrt T using calls to the appropriate LTPspecies subclass
     void updateDiff_T();
 
+    //! Interpolate a section of the temperature table to the current
+    //! temperature. See setTemperatureTable().
+    /*!
+     * @param offset  Position of the first value within each row of the table
+     * @param n       Number of values to interpolate
+     * @param out     Output array of length `n`
+     * @returns false if there is no table or if the temperature is outside of
+     *     it, in which case `out` is not modified.
+     */
+    bool interpTemperatureTable(size_t offset, size_t n, doublereal* out) const;
+
 private:
     //! Number of species squared
     size_t m_nsp2;
@@ -1045,6 +1075,39 @@ private:
      */
     vector_fp m_lambdaSpecies;
 
+    //! Mixture weighting factors of the species viscosities, from
+    //! LTPspecies::getMixWeight()
+    vector_fp m_viscWeight;
+
+    //! Mixture weighting factors of the species ionic conductivities
+    vector_fp m_ionCondWeight;
+
+    //! Mixture weighting factors of the species thermal conductivities
+    vector_fp m_lambdaWeight;
+
+    //! Number of temperatures in the table of species properties, or 0 if the
+    //! properties are not tabulated. See setTemperatureTable().
+    size_t m_Ttable_n;
+
+    //! Lowest temperature in the table
+    doublereal m_Ttable_Tmin;
+
+    //! Temperature spacing of the table
+    doublereal m_Ttable_dT;
+
+    //! Number of values stored for each temperature in the table
+    size_t m_Ttable_stride;
+
+    //! True if the Stefan-Maxwell interaction parameters are tabulated
+    bool m_Ttable_diff;
+
+    //! Tabulated species properties. The row for temperature `i` starts at
+    //! `i*m_Ttable_stride`, and holds the species viscosities, ionic
+    //! conductivities, thermal conductivities and hydrodynamic radii, followed
+    //! by the elements of #m_mobRatSpecies, #m_selfDiffSpecies and, if
+    //! #m_Ttable_diff is true, #m_bdiff in column-major order.
+    vector_fp m_Ttable;
+
     //! State of the mole fraction vector.
     int m_iStateMF;
 
@@ -1183,9 +1246,6 @@ private:
     //! are current wrt the concentration
     bool m_ionCond_conc_ok;
 
-    //! Flag to indicate that the mixture conductivity is current
-    bool m_cond_mix_ok;
-
     //! Boolean indicating that the top-level mixture mobility ratio is current.
     //! This is turned false for every change in T, P, or C.
     bool m_mobRat_mix_ok;
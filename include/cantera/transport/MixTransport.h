@@ -156,6 +156,36 @@ public:
                                   size_t ldx, const doublereal* const grad_X,
                                   size_t ldf, doublereal* const fluxes);
 
+    //! Evaluate the mixture-averaged transport properties at a set of states
+    /*!
+     * The results are the same as those obtained by setting the state of the
+     * phase to each (T, P, X) in turn and calling viscosity(),
+     * thermalConductivity() and getMixDiffCoeffs(). The temperature fits for
+     * the species viscosities and conductivities are evaluated for all of
+     * the points together, which is much faster than updating the transport
+     * object for each state separately. The state of the associated
+     * ThermoPhase is neither used nor modified.
+     *
+     * @param npts  Number of states
+     * @param T     Temperatures [K]. Length = npts.
+     * @param P     Pressures [Pa]. Length = npts.
+     * @param X     Normalized mole fractions. The mole fractions for point j
+     *              start at `X[j*ldx]`.
+     * @param ldx   Leading dimension of `X`. Must be at least m_nsp.
+     * @param[out] visc  Mixture viscosities [kg/m/s]. Length = npts. May be
+     *              NULL if the viscosity is not needed.
+     * @param[out] cond  Mixture thermal conductivities [W/m/K].
+     *              Length = npts. May be NULL if not needed.
+     * @param[out] d     Mixture-averaged diffusion coefficients [m^2/s], as
+     *              returned by getMixDiffCoeffs(). The coefficients for point
+     *              j start at `d[j*ldd]`. May be NULL if not needed.
+     * @param ldd   Leading dimension of `d`. Must be at least m_nsp.
+     */
+    void getMixTransportProperties(size_t npts, const double* T,
+                                   const double* P, const double* X,
+                                   size_t ldx, double* visc, double* cond,
+                                   double* d, size_t ldd);
+
     virtual void init(thermo_t* thermo, int mode=0, int log_level=0);
 
 private:
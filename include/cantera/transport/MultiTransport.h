@@ -111,6 +111,27 @@ public:
                                const doublereal* state2, doublereal delta,
                                doublereal* fluxes);
 
+    //! Select the method used to solve the Stefan-Maxwell equations in
+    //! getSpeciesFluxes() and getMassFluxes()
+    /*!
+     * By default, the Stefan-Maxwell equations are solved by LU factorization,
+     * which requires O(K^3) operations for K species. If `iterative` is true,
+     * they are instead solved by the conjugate gradient method, where each
+     * iteration requires O(K^2) operations. The mass conservation constraint
+     * is imposed by adding a rank-one term to the singular Stefan-Maxwell
+     * matrix, following Giovangigli, which makes the system symmetric positive
+     * definite. If the iterations do not converge to the requested tolerance,
+     * the direct solution is used instead.
+     *
+     * @param iterative  If true, use the iterative solver.
+     * @param rtol       Relative tolerance on the preconditioned residual,
+     *                   which is approximately the relative error in the
+     *                   diffusion velocities.
+     * @param maxiter    Maximum number of iterations per flux direction.
+     */
+    void setIterativeFluxSolver(bool iterative, doublereal rtol=1.0e-8,
+                                size_t maxiter=100);
+
     virtual void init(ThermoPhase* thermo, int mode=0, int log_level=0);
 
 protected:
@@ -155,6 +176,70 @@ protected:
     vector_fp m_a;
     vector_fp m_b;
 
+    //! @name Temperature-dependent factors of the L matrix blocks
+    //!
+    //! Each element of the off-diagonal blocks of the L matrix is the product
+    //! of the mole fractions of the two species and a factor that depends only
+    //! on temperature. These factors are evaluated by updateThermal_T(), so
+    //! that only the multiplication by the mole fractions is needed when the
+    //! composition changes. The diagonal terms of the blocks are built up from
+    //! the same factors.
+    //! @{
+
+    //! Factors for the L00,10 block
+    DenseMatrix m_L0010_T;
+
+    //! Factors for the L10,10 block
+    DenseMatrix m_L1010_T;
+
+    //! Factors for the sums in the diagonal terms of the L10,10 block
+    DenseMatrix m_L1010_Tsum;
+
+    //! Factors for the L10,01 block. Nonzero only in the columns of species
+    //! with internal modes.
+    DenseMatrix m_L1001_T;
+
+    //! Factors for the sums in the diagonal terms of the L01,01 block. Column
+    //! `i` holds the factors for species `i`.
+    DenseMatrix m_L0101_T;
+
+    //! Factors for the x_i^2 terms on the diagonal of the L01,01 block
+    vector_fp m_L0101_Tdiag;
+
+    //! @}
+
+    //! Reduced L matrix of size 2*m_nsp, obtained by eliminating the L01,01
+    //! block, which is diagonal.
+    DenseMatrix m_Lred;
+
+    //! Factored diagonal blocks of #m_Lred, used as a block-Jacobi
+    //! preconditioner by solveLMatrixGMRES()
+    SquareMatrix m_Lprec0, m_Lprec1;
+
+    //! True if #m_Lprec0 and #m_Lprec1 hold a usable factorization
+    bool m_Lprec_ok;
+
+    //! Relative tolerance on the residual of the iterative solution of the
+    //! L matrix equation
+    doublereal m_Lsoln_rtol;
+
+    //! Maximum number of iterations for the iterative solution of the L
+    //! matrix equation, before falling back to a direct solution.
+    size_t m_Lsoln_maxiter;
+
+    //! True if the Stefan-Maxwell equations are solved iteratively. See
+    //! setIterativeFluxSolver().
+    bool m_sm_iterative;
+
+    //! Relative tolerance for the iterative Stefan-Maxwell solver
+    doublereal m_sm_rtol;
+
+    //! Maximum number of iterations for the iterative Stefan-Maxwell solver
+    size_t m_sm_maxiter;
+
+    //! Work space for the iterative Stefan-Maxwell solver. Length 5*m_nsp.
+    vector_fp m_sm_work;
+
     // work space
     vector_fp m_spwork1, m_spwork2, m_spwork3;
 
@@ -184,14 +269,46 @@ protected:
     //! Evaluate the L1000 matrices
     void eval_L1000();
 
-    void eval_L0100();
-    void eval_L0001();
     void eval_L1010(const doublereal* x);
     void eval_L1001(const doublereal* x);
-    void eval_L0110();
     void eval_L0101(const doublereal* x);
     bool hasInternalModes(size_t j);
 
+    //! Evaluate the temperature-dependent factors of the L matrix blocks
+    void updateLMatrixFactors_T();
+
+    //! Solve the reduced L matrix equation `m_Lred * a = b` using GMRES with
+    //! a block-Jacobi preconditioner.
+    /*!
+     * @param a  On input, the initial guess. On output, the solution.
+     *           Length 2*m_nsp.
+     * @param b  Right-hand side. Length 2*m_nsp.
+     * @returns the number of iterations taken, or -1 if the iterations did
+     *     not converge.
+     */
+    int solveLMatrixGMRES(doublereal* a, const doublereal* b);
+
+    //! Apply the block-Jacobi preconditioner in place to `v`, of length
+    //! 2*m_nsp
+    void applyLPreconditioner(doublereal* v);
+
+    //! Solve the Stefan-Maxwell equations for one flux direction using
+    //! preconditioned conjugate gradients
+    /*!
+     * On input, #m_aa must hold the negative of the Stefan-Maxwell matrix,
+     * with elements `x_i x_j / D_ij` off the diagonal. It is not modified.
+     * The system solved is `(S + alpha y y^T) v = -d`, where `S = -m_aa`,
+     * which has the same solution as the Stefan-Maxwell equations with the
+     * constraint `sum_k y_k v_k = 0` when the elements of `d` sum to zero.
+     *
+     * @param y  Species mass fractions
+     * @param d  Gradients of the mole fractions
+     * @param v  Output unscaled diffusion velocities
+     * @returns true if the iterations converged
+     */
+    bool solveStefanMaxwellCG(const doublereal* y, const doublereal* d,
+                              doublereal* v);
+
     doublereal pressure_ig() {
         return m_thermo->molarDensity() * GasConstant * m_thermo->temperature();
     }
@@ -34,6 +34,9 @@ static std::mutex app_mutex;
 //! Mutex for controlling access to XML file storage
 static std::mutex xml_mutex;
 
+//! Mutex for access to the list of deprecation warnings
+static std::mutex warnings_mutex;
+
 static int get_modified_time(const std::string& path) {
 #ifdef _WIN32
     HANDLE hFile = CreateFile(path.c_str(), GENERIC_READ, FILE_SHARE_WRITE,
@@ -52,7 +55,8 @@ static int get_modified_time(const std::string& path) {
 #endif
 }
 
-Application::Messages::Messages()
+Application::Messages::Messages() :
+    m_redirect(0)
 {
     // install a default logwriter that writes to standard
     // output / standard error
@@ -60,7 +64,8 @@ Application::Messages::Messages()
 }
 
 Application::Messages::Messages(const Messages& r) :
-    errorMessage(r.errorMessage)
+    errorMessage(r.errorMessage),
+    m_redirect(r.m_redirect)
 {
     // install a default logwriter that writes to standard
     // output / standard error
@@ -74,6 +79,7 @@ Application::Messages& Application::Messages::operator=(const Messages& r)
     }
     errorMessage = r.errorMessage;
     logwriter.reset(new Logger(*r.logwriter));
+    m_redirect = r.m_redirect;
     return *this;
 }
 
@@ -101,14 +107,29 @@ void Application::Messages::setLogger(Logger* _logwriter)
     logwriter.reset(_logwriter);
 }
 
+Logger* Application::Messages::redirectLogger(Logger* _logwriter)
+{
+    Logger* previous = m_redirect;
+    m_redirect = _logwriter;
+    return previous;
+}
+
 void Application::Messages::writelog(const std::string& msg)
 {
-    logwriter->write(msg);
+    if (m_redirect) {
+        m_redirect->write(msg);
+    } else {
+        logwriter->write(msg);
+    }
 }
 
 void Application::Messages::writelogendl()
 {
-    logwriter->writeendl();
+    if (m_redirect) {
+        m_redirect->writeendl();
+    } else {
+        logwriter->writeendl();
+    }
 }
 
 //! Mutex for access to string messages
@@ -176,10 +197,12 @@ void Application::ApplicationDestroy()
 void Application::warn_deprecated(const std::string& method,
                                   const std::string& extra)
 {
+    std::unique_lock<std::mutex> warningsLock(warnings_mutex);
     if (m_suppress_deprecation_warnings || warnings.count(method)) {
         return;
     }
     warnings.insert(method);
+    warningsLock.unlock();
     writelog("WARNING: '" + method + "' is deprecated. " + extra);
     writelogendl();
 }
@@ -140,12 +140,29 @@ protected:
          */
         void setLogger(Logger* logwriter);
 
+        //! Temporarily pass log messages to a different logger
+        /*!
+         * While set, messages are written using `logwriter` instead of the
+         * logger installed with setLogger(). The logger is not owned by this
+         * object.
+         *
+         * @param logwriter  Pointer to a logger object, or NULL to use the
+         *     logger installed with setLogger() again
+         * @returns the logger previously set using this method, or NULL
+         * @ingroup textlogs
+         */
+        Logger* redirectLogger(Logger* logwriter);
+
     protected:
         //! Current list of error messages
         std::vector<std::string> errorMessage;
 
         //! Current pointer to the logwriter
         std::unique_ptr<Logger> logwriter;
+
+        //! Logger set with redirectLogger(), which is used instead of
+        //! #logwriter if it is not NULL
+        Logger* m_redirect;
     };
 
     //! Typedef for thread specific messages
@@ -323,6 +340,11 @@ public:
         pMessenger->setLogger(logwriter);
     }
 
+    //! @copydoc Messages::redirectLogger
+    Logger* redirectLogger(Logger* logwriter) {
+        return pMessenger->redirectLogger(logwriter);
+    }
+
     //! Delete and free memory allocated per thread in multithreaded applications
     /*!
      * Delete the memory allocated per thread by Cantera.  It should be called
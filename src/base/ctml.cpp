@@ -332,20 +332,20 @@ size_t getFloatArray(const XML_Node& node, vector_fp & v,
         vmax = fpValueCheck(readNode->attrib("max"));
     }
 
-    std::string val = readNode->value();
+    const std::string& val = readNode->value();
+    size_t start = 0;
     while (true) {
-        size_t icom = val.find(',');
+        size_t icom = val.find(',', start);
         if (icom != string::npos) {
-            string numstr = val.substr(0,icom);
-            val = val.substr(icom+1,val.size());
-            v.push_back(fpValueCheck(numstr));
+            v.push_back(fpValueCheck(val.substr(start, icom - start)));
+            start = icom + 1;
         } else {
             // This little bit of code is to allow for the possibility of a
             // comma being the last item in the value text. This was allowed in
             // previous versions of Cantera, even though it would appear to be
             // odd. So, we keep the possibility in for backwards compatibility.
-            if (!val.empty()) {
-                v.push_back(fpValueCheck(val));
+            if (start < val.size()) {
+                v.push_back(fpValueCheck(val.substr(start)));
             }
             break;
         }
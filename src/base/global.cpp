@@ -27,6 +27,11 @@ void setLogger(Logger* logwriter)
     }
 }
 
+Logger* redirectLogger(Logger* logwriter)
+{
+    return app()->redirectLogger(logwriter);
+}
+
 void writelog_direct(const std::string& msg)
 {
     app()->writelog(msg);
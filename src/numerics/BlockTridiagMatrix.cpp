@@ -0,0 +1,200 @@
+//! @file BlockTridiagMatrix.cpp
+
+#include "cantera/numerics/BlockTridiagMatrix.h"
+#include "cantera/numerics/ctlapack.h"
+#include "cantera/base/ctexceptions.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+BlockTridiagMatrix::BlockTridiagMatrix() :
+    m_n(0),
+    m_factored(false)
+{
+}
+
+BlockTridiagMatrix::BlockTridiagMatrix(const std::vector<size_t>& sizes) :
+    m_n(0),
+    m_factored(false)
+{
+    resize(sizes);
+}
+
+void BlockTridiagMatrix::resize(const std::vector<size_t>& sizes)
+{
+    size_t nb = sizes.size();
+    m_size = sizes;
+    m_start.resize(nb);
+    m_offset.resize(3*nb);
+    m_n = 0;
+    size_t ndata = 0;
+    for (size_t p = 0; p < nb; p++) {
+        m_start[p] = m_n;
+        m_n += m_size[p];
+        size_t n = m_size[p];
+        m_offset[3*p] = ndata;
+        ndata += (p > 0) ? n * m_size[p-1] : 0;
+        m_offset[3*p+1] = ndata;
+        ndata += n * n;
+        m_offset[3*p+2] = ndata;
+        ndata += (p + 1 < nb) ? n * m_size[p+1] : 0;
+    }
+    m_row_block.resize(m_n);
+    for (size_t p = 0; p < nb; p++) {
+        for (size_t i = 0; i < m_size[p]; i++) {
+            m_row_block[m_start[p] + i] = p;
+        }
+    }
+    m_data.assign(ndata, 0.0);
+    m_ipiv.resize(m_n);
+    m_factored = false;
+}
+
+void BlockTridiagMatrix::zero()
+{
+    std::fill(m_data.begin(), m_data.end(), 0.0);
+    m_factored = false;
+}
+
+doublereal* BlockTridiagMatrix::block(size_t p, size_t q)
+{
+    m_factored = false;
+    if (q + 1 < p || q > p + 1 || q >= nBlocks()) {
+        throw CanteraError("BlockTridiagMatrix::block",
+            "Block ({}, {}) is outside the block-tridiagonal structure", p, q);
+    }
+    return &m_data[m_offset[3*p + 1 + q - p]];
+}
+
+size_t BlockTridiagMatrix::locate(size_t i, size_t j) const
+{
+    size_t p = m_row_block[i];
+    size_t q = m_row_block[j];
+    if (q + 1 < p || q > p + 1) {
+        return npos;
+    }
+    return m_offset[3*p + 1 + q - p] + (j - m_start[q]) * m_size[p]
+           + i - m_start[p];
+}
+
+doublereal& BlockTridiagMatrix::operator()(size_t i, size_t j)
+{
+    m_factored = false;
+    size_t k = locate(i, j);
+    if (k == npos) {
+        throw CanteraError("BlockTridiagMatrix::operator()",
+            "Element ({}, {}) is outside the block-tridiagonal structure",
+            i, j);
+    }
+    return m_data[k];
+}
+
+doublereal BlockTridiagMatrix::operator()(size_t i, size_t j) const
+{
+    size_t k = locate(i, j);
+    return (k == npos) ? 0.0 : m_data[k];
+}
+
+void BlockTridiagMatrix::mult(const doublereal* b, doublereal* prod) const
+{
+    size_t nb = nBlocks();
+    for (size_t p = 0; p < nb; p++) {
+        size_t n = m_size[p];
+        if (n == 0) {
+            continue;
+        }
+        doublereal* y = prod + m_start[p];
+        std::fill(y, y + n, 0.0);
+        size_t q0 = (p > 0) ? p - 1 : 0;
+        size_t q1 = std::min(p + 1, nb - 1);
+        for (size_t q = q0; q <= q1; q++) {
+            if (m_size[q]) {
+                ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose, n,
+                         m_size[q], 1.0, &m_data[m_offset[3*p + 1 + q - p]],
+                         n, b + m_start[q], 1, 1.0, y, 1);
+            }
+        }
+    }
+}
+
+int BlockTridiagMatrix::factor()
+{
+    size_t nb = nBlocks();
+    int info = 0;
+    for (size_t p = 0; p < nb; p++) {
+        size_t n = m_size[p];
+        if (n == 0) {
+            continue;
+        }
+        doublereal* D = &m_data[m_offset[3*p+1]];
+        if (p > 0 && m_size[p-1]) {
+            // Schur complement: D_p -= L_p * (D_{p-1}^-1 U_{p-1})
+            ct_dgemm(ctlapack::NoTranspose, ctlapack::NoTranspose, n, n,
+                     m_size[p-1], -1.0, &m_data[m_offset[3*p]], n,
+                     &m_data[m_offset[3*(p-1)+2]], m_size[p-1], 1.0, D, n);
+        }
+        ct_dgetrf(n, n, D, n, &m_ipiv[m_start[p]], info);
+        if (info != 0) {
+            m_factored = false;
+            return (info > 0) ? int(m_start[p]) + info : info;
+        }
+        if (p + 1 < nb && m_size[p+1]) {
+            // U_p <- D_p^-1 U_p
+            ct_dgetrs(ctlapack::NoTranspose, n, m_size[p+1], D, n,
+                      &m_ipiv[m_start[p]], &m_data[m_offset[3*p+2]], n, info);
+            if (info != 0) {
+                m_factored = false;
+                return info;
+            }
+        }
+    }
+    m_factored = true;
+    return 0;
+}
+
+int BlockTridiagMatrix::solve(doublereal* b)
+{
+    int info = 0;
+    if (!m_factored) {
+        info = factor();
+        if (info != 0) {
+            return info;
+        }
+    }
+    size_t nb = nBlocks();
+
+    // forward substitution
+    for (size_t p = 0; p < nb; p++) {
+        size_t n = m_size[p];
+        if (n == 0) {
+            continue;
+        }
+        doublereal* bp = b + m_start[p];
+        if (p > 0 && m_size[p-1]) {
+            ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose, n,
+                     m_size[p-1], -1.0, &m_data[m_offset[3*p]], n,
+                     b + m_start[p-1], 1, 1.0, bp, 1);
+        }
+        ct_dgetrs(ctlapack::NoTranspose, n, 1, &m_data[m_offset[3*p+1]], n,
+                  &m_ipiv[m_start[p]], bp, n, info);
+        if (info != 0) {
+            return info;
+        }
+    }
+
+    // back substitution
+    for (size_t p = nb - 1; p != npos; p--) {
+        size_t n = m_size[p];
+        if (n == 0 || p + 1 == nb || m_size[p+1] == 0) {
+            continue;
+        }
+        ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose, n, m_size[p+1],
+                 -1.0, &m_data[m_offset[3*p+2]], n, b + m_start[p+1], 1, 1.0,
+                 b + m_start[p], 1);
+    }
+    return 0;
+}
+
+}
@@ -0,0 +1,275 @@
+/**
+ * @file FlameSweep.cpp
+ */
+
+#include "cantera/oneD/FlameSweep.h"
+#include "cantera/oneD/Inlet1D.h"
+#include "cantera/transport/MixTransport.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/base/logger.h"
+#include "cantera/base/parallel.h"
+#include "cantera/base/xml.h"
+
+#include <mutex>
+#include <typeinfo>
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace
+{
+
+//! Make a transport manager for `gas` of the same type as `trans`
+Transport* copyTransport(Transport& trans, IdealGasPhase* gas)
+{
+    if (dynamic_cast<MixTransport*>(&trans)) {
+        Transport* tr = trans.duplMyselfAsTransport();
+        tr->setThermo(*gas);
+        return tr;
+    }
+    switch (trans.model()) {
+    case cMulticomponent:
+        return newTransportMgr("Multi", gas);
+    case CK_Multicomponent:
+        return newTransportMgr("CK_Multi", gas);
+    case cMixtureAveraged:
+        return newTransportMgr("Mix", gas);
+    case CK_MixtureAveraged:
+        return newTransportMgr("CK_Mix", gas);
+    default:
+        throw CanteraError("FlameSweep::makeInstance",
+                           "Unsupported transport model {}", trans.model());
+    }
+}
+
+}
+
+struct FlameSweep::Instance
+{
+    std::vector<std::unique_ptr<IdealGasPhase>> phases;
+    std::vector<std::unique_ptr<Kinetics>> kinetics;
+    std::vector<std::unique_ptr<Transport>> transport;
+    std::vector<std::unique_ptr<Domain1D>> domains;
+    std::unique_ptr<Sim1D> sim;
+};
+
+FlameSweep::FlameSweep(Sim1D& sim) :
+    m_sim(&sim),
+    m_nthreads(hardwareThreads())
+{
+}
+
+FlameSweep::~FlameSweep()
+{
+}
+
+void FlameSweep::setThreads(size_t nthreads)
+{
+    m_nthreads = (nthreads == 0) ? hardwareThreads() : nthreads;
+}
+
+size_t FlameSweep::addCase(const vector_fp& params)
+{
+    if (!m_params.empty() && params.size() != m_params[0].size()) {
+        throw CanteraError("FlameSweep::addCase", "Expected {} parameters, "
+            "but got {}.", m_params[0].size(), params.size());
+    }
+    m_params.push_back(params);
+    m_solutions.emplace_back();
+    m_logs.emplace_back();
+    return m_params.size() - 1;
+}
+
+const vector_fp& FlameSweep::parameters(size_t i) const
+{
+    if (i >= nCases()) {
+        throw IndexError("FlameSweep::parameters", "cases", i, nCases()-1);
+    }
+    return m_params[i];
+}
+
+bool FlameSweep::converged(size_t i) const
+{
+    if (i >= nCases()) {
+        throw IndexError("FlameSweep::converged", "cases", i, nCases()-1);
+    }
+    return m_solutions[i] != 0;
+}
+
+const std::string& FlameSweep::log(size_t i) const
+{
+    if (i >= nCases()) {
+        throw IndexError("FlameSweep::log", "cases", i, nCases()-1);
+    }
+    return m_logs[i];
+}
+
+void FlameSweep::setCase(Sim1D& sim, const vector_fp& params)
+{
+    throw NotImplementedError("FlameSweep::setCase");
+}
+
+void FlameSweep::makeInstance(Instance& inst)
+{
+    std::vector<Domain1D*> domains;
+    for (size_t n = 0; n < m_sim->nDomains(); n++) {
+        Domain1D& d = m_sim->domain(n);
+        const std::type_info& type = typeid(d);
+        Domain1D* copy;
+        if (type == typeid(AxiStagnFlow) || type == typeid(FreeFlame)) {
+            StFlow& flow = dynamic_cast<StFlow&>(d);
+            IdealGasPhase* gas = dynamic_cast<IdealGasPhase*>(
+                flow.phase().duplMyselfAsThermoPhase());
+            inst.phases.emplace_back(gas);
+            inst.kinetics.emplace_back(
+                flow.kinetics().duplMyselfAsKinetics({gas}));
+            inst.transport.emplace_back(copyTransport(flow.transport(), gas));
+
+            StFlow* f;
+            if (type == typeid(FreeFlame)) {
+                f = new FreeFlame(gas, gas->nSpecies(), d.nPoints());
+            } else {
+                f = new AxiStagnFlow(gas, gas->nSpecies(), d.nPoints());
+            }
+            copy = f;
+            f->setKinetics(*inst.kinetics.back());
+            f->setTransport(*inst.transport.back(), flow.withSoret());
+            f->enableRadiation(flow.radiationEnabled());
+            f->setBoundaryEmissivities(flow.leftEmissivity(),
+                                       flow.rightEmissivity());
+        } else if (type == typeid(Inlet1D)) {
+            Inlet1D* inlet = new Inlet1D();
+            inlet->setSpreadRate(dynamic_cast<Inlet1D&>(d).spreadRate());
+            copy = inlet;
+        } else if (type == typeid(Outlet1D)) {
+            copy = new Outlet1D();
+        } else if (type == typeid(OutletRes1D)) {
+            copy = new OutletRes1D();
+        } else if (type == typeid(Symm1D)) {
+            copy = new Symm1D();
+        } else if (type == typeid(Surf1D)) {
+            copy = new Surf1D();
+        } else if (type == typeid(Empty1D)) {
+            copy = new Empty1D();
+        } else {
+            throw CanteraError("FlameSweep::makeInstance",
+                "Copies of domain '{}' cannot be made.", d.id());
+        }
+        inst.domains.emplace_back(copy);
+        copy->setID(d.id());
+        domains.push_back(copy);
+    }
+
+    inst.sim.reset(new Sim1D(domains));
+    inst.sim->restore(m_initial->child("simulation"), 0);
+    for (size_t n = 0; n < m_sim->nDomains(); n++) {
+        Domain1D& d = m_sim->domain(n);
+        Domain1D& copy = *domains[n];
+        for (size_t i = 0; i < d.nComponents(); i++) {
+            copy.setBounds(i, d.lowerBound(i), d.upperBound(i));
+        }
+        copy.refiner().setMaxPoints(int(d.refiner().maxPoints()));
+        copy.refiner().setGridMin(d.refiner().gridMin());
+    }
+    inst.sim->copyOptions(*m_sim);
+}
+
+size_t FlameSweep::nearestSolved(size_t i) const
+{
+    size_t nparams = m_params[i].size();
+    vector_fp pmin = m_params[0];
+    vector_fp pmax = m_params[0];
+    for (size_t j = 1; j < nCases(); j++) {
+        for (size_t k = 0; k < nparams; k++) {
+            pmin[k] = std::min(pmin[k], m_params[j][k]);
+            pmax[k] = std::max(pmax[k], m_params[j][k]);
+        }
+    }
+
+    size_t nearest = npos;
+    doublereal dmin = 0.0;
+    for (size_t j = 0; j < nCases(); j++) {
+        if (!m_solutions[j]) {
+            continue;
+        }
+        doublereal dist = 0.0;
+        for (size_t k = 0; k < nparams; k++) {
+            if (pmax[k] > pmin[k]) {
+                dist += pow((m_params[i][k] - m_params[j][k]) /
+                            (pmax[k] - pmin[k]), 2);
+            }
+        }
+        if (nearest == npos || dist < dmin) {
+            nearest = j;
+            dmin = dist;
+        }
+    }
+    return nearest;
+}
+
+void FlameSweep::solve(int loglevel, bool refine_grid)
+{
+    m_initial.reset(new XML_Node("ctml"));
+    m_sim->save(*m_initial, "initial");
+    for (size_t i = 0; i < nCases(); i++) {
+        m_solutions[i].reset();
+        m_logs[i].clear();
+    }
+
+    std::mutex case_mutex; // protects m_solutions, m_logs, and next
+    size_t next = 0;
+    auto runCases = [&](size_t t) {
+        Instance inst;
+        makeInstance(inst);
+        StringLogger logger;
+        inst.sim->setLogger(&logger);
+        while (true) {
+            std::unique_lock<std::mutex> lock(case_mutex);
+            size_t i = next++;
+            if (i >= nCases()) {
+                break;
+            }
+            size_t nearest = nearestSolved(i);
+            const XML_Node& start = (nearest == npos) ? *m_initial
+                                                      : *m_solutions[nearest];
+            lock.unlock();
+
+            logger.clear();
+            std::unique_ptr<XML_Node> soln;
+            try {
+                inst.sim->restore(start.child("simulation"), 0);
+                setCase(*inst.sim, m_params[i]);
+                inst.sim->solve(loglevel, refine_grid);
+                soln.reset(new XML_Node("ctml"));
+                inst.sim->save(*soln, "case");
+            } catch (CanteraError& err) {
+                logger.write(err.what());
+                soln.reset();
+            }
+
+            lock.lock();
+            m_solutions[i] = std::move(soln);
+            m_logs[i] = logger.text();
+        }
+        if (t != 0) {
+            // free the messages stored for this thread by Application
+            thread_complete();
+        }
+    };
+    size_t nthreads = std::min(m_nthreads, nCases());
+    parallel_for(nthreads, nthreads, runCases);
+}
+
+void FlameSweep::restoreCase(size_t i)
+{
+    if (!converged(i)) {
+        throw CanteraError("FlameSweep::restoreCase",
+                           "Case {} has not been solved.", i);
+    }
+    m_sim->restore(m_solutions[i]->child("simulation"), 0);
+    setCase(*m_sim, m_params[i]);
+}
+
+}
@@ -5,6 +5,7 @@
  */
 
 #include "cantera/oneD/MultiJac.h"
+#include "cantera/base/utilities.h"
 #include <ctime>
 
 using namespace std;
@@ -30,6 +31,17 @@ MultiJac::MultiJac(OneDim& r)
     }
     m_atol = sqrt(ff);
     m_rtol = 1.0e-5;
+    m_color = false;
+    m_colored_eval = false;
+    m_analytic = false;
+    m_block = false;
+    m_block_factored = false;
+    m_max_updates = 0;
+    m_new = false;
+    m_nreuse = 0;
+    m_max_age_used = 0;
+    m_nfailures = 0;
+    m_nupdates = 0;
 }
 
 void MultiJac::updateTransient(doublereal rdt, integer* mask)
@@ -50,11 +62,181 @@ void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
     m_nevals++;
     clock_t t0 = clock();
     bfill(0.0);
+
+    // columns provided directly by the domains
+    m_fd_point.assign(m_points, true);
+    bool analytic = false;
+    if (m_analytic) {
+        for (size_t n = 0; n < m_resid->nDomains(); n++) {
+            Domain1D& d = m_resid->domain(n);
+            bool found = false;
+            for (size_t j = 0; j < d.nPoints(); j++) {
+                if (d.analyticJacobian(j)) {
+                    m_fd_point[d.firstPoint() + j] = false;
+                    found = true;
+                }
+            }
+            if (found) {
+                d.evalJacobian(x0, *this);
+                analytic = true;
+            }
+        }
+    }
+
+    // remaining columns, by finite differences. If most columns were computed
+    // directly, evaluating the others one at a time is faster than evaluating
+    // the residual at all points for each group.
+    if (m_color && !analytic) {
+        evalColored(x0, resid0);
+    } else {
+        evalColumns(x0, resid0, rdt);
+    }
+
+    for (size_t n = 0; n < m_size; n++) {
+        m_ssdiag[n] = value(n,n);
+    }
+
+    m_elapsed += double(clock() - t0)/CLOCKS_PER_SEC;
+    m_age = 0;
+    m_new = true;
+}
+
+void MultiJac::setBlockSolver(bool block)
+{
+    m_block = block;
+    m_factored = false;
+    if (block) {
+        // the banded LU factors are only needed if block factorization fails
+        vector_fp().swap(ludata);
+        std::vector<size_t> sizes(m_points);
+        for (size_t j = 0; j < m_points; j++) {
+            sizes[j] = m_resid->nVars(j);
+        }
+        m_blocks.resize(sizes);
+    } else {
+        m_blocks.resize(std::vector<size_t>());
+    }
+}
+
+int MultiJac::factor()
+{
+    m_block_factored = false;
+    m_bu.clear();
+    m_bv.clear();
+    if (!m_block) {
+        return BandMatrix::factor();
+    }
+
+    // copy the nonzero blocks for each point
+    const BandMatrix& band = *this;
+    for (size_t p = 0; p < m_points; p++) {
+        size_t n = m_blocks.blockSize(p);
+        size_t i0 = m_blocks.blockStart(p);
+        for (size_t q = (p > 0) ? p - 1 : 0; q < std::min(p + 2, m_points); q++) {
+            size_t nq = m_blocks.blockSize(q);
+            size_t j0 = m_blocks.blockStart(q);
+            doublereal* block = m_blocks.block(p, q);
+            for (size_t j = 0; j < nq; j++) {
+                for (size_t i = 0; i < n; i++) {
+                    block[i + n*j] = band.value(i0 + i, j0 + j);
+                }
+            }
+        }
+    }
+
+    int info = m_blocks.factor();
+    if (info == 0) {
+        m_block_factored = true;
+        m_factored = true;
+        return 0;
+    }
+    return BandMatrix::factor();
+}
+
+int MultiJac::solve(doublereal* b, size_t nrhs, size_t ldb)
+{
+    int info = 0;
+    if (!m_factored) {
+        info = factor();
+        if (info != 0) {
+            return info;
+        }
+    }
+    if (ldb == 0) {
+        ldb = nColumns();
+    }
+    if (!m_block_factored) {
+        info = BandMatrix::solve(b, nrhs, ldb);
+    } else {
+        for (size_t n = 0; n < nrhs; n++) {
+            info = m_blocks.solve(b + n*ldb);
+            if (info != 0) {
+                break;
+            }
+        }
+    }
+    if (info != 0) {
+        return info;
+    }
+
+    // apply the Broyden updates in the order they were made
+    for (size_t n = 0; n < nrhs; n++) {
+        doublereal* y = b + n*ldb;
+        for (size_t i = 0; i < m_bu.size(); i++) {
+            doublereal vy = dot(m_bv[i].begin(), m_bv[i].end(), y);
+            for (size_t k = 0; k < m_size; k++) {
+                y[k] += m_bu[i][k] * vy;
+            }
+        }
+    }
+    return 0;
+}
+
+bool MultiJac::broydenUpdate(const doublereal* dx, const doublereal* df,
+                             const doublereal* w)
+{
+    if (m_bu.size() >= m_max_updates) {
+        return false;
+    }
+
+    // With v = W dx and z = J^-1 df, the inverse of the updated Jacobian is
+    // J^-1 + (dx - z) v^T J^-1 / (v . z)
+    vector_fp v(dx, dx + m_size);
+    if (w) {
+        for (size_t k = 0; k < m_size; k++) {
+            v[k] *= w[k];
+        }
+    }
+    vector_fp z(df, df + m_size);
+    if (solve(z.data()) != 0) {
+        return false;
+    }
+    doublereal denom = dot(v.begin(), v.end(), z.begin());
+    doublereal vnorm = sqrt(dot(v.begin(), v.end(), v.begin()));
+    doublereal znorm = sqrt(dot(z.begin(), z.end(), z.begin()));
+    if (!(fabs(denom) > 1e-12 * vnorm * znorm)) {
+        return false;
+    }
+    for (size_t k = 0; k < m_size; k++) {
+        z[k] = (dx[k] - z[k]) / denom;
+    }
+    m_bu.push_back(z);
+    m_bv.push_back(v);
+    m_nupdates++;
+    return true;
+}
+
+void MultiJac::evalColumns(doublereal* x0, doublereal* resid0, doublereal rdt)
+{
     size_t n, m, ipt=0, j, nv, mv, iloc;
     doublereal rdx, dx, xsave;
 
     for (j = 0; j < m_points; j++) {
         nv = m_resid->nVars(j);
+        if (!m_fd_point[j]) {
+            ipt += nv;
+            continue;
+        }
         for (n = 0; n < nv; n++) {
             // perturb x(n)
             xsave = x0[ipt];
@@ -80,13 +262,73 @@ void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
             ipt++;
         }
     }
+}
 
-    for (n = 0; n < m_size; n++) {
-        m_ssdiag[n] = value(n,n);
+void MultiJac::evalColored(doublereal* x0, doublereal* resid0)
+{
+    m_xsave.resize(m_points);
+    m_rdx.resize(m_points);
+    size_t nvmax = 0;
+    for (size_t j = 0; j < m_points; j++) {
+        nvmax = std::max(nvmax, m_resid->nVars(j));
     }
 
-    m_elapsed += double(clock() - t0)/CLOCKS_PER_SEC;
-    m_age = 0;
+    // Columns for points j, j+3, j+6, ... do not share any rows, since the
+    // residual at each point depends only on the point and its neighbors
+    for (size_t color = 0; color < 3; color++) {
+        for (size_t n = 0; n < nvmax; n++) {
+            // perturb component n at each point in the group
+            bool perturbed = false;
+            for (size_t j = color; j < m_points; j += 3) {
+                if (m_fd_point[j] && n < m_resid->nVars(j)) {
+                    size_t ipt = m_resid->loc(j) + n;
+                    m_xsave[j] = x0[ipt];
+                    doublereal dx = m_atol + fabs(m_xsave[j])*m_rtol;
+                    x0[ipt] = m_xsave[j] + dx;
+                    m_rdx[j] = 1.0/(x0[ipt] - m_xsave[j]);
+                    perturbed = true;
+                }
+            }
+            if (!perturbed) {
+                continue;
+            }
+
+            // calculate the perturbed residual at all points, as a
+            // steady-state residual
+            m_colored_eval = true;
+            try {
+                m_resid->eval(npos, x0, m_r1.data(), 0.0, 0);
+            } catch (...) {
+                m_colored_eval = false;
+                for (size_t j = color; j < m_points; j += 3) {
+                    if (m_fd_point[j] && n < m_resid->nVars(j)) {
+                        x0[m_resid->loc(j) + n] = m_xsave[j];
+                    }
+                }
+                throw;
+            }
+            m_colored_eval = false;
+
+            // compute the columns of the Jacobian and restore x0
+            for (size_t j = color; j < m_points; j += 3) {
+                if (!m_fd_point[j] || n >= m_resid->nVars(j)) {
+                    continue;
+                }
+                size_t ipt = m_resid->loc(j) + n;
+                for (size_t i = j - 1; i != j+2; i++) {
+                    if (i != npos && i < m_points) {
+                        size_t mv = m_resid->nVars(i);
+                        size_t iloc = m_resid->loc(i);
+                        for (size_t m = 0; m < mv; m++) {
+                            value(m+iloc,ipt) =
+                                (m_r1[m+iloc] - resid0[m+iloc])*m_rdx[j];
+                        }
+                    }
+                }
+                x0[ipt] = m_xsave[j];
+            }
+        }
+    }
 }
 
 } // namespace
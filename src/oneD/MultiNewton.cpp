@@ -126,6 +126,26 @@ doublereal norm_square(const doublereal* x,
     return sum;
 }
 
+/**
+ * Compute the squared reciprocals of the error weights used by norm_square()
+ * for each solution component in one domain.
+ */
+void inverse_square_weights(const doublereal* x, Domain1D& r, doublereal* w)
+{
+    size_t nv = r.nComponents();
+    size_t np = r.nPoints();
+    for (size_t n = 0; n < nv; n++) {
+        doublereal esum = 0.0;
+        for (size_t j = 0; j < np; j++) {
+            esum += fabs(x[nv*j + n]);
+        }
+        doublereal ewt = r.rtol(n)*esum/np + r.atol(n);
+        for (size_t j = 0; j < np; j++) {
+            w[nv*j + n] = 1.0/(ewt*ewt);
+        }
+    }
+}
+
 } // end unnamed-namespace
 
 
@@ -148,6 +168,10 @@ void MultiNewton::resize(size_t sz)
     m_x.resize(m_n);
     m_stp.resize(m_n);
     m_stp1.resize(m_n);
+    m_resid.resize(m_n);
+    m_resid0.resize(m_n);
+    m_dx.resize(m_n);
+    m_wt.resize(m_n);
 }
 
 doublereal MultiNewton::norm2(const doublereal* x,
@@ -170,6 +194,7 @@ void MultiNewton::step(doublereal* x, doublereal* step,
     size_t iok;
     size_t sz = r.size();
     r.eval(npos, x, step);
+    copy(step, step + sz, m_resid.begin());
     for (size_t n = 0; n < sz; n++) {
         step[n] = -step[n];
     }
@@ -325,6 +350,7 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
 
         // compute the undamped Newton step
         step(&m_x[0], &m_stp[0], r, jac, loglevel-1);
+        m_resid0 = m_resid;
 
         // increment the Jacobian age
         jac.incrementAge();
@@ -346,6 +372,20 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
         // Successful step, but not converged yet. Take the damped step, and try
         // again.
         if (m == 0) {
+            if (jac.broydenUpdates()) {
+                // The last residual evaluated by dampStep is the one at x1.
+                // Measure the change to the Jacobian with the same weights
+                // as the step size in norm2().
+                for (size_t n = 0; n < m_n; n++) {
+                    m_dx[n] = x1[n] - m_x[n];
+                    m_resid[n] -= m_resid0[n];
+                }
+                for (size_t n = 0; n < r.nDomains(); n++) {
+                    inverse_square_weights(&m_x[r.start(n)], r.domain(n),
+                                           &m_wt[r.start(n)]);
+                }
+                jac.broydenUpdate(&m_dx[0], &m_resid[0], &m_wt[0]);
+            }
             copy(x1, x1 + m_n, m_x.begin());
         } else if (m == 1) {
             // convergence
@@ -355,6 +395,7 @@ int MultiNewton::solve(doublereal* x0, doublereal* x1,
             // If dampStep fails, first try a new Jacobian if an old one was
             // being used. If it was a new Jacobian, then return -1 to signify
             // failure.
+            jac.incrementFailures();
             if (jac.age() > 1) {
                 forceNewJac = true;
                 if (nJacReeval > 3) {
@@ -6,19 +6,27 @@
 
 #include <fstream>
 #include <ctime>
+#include <mutex>
+#include <numeric>
 
 using namespace std;
 
 namespace Cantera
 {
 
+//! Mutex for the static storage used by localtime() and asctime()
+static std::mutex time_mutex;
+
 OneDim::OneDim()
     : m_tmin(1.0e-16), m_tmax(10.0), m_tfactor(0.5),
       m_rdt(0.0), m_jac_ok(false),
       m_bw(0), m_size(0),
       m_init(false), m_pts(0), m_solve_time(0.0),
-      m_ss_jac_age(10), m_ts_jac_age(20),
-      m_interrupt(0), m_nevals(0), m_evaltime(0.0)
+      m_ss_jac_age(10), m_ts_jac_age(20), m_jac_coloring(false),
+      m_jac_analytic(false), m_jac_block(false), m_jac_broyden(0),
+      m_ser(false), m_ser_exponent(1.0), m_ser_factor(4.0),
+      m_interrupt(0), m_nevals(0), m_evaltime(0.0),
+      m_nsteps(0), m_nstepFailures(0), m_nstepJacs(0)
 {
     m_newt.reset(new MultiNewton(1));
 }
@@ -28,8 +36,11 @@ OneDim::OneDim(vector<Domain1D*> domains) :
     m_rdt(0.0), m_jac_ok(false),
     m_bw(0), m_size(0),
     m_init(false), m_solve_time(0.0),
-    m_ss_jac_age(10), m_ts_jac_age(20),
-    m_interrupt(0), m_nevals(0), m_evaltime(0.0)
+    m_ss_jac_age(10), m_ts_jac_age(20), m_jac_coloring(false),
+    m_jac_analytic(false), m_jac_block(false), m_jac_broyden(0),
+    m_ser(false), m_ser_exponent(1.0), m_ser_factor(4.0),
+    m_interrupt(0), m_nevals(0), m_evaltime(0.0),
+    m_nsteps(0), m_nstepFailures(0), m_nstepJacs(0)
 {
     // create a Newton iterator, and add each domain.
     m_newt.reset(new MultiNewton(1));
@@ -88,17 +99,23 @@ MultiNewton& OneDim::newton()
 void OneDim::writeStats(int printTime)
 {
     saveStats();
-    writelog("\nStatistics:\n\n Grid   Functions   Time      Jacobians   Time \n");
+    writelog("\nStatistics:\n\n Grid   Functions   Time      Jacobians   Time "
+             "      Reused  Max age  Failed  Updates   Steps  Rejected  "
+             "Step Jacs\n");
     size_t n = m_gridpts.size();
     for (size_t i = 0; i < n; i++) {
         if (printTime) {
-            writelog("{:5d}   {:5d}    {:9.4f}    {:5d}    {:9.4f}\n",
+            writelog("{:5d}   {:5d}    {:9.4f}    {:5d}    {:9.4f}",
                      m_gridpts[i], m_funcEvals[i], m_funcElapsed[i],
                      m_jacEvals[i], m_jacElapsed[i]);
         } else {
-            writelog("{:5d}   {:5d}       NA        {:5d}        NA\n",
+            writelog("{:5d}   {:5d}       NA        {:5d}        NA    ",
                      m_gridpts[i], m_funcEvals[i], m_jacEvals[i]);
         }
+        writelog("    {:5d}    {:5d}   {:5d}    {:5d}   {:5d}     {:5d}"
+                 "      {:5d}\n", m_jacReused[i], m_jacMaxAge[i],
+                 m_jacFailures[i], m_jacUpdates[i], m_timeSteps[i],
+                 m_timeStepFailures[i], m_timeStepJacs[i]);
     }
 }
 
@@ -110,10 +127,18 @@ void OneDim::saveStats()
             m_gridpts.push_back(m_pts);
             m_jacEvals.push_back(m_jac->nEvals());
             m_jacElapsed.push_back(m_jac->elapsedTime());
+            m_jacReused.push_back(m_jac->nReused());
+            m_jacMaxAge.push_back(m_jac->maxAgeUsed());
+            m_jacFailures.push_back(m_jac->nFailures());
+            m_jacUpdates.push_back(m_jac->nBroydenUpdates());
             m_funcEvals.push_back(m_nevals);
             m_nevals = 0;
             m_funcElapsed.push_back(m_evaltime);
             m_evaltime = 0.0;
+            m_timeSteps.push_back(m_nsteps);
+            m_timeStepFailures.push_back(m_nstepFailures);
+            m_timeStepJacs.push_back(m_nstepJacs);
+            m_nsteps = m_nstepFailures = m_nstepJacs = 0;
         }
     }
 }
@@ -123,10 +148,35 @@ void OneDim::clearStats()
     m_gridpts.clear();
     m_jacEvals.clear();
     m_jacElapsed.clear();
+    m_jacReused.clear();
+    m_jacMaxAge.clear();
+    m_jacFailures.clear();
+    m_jacUpdates.clear();
     m_funcEvals.clear();
     m_funcElapsed.clear();
+    m_timeSteps.clear();
+    m_timeStepFailures.clear();
+    m_timeStepJacs.clear();
     m_nevals = 0;
     m_evaltime = 0.0;
+    m_nsteps = m_nstepFailures = m_nstepJacs = 0;
+}
+
+int OneDim::nTimeSteps() const
+{
+    return accumulate(m_timeSteps.begin(), m_timeSteps.end(), m_nsteps);
+}
+
+int OneDim::nTimeStepFailures() const
+{
+    return accumulate(m_timeStepFailures.begin(), m_timeStepFailures.end(),
+                      m_nstepFailures);
+}
+
+int OneDim::nTimeStepJacobians() const
+{
+    return accumulate(m_timeStepJacs.begin(), m_timeStepJacs.end(),
+                      m_nstepJacs);
 }
 
 void OneDim::resize()
@@ -178,6 +228,10 @@ void OneDim::resize()
 
     // delete the current Jacobian evaluator and create a new one
     m_jac.reset(new MultiJac(*this));
+    m_jac->setColoring(m_jac_coloring);
+    m_jac->setAnalytic(m_jac_analytic);
+    m_jac->setBlockSolver(m_jac_block);
+    m_jac->setBroydenUpdates(m_jac_broyden);
     m_jac_ok = false;
 
     for (size_t i = 0; i < nDomains(); i++) {
@@ -185,6 +239,50 @@ void OneDim::resize()
     }
 }
 
+void OneDim::setJacobianColoring(bool color)
+{
+    m_jac_coloring = color;
+    if (m_jac) {
+        m_jac->setColoring(color);
+    }
+}
+
+void OneDim::setAnalyticJacobian(bool analytic)
+{
+    m_jac_analytic = analytic;
+    if (m_jac) {
+        m_jac->setAnalytic(analytic);
+    }
+}
+
+void OneDim::setBlockTridiagonalSolver(bool block)
+{
+    m_jac_block = block;
+    if (m_jac) {
+        m_jac->setBlockSolver(block);
+    }
+}
+
+void OneDim::setTimeStepController(bool ser, doublereal exponent,
+                                   doublereal maxFactor)
+{
+    if (exponent <= 0.0 || maxFactor <= 1.0) {
+        throw CanteraError("OneDim::setTimeStepController", "Invalid "
+            "parameters: exponent = {}, maxFactor = {}", exponent, maxFactor);
+    }
+    m_ser = ser;
+    m_ser_exponent = exponent;
+    m_ser_factor = maxFactor;
+}
+
+void OneDim::setBroydenUpdates(size_t maxUpdates)
+{
+    m_jac_broyden = maxUpdates;
+    if (m_jac) {
+        m_jac->setBroydenUpdates(maxUpdates);
+    }
+}
+
 int OneDim::solve(doublereal* x, doublereal* xnew, int loglevel)
 {
     if (!m_jac_ok) {
@@ -307,10 +405,19 @@ doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
 {
     // set the Jacobian age parameter to the transient value
     newton().setOptions(m_ts_jac_age);
+    int j0 = m_jac->nEvals();
 
     debuglog("\n\n step    size (s)    log10(ss) \n", loglevel);
     debuglog("===============================\n", loglevel);
 
+    // Weighted norm of the steady-state residual after the last step, used
+    // by the SER controller. For a backward Euler step, the residual of each
+    // transient equation is the change in the solution divided by dt.
+    doublereal rnorm = 0.0;
+    vector_fp dx;
+    if (m_ser) {
+        dx.resize(m_size);
+    }
     int n = 0;
     while (n < nsteps) {
         if (loglevel > 0) {
@@ -328,23 +435,50 @@ doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
         // the current solution in x.
         if (m >= 0) {
             n += 1;
+            m_nsteps++;
             debuglog("\n", loglevel);
-            copy(r, r + m_size, x);
-            if (m == 100) {
-                dt *= 1.5;
+            doublereal dt_old = dt;
+            doublereal f = (m == 100) ? 1.5 : 1.0;
+            if (m_ser) {
+                // switched evolution relaxation: increase the time step in
+                // proportion to the reduction of the residual
+                for (size_t i = 0; i < m_size; i++) {
+                    dx[i] = r[i] - x[i];
+                }
+                doublereal rnorm_new = newton().norm2(x, dx.data(), *this) / dt;
+                if (rnorm > 0.0) {
+                    doublereal fser = (rnorm_new > 0.0) ?
+                        pow(rnorm / rnorm_new, m_ser_exponent) : m_ser_factor;
+                    if (fser >= 1.0) {
+                        f = clip(fser, f, m_ser_factor);
+                    } else {
+                        f = std::max(fser, 1.0 / m_ser_factor);
+                    }
+                }
+                rnorm = rnorm_new;
             }
+            dt *= f;
+            copy(r, r + m_size, x);
             dt = std::min(dt, m_tmax);
+            if (m_ser && dt_old == m_tmax) {
+                // The transient term no longer limits the step, so a
+                // steady-state solution should be attempted
+                break;
+            }
         } else {
             // No solution could be found with this time step.
             // Decrease the stepsize and try again.
             debuglog("...failure.\n", loglevel);
+            m_nstepFailures++;
             dt *= m_tfactor;
             if (dt < m_tmin) {
+                m_nstepJacs += m_jac->nEvals() - j0;
                 throw CanteraError("OneDim::timeStep",
                                    "Time integration failed.");
             }
         }
     }
+    m_nstepJacs += m_jac->nEvals() - j0;
 
     // Prepare to solve the steady problem.
     setSteadyMode();
@@ -359,10 +493,6 @@ void OneDim::save(const std::string& fname, std::string id,
                   const std::string& desc, doublereal* sol,
                   int loglevel)
 {
-    time_t aclock;
-    ::time(&aclock); // Get time in seconds
-    struct tm* newtime = localtime(&aclock); // Convert time to struct tm form
-
     XML_Node root("ctml");
     ifstream fin(fname);
     if (fin) {
@@ -374,9 +504,29 @@ void OneDim::save(const std::string& fname, std::string id,
         }
         fin.close();
     }
+    save(root, id, desc, sol);
+    ofstream s(fname);
+    if (!s) {
+        throw CanteraError("OneDim::save","could not open file "+fname);
+    }
+    root.write(s);
+    s.close();
+    debuglog("Solution saved to file "+fname+" as solution "+id+".\n", loglevel);
+}
+
+XML_Node& OneDim::save(XML_Node& root, const std::string& id,
+                       const std::string& desc, doublereal* sol)
+{
+    time_t aclock;
+    ::time(&aclock); // Get time in seconds
+    std::unique_lock<std::mutex> timeLock(time_mutex);
+    struct tm* newtime = localtime(&aclock); // Convert time to struct tm form
+    string timestamp = asctime(newtime);
+    timeLock.unlock();
+
     XML_Node& sim = root.addChild("simulation");
     sim.addAttribute("id",id);
-    addString(sim,"timestamp",asctime(newtime));
+    addString(sim,"timestamp",timestamp);
     if (desc != "") {
         addString(sim,"description",desc);
     }
@@ -386,13 +536,7 @@ void OneDim::save(const std::string& fname, std::string id,
         d->save(sim, sol);
         d = d->right();
     }
-    ofstream s(fname);
-    if (!s) {
-        throw CanteraError("OneDim::save","could not open file "+fname);
-    }
-    root.write(s);
-    s.close();
-    debuglog("Solution saved to file "+fname+" as solution "+id+".\n", loglevel);
+    return sim;
 }
 
 }
@@ -4,8 +4,11 @@
 
 #include "cantera/oneD/Sim1D.h"
 #include "cantera/oneD/MultiJac.h"
+#include "cantera/oneD/MultiNewton.h"
 #include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/SolutionFile.h"
 #include "cantera/numerics/funcs.h"
+#include "cantera/numerics/Func1.h"
 #include "cantera/base/xml.h"
 
 #include <fstream>
@@ -15,8 +18,76 @@ using namespace std;
 namespace Cantera
 {
 
+namespace
+{
+
+//! Passes the log messages written by the calling thread to a given logger
+//! for as long as this object exists. See Sim1D::setLogger().
+class LogRedirect
+{
+public:
+    explicit LogRedirect(Logger* logger) : m_active(logger != 0) {
+        m_previous = m_active ? redirectLogger(logger) : 0;
+    }
+    ~LogRedirect() {
+        if (m_active) {
+            redirectLogger(m_previous);
+        }
+    }
+
+private:
+    bool m_active;
+    Logger* m_previous;
+};
+
+//! Multiplies the steady-state tolerances of all domains by a constant factor
+//! for as long as this object exists
+class ScaleTolerances
+{
+public:
+    ScaleTolerances(OneDim& sim, doublereal factor) : m_sim(sim) {
+        if (factor == 1.0) {
+            return;
+        }
+        for (size_t m = 0; m < sim.nDomains(); m++) {
+            Domain1D& d = sim.domain(m);
+            for (size_t n = 0; n < d.nComponents(); n++) {
+                m_rtol.push_back(d.steadyRtol(n));
+                m_atol.push_back(d.steadyAtol(n));
+                d.setSteadyTolerances(factor * d.steadyRtol(n),
+                                      factor * d.steadyAtol(n), n);
+            }
+        }
+    }
+    ~ScaleTolerances() {
+        if (m_rtol.empty()) {
+            return;
+        }
+        size_t i = 0;
+        for (size_t m = 0; m < m_sim.nDomains(); m++) {
+            Domain1D& d = m_sim.domain(m);
+            for (size_t n = 0; n < d.nComponents(); n++, i++) {
+                d.setSteadyTolerances(m_rtol[i], m_atol[i], n);
+            }
+        }
+    }
+
+private:
+    OneDim& m_sim;
+    vector_fp m_rtol, m_atol;
+};
+
+}
+
 Sim1D::Sim1D(vector<Domain1D*>& domains) :
-    OneDim(domains)
+    OneDim(domains),
+    m_logger(0),
+    m_coarse_levels(0),
+    m_coarse_tol_factor(1.0),
+    m_cont_param(0),
+    m_cont_callback(0),
+    m_cont_minstep(1.0e-3),
+    m_cont_maxstep(20.0)
 {
     // resize the internal solution vector and the work array, and perform
     // domain-specific initialization of the solution vector.
@@ -89,6 +160,32 @@ void Sim1D::save(const std::string& fname, const std::string& id,
     OneDim::save(fname, id, desc, m_x.data(), loglevel);
 }
 
+XML_Node& Sim1D::save(XML_Node& root, const std::string& id,
+                      const std::string& desc)
+{
+    return OneDim::save(root, id, desc, m_x.data());
+}
+
+void Sim1D::save(SolutionFile& file, const std::string& id,
+                 const std::string& desc, int loglevel)
+{
+    vector<SolutionFile::DomainData> data(nDomains());
+    for (size_t m = 0; m < nDomains(); m++) {
+        Domain1D& d = domain(m);
+        data[m].id = d.id();
+        data[m].nPoints = d.nPoints();
+        for (size_t n = 0; n < d.nComponents(); n++) {
+            data[m].components.push_back(d.componentName(n));
+        }
+        d.getAttributes(data[m].attributes);
+        data[m].grid = d.grid().data();
+        data[m].values = &m_x[d.loc()];
+    }
+    file.addSolution(id, desc, data);
+    debuglog("Solution saved to file " + file.fileName() + " as solution "
+             + id + ".\n", loglevel);
+}
+
 void Sim1D::saveResidual(const std::string& fname, const std::string& id,
                          const std::string& desc, int loglevel)
 {
@@ -114,8 +211,13 @@ void Sim1D::restore(const std::string& fname, const std::string& id,
     if (!f) {
         throw CanteraError("Sim1D::restore","No solution with id = "+id);
     }
+    restore(*f, loglevel);
+}
 
-    vector<XML_Node*> xd = f->getChildren("domain");
+void Sim1D::restore(const XML_Node& soln, int loglevel)
+{
+    LogRedirect redirect(m_logger);
+    vector<XML_Node*> xd = soln.getChildren("domain");
     if (xd.size() != nDomains()) {
         throw CanteraError("Sim1D::restore", "Solution does not contain the "
             " correct number of domains. Found {} expected {}.\n",
@@ -138,6 +240,88 @@ void Sim1D::restore(const std::string& fname, const std::string& id,
     finalize();
 }
 
+void Sim1D::restore(const SolutionFile& file, const std::string& id,
+                    int loglevel)
+{
+    LogRedirect redirect(m_logger);
+    vector<SolutionFile::DomainData> data = file.domains(id);
+    if (data.size() != nDomains()) {
+        throw CanteraError("Sim1D::restore", "Solution does not contain the "
+            " correct number of domains. Found {} expected {}.\n",
+            data.size(), nDomains());
+    }
+    for (size_t m = 0; m < nDomains(); m++) {
+        Domain1D& d = domain(m);
+        if (loglevel > 0 && data[m].id != d.id()) {
+            writelog("Warning: domain names do not match: '" + data[m].id
+                     + "' and '" + d.id() + "'\n");
+        }
+        d.setupGrid(data[m].nPoints, data[m].grid);
+        if (d.nPoints() != data[m].nPoints) {
+            throw CanteraError("Sim1D::restore", "Domain '{}' has {} points, "
+                "but the stored solution has {}.", d.id(), d.nPoints(),
+                data[m].nPoints);
+        }
+    }
+    resize();
+    m_x.resize(size());
+    m_xnew.resize(size());
+
+    for (size_t m = 0; m < nDomains(); m++) {
+        Domain1D& d = domain(m);
+        const SolutionFile::DomainData& dd = data[m];
+        size_t nv = d.nComponents();
+        size_t nstored = dd.components.size();
+        vector<string> missing;
+        vector<bool> used(nstored, false);
+        doublereal* x = &m_x[d.loc()];
+        for (size_t n = 0; n < nv; n++) {
+            string name = d.componentName(n);
+            size_t k = find(dd.components.begin(), dd.components.end(), name)
+                       - dd.components.begin();
+            if (k == nstored) {
+                missing.push_back(name);
+            } else {
+                used[k] = true;
+            }
+            for (size_t j = 0; j < d.nPoints(); j++) {
+                x[n + nv*j] = (k == nstored) ? 0.0 : dd.values[k + nstored*j];
+            }
+        }
+        if (loglevel > 0) {
+            for (const auto& name : missing) {
+                writelog("Warning: component '{}' of domain '{}' not found in "
+                         "the stored solution. Setting it to zero.\n",
+                         name, d.id());
+            }
+            for (size_t k = 0; k < nstored; k++) {
+                if (!used[k]) {
+                    writelog("Warning: ignoring stored component '{}' of "
+                             "domain '{}'.\n", dd.components[k], d.id());
+                }
+            }
+        }
+
+        d.setAttributes(dd.attributes);
+
+        // As in StFlow::restore, use the restored temperature profile for
+        // fixed-temperature simulations
+        StFlow* flow = dynamic_cast<StFlow*>(&d);
+        if (flow && find(missing.begin(), missing.end(), "T") == missing.end()) {
+            size_t np = d.nPoints();
+            vector_fp zz(np), T(np);
+            for (size_t j = 0; j < np; j++) {
+                zz[j] = (d.grid(j) - d.zmin()) / (d.zmax() - d.zmin());
+                T[j] = x[c_offset_T + nv*j];
+            }
+            flow->setFixedTempProfile(zz, T);
+        }
+    }
+    finalize();
+    debuglog("Restored solution " + id + " from file " + file.fileName()
+             + ".\n", loglevel >= 2);
+}
+
 void Sim1D::setFlatProfile(size_t dom, size_t comp, doublereal v)
 {
     size_t np = domain(dom).nPoints();
@@ -158,6 +342,7 @@ void Sim1D::showSolution(ostream& s)
 
 void Sim1D::showSolution()
 {
+    LogRedirect redirect(m_logger);
     for (size_t n = 0; n < nDomains(); n++) {
         if (domain(n).domainType() != cEmptyType) {
             writelog("\n\n>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> "+domain(n).id()
@@ -204,89 +389,154 @@ int Sim1D::newtonSolve(int loglevel)
     }
 }
 
-void Sim1D::solve(int loglevel, bool refine_grid)
+void Sim1D::solveSteady(doublereal& dt, int loglevel)
 {
-    int new_points = 1;
-    int nsteps;
-    doublereal dt = m_tstep;
-    int soln_number = -1;
-    finalize();
-
-    while (new_points > 0) {
-        size_t istep = 0;
-        nsteps = m_steps[istep];
-
-        bool ok = false;
-        if (loglevel > 0) {
-            writeline('.', 78, true, true);
-        }
-        while (!ok) {
-            debuglog("Attempt Newton solution of steady-state problem...", loglevel);
-            int status = newtonSolve(loglevel-1);
+    size_t istep = 0;
+    int nsteps = m_steps[istep];
+    bool ok = false;
+    if (loglevel > 0) {
+        writeline('.', 78, true, true);
+    }
+    while (!ok) {
+        debuglog("Attempt Newton solution of steady-state problem...", loglevel);
+        int status = newtonSolve(loglevel-1);
 
-            if (status == 0) {
-                if (loglevel > 0) {
-                    writelog("    success.\n\n");
-                    writelog("Problem solved on [");
-                    for (size_t mm = 1; mm < nDomains(); mm+=2) {
-                        writelog("{}", domain(mm).nPoints());
-                        if (mm + 2 < nDomains()) {
-                            writelog(", ");
-                        }
+        if (status == 0) {
+            if (loglevel > 0) {
+                writelog("    success.\n\n");
+                writelog("Problem solved on [");
+                for (size_t mm = 1; mm < nDomains(); mm+=2) {
+                    writelog("{}", domain(mm).nPoints());
+                    if (mm + 2 < nDomains()) {
+                        writelog(", ");
                     }
-                    writelog("] point grid(s).\n");
-                }
-                if (loglevel > 6) {
-                    save("debug_sim1d.xml", "debug",
-                         "After successful Newton solve");
                 }
-                if (loglevel > 7) {
-                    saveResidual("debug_sim1d.xml", "residual",
-                                 "After successful Newton solve");
-                }
-                ok = true;
-                soln_number++;
+                writelog("] point grid(s).\n");
+            }
+            if (loglevel > 6) {
+                save("debug_sim1d.xml", "debug",
+                     "After successful Newton solve");
+            }
+            if (loglevel > 7) {
+                saveResidual("debug_sim1d.xml", "residual",
+                             "After successful Newton solve");
+            }
+            ok = true;
+        } else {
+            debuglog("    failure. \n", loglevel);
+            if (loglevel > 6) {
+                save("debug_sim1d.xml", "debug",
+                     "After unsuccessful Newton solve");
+            }
+            if (loglevel > 7) {
+                saveResidual("debug_sim1d.xml", "residual",
+                             "After unsuccessful Newton solve");
+            }
+            if (loglevel > 0) {
+                writelog("Take {} timesteps   ", nsteps);
+            }
+            dt = timeStep(nsteps, dt, m_x.data(), m_xnew.data(),
+                          loglevel-1);
+            if (loglevel > 6) {
+                save("debug_sim1d.xml", "debug", "After timestepping");
+            }
+            if (loglevel > 7) {
+                saveResidual("debug_sim1d.xml", "residual",
+                             "After timestepping");
+            }
+
+            if (loglevel == 1) {
+                writelog(" {:10.4g} {:10.4g}\n", dt,
+                         log10(ssnorm(m_x.data(), m_xnew.data())));
+            }
+            istep++;
+            if (istep >= m_steps.size()) {
+                nsteps = m_steps.back();
             } else {
-                debuglog("    failure. \n", loglevel);
-                if (loglevel > 6) {
-                    save("debug_sim1d.xml", "debug",
-                         "After unsuccessful Newton solve");
-                }
-                if (loglevel > 7) {
-                    saveResidual("debug_sim1d.xml", "residual",
-                                 "After unsuccessful Newton solve");
-                }
-                if (loglevel > 0) {
-                    writelog("Take {} timesteps   ", nsteps);
-                }
-                dt = timeStep(nsteps, dt, m_x.data(), m_xnew.data(),
-                              loglevel-1);
-                if (loglevel > 6) {
-                    save("debug_sim1d.xml", "debug", "After timestepping");
-                }
-                if (loglevel > 7) {
-                    saveResidual("debug_sim1d.xml", "residual",
-                                 "After timestepping");
-                }
+                nsteps = m_steps[istep];
+            }
+            dt = std::min(dt, m_tmax);
+        }
+    }
+    if (loglevel > 0) {
+        writeline('.', 78, true, true);
+    }
+    if (loglevel > 2) {
+        showSolution();
+    }
+}
 
-                if (loglevel == 1) {
-                    writelog(" {:10.4g} {:10.4g}\n", dt,
-                             log10(ssnorm(m_x.data(), m_xnew.data())));
-                }
-                istep++;
-                if (istep >= m_steps.size()) {
-                    nsteps = m_steps.back();
-                } else {
-                    nsteps = m_steps[istep];
+void Sim1D::solveCoarseGrids(doublereal& dt, int loglevel)
+{
+    // Keep the initial estimate on the original grid, in case the coarse
+    // grid solution fails
+    std::vector<vector_fp> grids_save;
+    getGrids(grids_save);
+    vector_fp x_save = m_x;
+
+    std::vector<std::vector<vector_fp>> grids;
+    for (size_t level = 0; level < m_coarse_levels; level++) {
+        std::vector<vector_fp> fine, coarse;
+        getGrids(fine);
+        coarse = fine;
+        bool coarsened = false;
+        for (size_t n = 0; n < nDomains(); n++) {
+            const vector_fp& z = fine[n];
+            if (z.size() < 9) {
+                continue;
+            }
+            FreeFlame* flame = dynamic_cast<FreeFlame*>(&domain(n));
+            coarse[n].clear();
+            for (size_t j = 0; j < z.size(); j++) {
+                if (j % 2 == 0 || j + 1 == z.size()
+                    || (flame && z[j] == flame->m_zfixed)) {
+                    coarse[n].push_back(z[j]);
                 }
-                dt = std::min(dt, m_tmax);
             }
+            coarsened = true;
         }
-        if (loglevel > 0) {
-            writeline('.', 78, true, true);
+        if (!coarsened) {
+            break;
+        }
+        grids.push_back(fine);
+        regrid(coarse);
+    }
+    if (grids.empty()) {
+        return;
+    }
+
+    try {
+        ScaleTolerances scale(*this, m_coarse_tol_factor);
+        while (!grids.empty()) {
+            solveSteady(dt, loglevel);
+            regrid(grids.back());
+            grids.pop_back();
+            dt = m_tstep;
         }
-        if (loglevel > 2) {
-            showSolution();
+    } catch (CanteraError& err) {
+        debuglog("Coarse grid solution failed:\n" + err.getMessage() + "\n",
+                 loglevel);
+        setGrids(grids_save, x_save);
+        dt = m_tstep;
+    }
+}
+
+void Sim1D::solve(int loglevel, bool refine_grid)
+{
+    LogRedirect redirect(m_logger);
+    int new_points = 1;
+    doublereal dt = m_tstep;
+    finalize();
+    if (m_coarse_levels) {
+        solveCoarseGrids(dt, loglevel);
+    }
+
+    // Intermediate grids are solved with relaxed tolerances when refining
+    bool relaxed = refine_grid && m_coarse_tol_factor != 1.0;
+    while (new_points > 0) {
+        {
+            ScaleTolerances scale(*this, relaxed ? m_coarse_tol_factor : 1.0);
+            solveSteady(dt, loglevel);
         }
 
         if (refine_grid) {
@@ -307,6 +557,13 @@ void Sim1D::solve(int loglevel, bool refine_grid)
                 writelog("Maximum number of grid points reached.");
                 new_points = 0;
             }
+            if (new_points == 0 && relaxed) {
+                // Solve the final grid with the requested tolerances, and
+                // refine it further if the new solution requires it
+                debuglog("Solving with the original tolerances.\n", loglevel);
+                relaxed = false;
+                new_points = 1;
+            }
         } else {
             debuglog("grid refinement disabled.\n", loglevel);
             new_points = 0;
@@ -316,6 +573,7 @@ void Sim1D::solve(int loglevel, bool refine_grid)
 
 int Sim1D::refine(int loglevel)
 {
+    LogRedirect redirect(m_logger);
     int ianalyze, np = 0;
     vector_fp znew, xnew;
     doublereal xmid, zmid;
@@ -539,4 +797,544 @@ void Sim1D::evalSSJacobian()
 {
     OneDim::evalSSJacobian(m_x.data(), m_xnew.data());
 }
+
+void Sim1D::copyOptions(const Sim1D& other)
+{
+    m_tstep = other.m_tstep;
+    m_steps = other.m_steps;
+    m_tmin = other.m_tmin;
+    m_tmax = other.m_tmax;
+    m_tfactor = other.m_tfactor;
+    setJacAge(other.m_ss_jac_age, other.m_ts_jac_age);
+    setJacobianColoring(other.m_jac_coloring);
+    setAnalyticJacobian(other.m_jac_analytic);
+    setBlockTridiagonalSolver(other.m_jac_block);
+    setBroydenUpdates(other.m_jac_broyden);
+    m_cont_minstep = other.m_cont_minstep;
+    m_cont_maxstep = other.m_cont_maxstep;
+    setTimeStepController(other.m_ser, other.m_ser_exponent,
+                          other.m_ser_factor);
+    m_coarse_levels = other.m_coarse_levels;
+    m_coarse_tol_factor = other.m_coarse_tol_factor;
+}
+
+void Sim1D::setCoarseGridSolve(size_t levels, doublereal tol_factor)
+{
+    if (tol_factor < 1.0) {
+        throw CanteraError("Sim1D::setCoarseGridSolve",
+            "Tolerance factor must be at least 1.0, but got {}.", tol_factor);
+    }
+    m_coarse_levels = levels;
+    m_coarse_tol_factor = tol_factor;
+}
+
+void Sim1D::setContinuationStepLimits(doublereal minRatio, doublereal maxRatio)
+{
+    if (minRatio <= 0.0 || minRatio > 1.0 || maxRatio < 1.0) {
+        throw CanteraError("Sim1D::setContinuationStepLimits",
+            "Invalid step size limits: {}, {}", minRatio, maxRatio);
+    }
+    m_cont_minstep = minRatio;
+    m_cont_maxstep = maxRatio;
+}
+
+void Sim1D::setParameter(doublereal p)
+{
+    if (!m_cont_param) {
+        throw CanteraError("Sim1D::setParameter",
+                           "No continuation parameter has been set.");
+    }
+    m_cont_param->eval(p);
+}
+
+bool Sim1D::continuationStopped(doublereal p)
+{
+    return m_cont_callback && m_cont_callback->eval(p) < 0.0;
+}
+
+bool Sim1D::continuationSolve(int loglevel, bool refine_grid)
+{
+    try {
+        finalize();
+        while (true) {
+            if (newtonSolve(loglevel) != 0) {
+                return false;
+            }
+            if (!refine_grid || refine(loglevel) <= 0) {
+                return true;
+            }
+        }
+    } catch (CanteraError& err) {
+        debuglog(err.getMessage() + "\n", loglevel);
+        return false;
+    }
+}
+
+void Sim1D::getGrids(std::vector<vector_fp>& grids) const
+{
+    grids.resize(nDomains());
+    for (size_t n = 0; n < nDomains(); n++) {
+        grids[n] = domain(n).grid();
+    }
+}
+
+void Sim1D::setGrids(const std::vector<vector_fp>& grids, const vector_fp& x)
+{
+    for (size_t n = 0; n < nDomains(); n++) {
+        domain(n).setupGrid(grids[n].size(), grids[n].data());
+    }
+    m_x = x;
+    m_xnew.resize(x.size());
+    resize();
+    finalize();
+}
+
+void Sim1D::regrid(const std::vector<vector_fp>& grids)
+{
+    std::vector<vector_fp> old_grids;
+    getGrids(old_grids);
+    vector_fp x_old = m_x;
+    for (size_t n = 0; n < nDomains(); n++) {
+        domain(n).setupGrid(grids[n].size(), grids[n].data());
+    }
+    resize();
+    interpolate(old_grids, x_old, m_x);
+    m_xnew.resize(m_x.size());
+    finalize();
+}
+
+void Sim1D::interpolate(const std::vector<vector_fp>& grids,
+                        const vector_fp& v, vector_fp& out) const
+{
+    out.resize(size());
+    size_t loc = 0;
+    vector_fp values;
+    for (size_t n = 0; n < nDomains(); n++) {
+        const Domain1D& d = domain(n);
+        size_t nv = d.nComponents();
+        size_t np = grids[n].size();
+        if (d.grid() == grids[n]) {
+            copy(v.begin() + loc, v.begin() + loc + nv*np,
+                 out.begin() + d.loc());
+        } else {
+            values.resize(np);
+            for (size_t i = 0; i < nv; i++) {
+                for (size_t j = 0; j < np; j++) {
+                    values[j] = v[loc + nv*j + i];
+                }
+                for (size_t j = 0; j < d.nPoints(); j++) {
+                    out[d.loc() + nv*j + i] = linearInterp(d.grid()[j],
+                                                           grids[n], values);
+                }
+            }
+        }
+        loc += nv*np;
+    }
+}
+
+void Sim1D::applyBounds(doublereal* x) const
+{
+    for (size_t n = 0; n < nDomains(); n++) {
+        const Domain1D& d = domain(n);
+        size_t nv = d.nComponents();
+        for (size_t i = 0; i < nv; i++) {
+            for (size_t j = 0; j < d.nPoints(); j++) {
+                doublereal& xx = x[d.loc() + nv*j + i];
+                xx = clip(xx, d.lowerBound(i), d.upperBound(i));
+            }
+        }
+    }
+}
+
+void Sim1D::continuationWeights(vector_fp& w)
+{
+    w.resize(size());
+    for (size_t n = 0; n < nDomains(); n++) {
+        Domain1D& d = domain(n);
+        size_t nv = d.nComponents();
+        for (size_t i = 0; i < nv; i++) {
+            doublereal xmax = 0.0;
+            for (size_t j = 0; j < d.nPoints(); j++) {
+                xmax = std::max(xmax, fabs(m_x[d.loc() + nv*j + i]));
+            }
+            doublereal wi = 1.0 / (xmax + d.atol(i));
+            for (size_t j = 0; j < d.nPoints(); j++) {
+                w[d.loc() + nv*j + i] = wi;
+            }
+        }
+    }
+}
+
+doublereal Sim1D::arclengthDot(const vector_fp& x, doublereal xp,
+                               const vector_fp& y, doublereal yp,
+                               const vector_fp& w, doublereal wp) const
+{
+    doublereal sum = 0.0;
+    for (size_t i = 0; i < x.size(); i++) {
+        sum += x[i] * y[i] * w[i] * w[i];
+    }
+    return sum / x.size() + xp * yp * wp * wp;
+}
+
+int Sim1D::arclengthStep(vector_fp& x, doublereal& p, doublereal p0,
+                         const vector_fp& t, doublereal tp, doublereal ds,
+                         const vector_fp& w, doublereal wp, int loglevel)
+{
+    size_t n = size();
+    vector_fp r(n), fp(n), r0(n), fp0(n), b(n), dx(n), x1(n), dx1(n);
+    vector_fp x_pred(n), work(n);
+
+    // Evaluate the residual r and its derivative fp with respect to the
+    // parameter at (xx, pp)
+    auto residuals = [&](vector_fp& xx, doublereal pp) {
+        doublereal h = 1.0e-7 * (fabs(pp) + 1.0 / wp);
+        setParameter(pp + h);
+        OneDim::eval(npos, xx.data(), fp.data(), 0.0);
+        setParameter(pp);
+        OneDim::eval(npos, xx.data(), r.data(), 0.0);
+        for (size_t i = 0; i < n; i++) {
+            fp[i] = (fp[i] - r[i]) / h;
+        }
+    };
+
+    // Compute the undamped correction (dxx, dpp) at (xx, pp) from the
+    // residuals, using the current Jacobian. With J*a = -r and J*b = -fp,
+    // the correction is dxx = a + dpp*b, where dpp satisfies the linearized
+    // arclength condition.
+    auto correction = [&](vector_fp& xx, doublereal pp, vector_fp& dxx,
+                          doublereal& dpp) {
+        for (size_t i = 0; i < n; i++) {
+            dxx[i] = -r[i];
+            b[i] = -fp[i];
+        }
+        if (m_jac->solve(dxx.data()) || m_jac->solve(b.data())) {
+            debuglog("Arclength continuation: singular Jacobian\n", loglevel);
+            return false;
+        }
+        for (size_t i = 0; i < n; i++) {
+            work[i] = xx[i] - m_x[i];
+        }
+        doublereal N = arclengthDot(t, tp, work, pp - p0, w, wp) - ds;
+        doublereal denom = arclengthDot(t, tp, b, 1.0, w, wp);
+        if (denom == 0.0) {
+            return false;
+        }
+        dpp = -(N + arclengthDot(t, 0.0, dxx, 0.0, w, wp)) / denom;
+        for (size_t i = 0; i < n; i++) {
+            dxx[i] += dpp * b[i];
+        }
+        return true;
+    };
+
+    // predictor
+    for (size_t i = 0; i < n; i++) {
+        x_pred[i] = m_x[i] + ds * t[i];
+    }
+    applyBounds(x_pred.data());
+    x = x_pred;
+    doublereal p_pred = p0 + ds * tp;
+    p = p_pred;
+
+    // Damped Newton iterations on the augmented system, following the same
+    // strategy as MultiNewton. The Jacobian is re-evaluated if no acceptable
+    // damped step can be found, or if the iterations converge slowly.
+    bool new_jac = true;
+    doublereal dp, p1, dp1;
+    residuals(x, p);
+    for (int iter = 0; iter < 20; iter++) {
+        if (new_jac) {
+            OneDim::evalSSJacobian(x.data(), work.data());
+        }
+        if (!correction(x, p, dx, dp)) {
+            break;
+        }
+        doublereal s0 = newton().norm2(x.data(), dx.data(), *this);
+        doublereal fbound = newton().boundStep(x.data(), dx.data(), *this,
+                                               loglevel-1);
+        if (fbound < 1.0e-10) {
+            debuglog("Arclength continuation: at limits\n", loglevel);
+            break;
+        }
+
+        r0 = r;
+        fp0 = fp;
+        doublereal damp = 1.0, s1 = BigNumber;
+        bool ok = false;
+        for (size_t m = 0; m < 7; m++) {
+            doublereal ff = fbound * damp;
+            for (size_t i = 0; i < n; i++) {
+                x1[i] = x[i] + ff * dx[i];
+            }
+            p1 = p + ff * dp;
+            residuals(x1, p1);
+            if (!correction(x1, p1, dx1, dp1)) {
+                break;
+            }
+            s1 = newton().norm2(x1.data(), dx1.data(), *this);
+            if (s1 < 1.0 || s1 < s0) {
+                ok = true;
+                break;
+            }
+            damp /= sqrt(2.0);
+        }
+        if (loglevel > 0) {
+            writelog("    corrector {}: p = {:12.6g}  log10(s0) = {:8.4f}  "
+                     "log10(s1) = {:8.4f}  F_damp = {:8.4g}\n", iter, p1,
+                     log10(s0 + SmallNumber), log10(s1 + SmallNumber),
+                     ok ? fbound * damp : 0.0);
+        }
+        if (!ok) {
+            r.swap(r0);
+            fp.swap(fp0);
+            if (new_jac) {
+                break;
+            }
+            new_jac = true;
+            continue;
+        }
+
+        if (m_jac->broydenUpdates()) {
+            // Update the Jacobian using the change in the residual due to the
+            // change in the solution vector alone
+            for (size_t i = 0; i < n; i++) {
+                dx[i] = x1[i] - x[i];
+                r0[i] = r[i] - r0[i] - fp0[i] * (p1 - p);
+                work[i] = w[i] * w[i];
+            }
+            m_jac->broydenUpdate(dx.data(), r0.data(), work.data());
+        }
+        x.swap(x1);
+        p = p1;
+
+        if (s1 < 1.0) {
+            // Reject the solution if it is further from the predicted point
+            // than the step size, since the corrector may then have jumped to
+            // a different part of the solution curve.
+            for (size_t i = 0; i < n; i++) {
+                dx[i] = x[i] - x_pred[i];
+            }
+            if (ds > 0.0 && arclengthDot(dx, p - p_pred, dx, p - p_pred,
+                                         w, wp) > ds * ds) {
+                debuglog("Arclength continuation: corrector moved too far\n",
+                         loglevel);
+                break;
+            }
+            setParameter(p);
+            m_jac_ok = false;
+            return iter + 1;
+        }
+
+        // re-evaluate the Jacobian if the iterations converge slowly
+        new_jac = (s1 > 0.8 * s0);
+    }
+    m_jac_ok = false;
+    return -1;
+}
+
+bool Sim1D::solveContinuation(doublereal p0, doublereal p1, doublereal dp,
+                              int loglevel, bool refine_grid)
+{
+    LogRedirect redirect(m_logger);
+    if (dp == 0.0) {
+        throw CanteraError("Sim1D::solveContinuation",
+                           "Step size must be nonzero.");
+    }
+    m_cont_params.clear();
+    m_turning_points.clear();
+    setParameter(p0);
+    solve(loglevel-1, refine_grid);
+    m_cont_params.push_back(p0);
+    if (continuationStopped(p0)) {
+        return p0 == p1;
+    }
+
+    doublereal dpmin = m_cont_minstep * fabs(dp);
+    doublereal dpmax = m_cont_maxstep * fabs(dp);
+    dp = (p1 >= p0) ? fabs(dp) : -fabs(dp);
+    doublereal p = p0, p_prev = p0;
+    std::vector<vector_fp> grids, grids_prev;
+    vector_fp x_save, x_prev, x_interp;
+    while (p != p1) {
+        doublereal p_new = ((p1 - p) / dp <= 1.0) ? p1 : p + dp;
+        getGrids(grids);
+        x_save = m_x;
+
+        // extrapolate from the last two solutions
+        if (p != p_prev) {
+            interpolate(grids_prev, x_prev, x_interp);
+            doublereal c = (p_new - p) / (p - p_prev);
+            for (size_t i = 0; i < m_x.size(); i++) {
+                m_x[i] += c * (m_x[i] - x_interp[i]);
+            }
+            applyBounds(m_x.data());
+        }
+
+        setParameter(p_new);
+        if (continuationSolve(loglevel-2, refine_grid)) {
+            grids_prev = grids;
+            x_prev = x_save;
+            p_prev = p;
+            p = p_new;
+            m_cont_params.push_back(p);
+            if (loglevel > 0) {
+                writelog("Continuation: p = {:12.6g}  dp = {:10.4g}  "
+                         "{} points\n", p, p - p_prev, points());
+            }
+            if (continuationStopped(p)) {
+                return p == p1;
+            }
+            dp = clip(1.5 * dp, -dpmax, dpmax);
+        } else {
+            setGrids(grids, x_save);
+            setParameter(p);
+            dp *= 0.5;
+            if (loglevel > 0) {
+                writelog("Continuation: failed for p = {:12.6g}; reducing "
+                         "step to {:10.4g}\n", p_new, dp);
+            }
+            if (fabs(dp) < dpmin) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+size_t Sim1D::solveArclength(doublereal p0, doublereal ds, size_t nsteps,
+                             int loglevel, bool refine_grid)
+{
+    LogRedirect redirect(m_logger);
+    if (ds == 0.0) {
+        throw CanteraError("Sim1D::solveArclength",
+                           "Step size must be nonzero.");
+    }
+    m_cont_params.clear();
+    m_turning_points.clear();
+    setParameter(p0);
+    solve(loglevel-1, refine_grid);
+    m_cont_params.push_back(p0);
+    if (continuationStopped(p0)) {
+        return 0;
+    }
+
+    // The initial tangent is (dx/dp, 1), where J*dx/dp = -dF/dp
+    size_t n = size();
+    vector_fp t(n), r(n), w;
+    doublereal p = p0;
+    doublereal wp = (p0 != 0.0) ? 1.0 / fabs(p0) : 1.0;
+    doublereal h = 1.0e-7 * (fabs(p0) + 1.0 / wp);
+    OneDim::evalSSJacobian(m_x.data(), r.data());
+    setParameter(p0 + h);
+    OneDim::eval(npos, m_x.data(), t.data(), 0.0);
+    setParameter(p0);
+    for (size_t i = 0; i < n; i++) {
+        t[i] = -(t[i] - r[i]) / h;
+    }
+    m_jac_ok = false;
+    if (m_jac->solve(t.data())) {
+        throw CanteraError("Sim1D::solveArclength",
+                           "Jacobian is singular at the initial solution.");
+    }
+    doublereal tp = (ds > 0) ? 1.0 : -1.0;
+    scale(t.begin(), t.end(), t.begin(), tp);
+
+    doublereal dsmin = m_cont_minstep * fabs(ds);
+    doublereal dsmax = m_cont_maxstep * fabs(ds);
+    ds = fabs(ds);
+    doublereal p_prev = p0, ds_prev = 0.0;
+    std::vector<vector_fp> grids;
+    vector_fp x, x_save, t_old;
+    size_t nstep = 0;
+    while (nstep < nsteps) {
+        // normalize the tangent using the weights for the current solution
+        continuationWeights(w);
+        doublereal tnorm = sqrt(arclengthDot(t, tp, t, tp, w, wp));
+        scale(t.begin(), t.end(), t.begin(), 1.0 / tnorm);
+        tp /= tnorm;
+
+        doublereal p_new;
+        int iter = arclengthStep(x, p_new, p, t, tp, ds, w, wp, loglevel-1);
+        if (iter < 0) {
+            setParameter(p);
+            ds *= 0.5;
+            if (loglevel > 0) {
+                writelog("Arclength continuation: step failed at "
+                         "p = {:12.6g}; reducing step to {:10.4g}\n", p, ds);
+            }
+            if (ds < dsmin) {
+                break;
+            }
+            continue;
+        }
+
+        // secant direction, used as the predictor for the next step
+        for (size_t i = 0; i < n; i++) {
+            t[i] = x[i] - m_x[i];
+        }
+        tp = p_new - p;
+
+        // check for a turning point, and estimate the extremal value of the
+        // parameter using a parabola through the last three solutions
+        if (ds_prev > 0.0 && (p - p_prev) * (p_new - p) < 0.0) {
+            doublereal d1 = (p - p_prev) / ds_prev;
+            doublereal d2 = (p_new - p) / ds;
+            doublereal c = (d2 - d1) / (ds + ds_prev);
+            doublereal b = d1 + c * ds_prev;
+            m_turning_points.push_back(p - b * b / (4.0 * c));
+            if (loglevel > 0) {
+                writelog("Arclength continuation: turning point at "
+                         "p = {:12.6g}\n", m_turning_points.back());
+            }
+        }
+        p_prev = p;
+        ds_prev = ds;
+        m_x = x;
+        p = p_new;
+        nstep++;
+
+        // Refine the grid, and find the solution on the new grid which lies
+        // on the hyperplane through the interpolated solution. If this fails,
+        // which may happen close to a turning point, keep the previous grid
+        // for this step rather than risk jumping to a different branch.
+        while (refine_grid) {
+            getGrids(grids);
+            x_save = m_x;
+            t_old = t;
+            if (refine(loglevel-1) <= 0) {
+                break;
+            }
+            interpolate(grids, t_old, t);
+            continuationWeights(w);
+            if (arclengthStep(x, p_new, p, t, tp, 0.0, w, wp,
+                              loglevel-1) >= 0) {
+                m_x = x;
+                p = p_new;
+            } else {
+                if (loglevel > 0) {
+                    writelog("Arclength continuation: no solution after "
+                             "refining the grid at p = {:12.6g}\n", p);
+                }
+                setGrids(grids, x_save);
+                t = t_old;
+                setParameter(p);
+                break;
+            }
+        }
+        n = size();
+
+        m_cont_params.push_back(p);
+        if (loglevel > 0) {
+            writelog("Arclength continuation: p = {:12.6g}  ds = {:10.4g}  "
+                     "{} points\n", p, ds, points());
+        }
+        if (continuationStopped(p)) {
+            break;
+        }
+        if (iter <= 6) {
+            ds = std::min(1.5 * ds, dsmax);
+        }
+    }
+    finalize();
+    return nstep;
+}
 }
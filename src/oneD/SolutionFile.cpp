@@ -0,0 +1,422 @@
+/**
+ * @file SolutionFile.cpp
+ */
+
+#include "cantera/oneD/SolutionFile.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace
+{
+
+const char magic[] = "CT1DSOLN";
+const uint32_t formatVersion = 1;
+const uint32_t byteOrderMark = 0x01020304;
+const size_t headerSize = 16;
+const size_t trailerSize = 16;
+
+//! Offset of the first multiple of 8 bytes at or after `pos`
+size_t aligned(size_t pos)
+{
+    return (pos + 7) / 8 * 8;
+}
+
+//! Reads values from a region of the file, checking that they lie within it
+class Reader
+{
+public:
+    Reader(const char* data, size_t begin, size_t end) :
+        m_data(data), m_pos(begin), m_end(end) {}
+
+    uint32_t readInt32() {
+        uint32_t v;
+        std::memcpy(&v, take(sizeof(v)), sizeof(v));
+        return v;
+    }
+
+    size_t readInt() {
+        uint64_t v;
+        std::memcpy(&v, take(sizeof(v)), sizeof(v));
+        return static_cast<size_t>(v);
+    }
+
+    doublereal readDouble() {
+        doublereal v;
+        std::memcpy(&v, take(sizeof(v)), sizeof(v));
+        return v;
+    }
+
+    std::string readString() {
+        size_t n = readInt();
+        return std::string(take(n), n);
+    }
+
+    const doublereal* readArray(size_t n) {
+        m_pos = aligned(m_pos);
+        if (n > (m_end - std::min(m_pos, m_end)) / sizeof(doublereal)) {
+            corrupt();
+        }
+        return reinterpret_cast<const doublereal*>(take(n * sizeof(doublereal)));
+    }
+
+private:
+    const char* take(size_t n) {
+        if (m_pos > m_end || n > m_end - m_pos) {
+            corrupt();
+        }
+        const char* p = m_data + m_pos;
+        m_pos += n;
+        return p;
+    }
+
+    void corrupt() {
+        throw CanteraError("SolutionFile", "The file is truncated or corrupt.");
+    }
+
+    const char* m_data;
+    size_t m_pos;
+    size_t m_end;
+};
+
+//! Appends values to a buffer which will be written to the file at `offset`
+class Writer
+{
+public:
+    Writer(std::string& buf, size_t offset) : m_buf(buf), m_offset(offset) {}
+
+    void writeInt32(uint32_t v) {
+        m_buf.append(reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+
+    void writeInt(size_t n) {
+        uint64_t v = n;
+        m_buf.append(reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+
+    void writeDouble(doublereal v) {
+        m_buf.append(reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+
+    void writeString(const std::string& s) {
+        writeInt(s.size());
+        m_buf += s;
+    }
+
+    void writeArray(const doublereal* x, size_t n) {
+        align();
+        if (n) {
+            m_buf.append(reinterpret_cast<const char*>(x), n * sizeof(doublereal));
+        }
+    }
+
+    //! Pad the buffer to a multiple of 8 bytes
+    void align() {
+        m_buf.resize(aligned(position()) - m_offset, '\0');
+    }
+
+    //! The offset in the file of the end of the buffer
+    size_t position() const {
+        return m_offset + m_buf.size();
+    }
+
+private:
+    std::string& m_buf;
+    size_t m_offset;
+};
+
+}
+
+SolutionFile::SolutionFile(const std::string& fname) :
+    m_fname(fname),
+    m_indexOffset(headerSize),
+    m_data(0),
+    m_size(0),
+    m_mapped(false)
+{
+    try {
+        mapFile();
+    } catch (CanteraError&) {
+        unmapFile();
+        throw;
+    }
+}
+
+SolutionFile::~SolutionFile()
+{
+    unmapFile();
+}
+
+void SolutionFile::mapFile()
+{
+#ifdef _WIN32
+    std::ifstream s(m_fname, ios::binary | ios::ate);
+    if (!s) {
+        return;
+    }
+    m_size = static_cast<size_t>(s.tellg());
+    m_buffer.resize(m_size / sizeof(doublereal) + 1);
+    s.seekg(0);
+    s.read(reinterpret_cast<char*>(m_buffer.data()), m_size);
+    if (!s) {
+        throw CanteraError("SolutionFile::mapFile",
+                           "Could not read file '{}'", m_fname);
+    }
+    m_data = reinterpret_cast<const char*>(m_buffer.data());
+#else
+    int fd = ::open(m_fname.c_str(), O_RDONLY);
+    if (fd < 0) {
+        if (errno == ENOENT) {
+            return;
+        }
+        throw CanteraError("SolutionFile::mapFile", "Could not open file "
+            "'{}': {}", m_fname, std::strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw CanteraError("SolutionFile::mapFile", "Could not open file "
+            "'{}': {}", m_fname, std::strerror(errno));
+    }
+    m_size = static_cast<size_t>(st.st_size);
+    if (m_size) {
+        void* p = mmap(0, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) {
+            m_size = 0;
+            throw CanteraError("SolutionFile::mapFile", "Could not map file "
+                "'{}' into memory: {}", m_fname, std::strerror(errno));
+        }
+        m_data = static_cast<const char*>(p);
+        m_mapped = true;
+    } else {
+        ::close(fd);
+    }
+#endif
+    if (m_size == 0) {
+        // An empty file is treated like one that does not exist yet
+        return;
+    }
+
+    if (m_size < headerSize + trailerSize
+        || std::memcmp(m_data, magic, 8) != 0
+        || std::memcmp(m_data + m_size - 8, magic, 8) != 0) {
+        throw CanteraError("SolutionFile::mapFile",
+                           "'{}' is not a solution file.", m_fname);
+    }
+    Reader header(m_data, 8, headerSize);
+    uint32_t version = header.readInt32();
+    uint32_t bom = header.readInt32();
+    if (bom != byteOrderMark) {
+        throw CanteraError("SolutionFile::mapFile", "'{}' was written on a "
+            "machine with a different byte order.", m_fname);
+    } else if (version != formatVersion) {
+        throw CanteraError("SolutionFile::mapFile", "'{}' uses format "
+            "version {}, but only version {} is supported.",
+            m_fname, version, formatVersion);
+    }
+
+    size_t indexEnd = m_size - trailerSize;
+    m_indexOffset = Reader(m_data, indexEnd, m_size).readInt();
+    Reader index(m_data, m_indexOffset, indexEnd);
+    size_t n = index.readInt();
+    m_entries.clear();
+    for (size_t i = 0; i < n; i++) {
+        Entry e;
+        e.id = index.readString();
+        e.offset = index.readInt();
+        e.size = index.readInt();
+        if (e.offset < headerSize || e.offset > m_indexOffset
+            || e.size > m_indexOffset - e.offset) {
+            throw CanteraError("SolutionFile::mapFile",
+                "The index of file '{}' is corrupt.", m_fname);
+        }
+        m_entries.push_back(e);
+    }
+}
+
+void SolutionFile::unmapFile()
+{
+#ifndef _WIN32
+    if (m_mapped) {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+    m_buffer.clear();
+    m_data = 0;
+    m_size = 0;
+    m_mapped = false;
+    m_entries.clear();
+    m_indexOffset = headerSize;
+}
+
+const SolutionFile::Entry& SolutionFile::entry(const std::string& id) const
+{
+    for (const auto& e : m_entries) {
+        if (e.id == id) {
+            return e;
+        }
+    }
+    throw CanteraError("SolutionFile::entry",
+                       "No solution with id '{}' in file '{}'", id, m_fname);
+}
+
+std::vector<std::string> SolutionFile::solutionIds() const
+{
+    std::vector<std::string> ids;
+    for (const auto& e : m_entries) {
+        ids.push_back(e.id);
+    }
+    return ids;
+}
+
+bool SolutionFile::hasSolution(const std::string& id) const
+{
+    for (const auto& e : m_entries) {
+        if (e.id == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string SolutionFile::description(const std::string& id) const
+{
+    const Entry& e = entry(id);
+    Reader r(m_data, e.offset, e.offset + e.size);
+    r.readInt(); // time
+    return r.readString();
+}
+
+std::time_t SolutionFile::saveTime(const std::string& id) const
+{
+    const Entry& e = entry(id);
+    Reader r(m_data, e.offset, e.offset + e.size);
+    return static_cast<std::time_t>(static_cast<int64_t>(r.readInt()));
+}
+
+std::vector<SolutionFile::DomainData> SolutionFile::domains(
+    const std::string& id) const
+{
+    const Entry& e = entry(id);
+    Reader r(m_data, e.offset, e.offset + e.size);
+    r.readInt(); // time
+    r.readString(); // description
+    std::vector<DomainData> domains(r.readInt());
+    for (auto& d : domains) {
+        d.id = r.readString();
+        d.nPoints = r.readInt();
+        d.components.resize(r.readInt());
+        for (auto& name : d.components) {
+            name = r.readString();
+        }
+        size_t nattr = r.readInt();
+        for (size_t i = 0; i < nattr; i++) {
+            std::string name = r.readString();
+            d.attributes[name] = r.readDouble();
+        }
+        d.grid = r.readArray(d.nPoints);
+        if (d.components.size() && d.nPoints > size_t(-1) / d.components.size()) {
+            throw CanteraError("SolutionFile::domains",
+                               "The file is truncated or corrupt.");
+        }
+        d.values = r.readArray(d.nPoints * d.components.size());
+    }
+    return domains;
+}
+
+void SolutionFile::addSolution(const std::string& id, const std::string& desc,
+                               const std::vector<DomainData>& domains)
+{
+    bool create = (m_size == 0);
+    size_t offset = create ? 0 : m_indexOffset;
+    std::string buf;
+    Writer w(buf, offset);
+    if (create) {
+        buf.append(magic, 8);
+        w.writeInt32(formatVersion);
+        w.writeInt32(byteOrderMark);
+    }
+
+    Entry added;
+    added.id = id;
+    added.offset = w.position();
+    w.writeInt(static_cast<uint64_t>(static_cast<int64_t>(std::time(0))));
+    w.writeString(desc);
+    w.writeInt(domains.size());
+    for (const auto& d : domains) {
+        w.writeString(d.id);
+        w.writeInt(d.nPoints);
+        w.writeInt(d.components.size());
+        for (const auto& name : d.components) {
+            w.writeString(name);
+        }
+        w.writeInt(d.attributes.size());
+        for (const auto& attr : d.attributes) {
+            w.writeString(attr.first);
+            w.writeDouble(attr.second);
+        }
+        w.writeArray(d.grid, d.nPoints);
+        w.writeArray(d.values, d.nPoints * d.components.size());
+    }
+    w.align();
+    added.size = w.position() - added.offset;
+
+    std::vector<Entry> entries = m_entries;
+    bool replaced = false;
+    for (auto& e : entries) {
+        if (e.id == id) {
+            e = added;
+            replaced = true;
+        }
+    }
+    if (!replaced) {
+        entries.push_back(added);
+    }
+    size_t indexOffset = w.position();
+    w.writeInt(entries.size());
+    for (const auto& e : entries) {
+        w.writeString(e.id);
+        w.writeInt(e.offset);
+        w.writeInt(e.size);
+    }
+    w.writeInt(indexOffset);
+    buf.append(magic, 8);
+
+    // The new data always extends past the end of the existing index, so the
+    // file never needs to be truncated.
+    unmapFile();
+    bool ok;
+    if (create) {
+        std::ofstream s(m_fname, ios::binary | ios::trunc);
+        s.write(buf.data(), buf.size());
+        ok = s.good();
+    } else {
+        std::fstream s(m_fname, ios::binary | ios::in | ios::out);
+        s.seekp(offset);
+        s.write(buf.data(), buf.size());
+        ok = s.good();
+    }
+    mapFile();
+    if (!ok) {
+        throw CanteraError("SolutionFile::addSolution",
+                           "Could not write to file '{}'", m_fname);
+    }
+}
+
+}
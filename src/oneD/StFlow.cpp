@@ -3,9 +3,11 @@
 // Copyright 2002  California Institute of Technology
 
 #include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/MultiJac.h"
 #include "cantera/base/ctml.h"
-#include "cantera/transport/TransportBase.h"
+#include "cantera/transport/MixTransport.h"
 #include "cantera/numerics/funcs.h"
+#include "cantera/base/parallel.h"
 
 using namespace std;
 
@@ -22,9 +24,12 @@ StFlow::StFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
     m_jac(0),
     m_epsilon_left(0.0),
     m_epsilon_right(0.0),
+    m_boundary_rad_left(0.0),
+    m_boundary_rad_right(0.0),
     m_do_soret(false),
     m_transport_option(-1),
-    m_do_radiation(false)
+    m_do_radiation(false),
+    m_nthreads(1)
 {
     m_type = cFlowType;
     m_points = points;
@@ -143,6 +148,7 @@ void StFlow::setTransport(Transport& trans, bool withSoret)
 {
     m_trans = &trans;
     m_do_soret = withSoret;
+    clearThreadCopies();
 
     int model = m_trans->model();
     if (model == cMulticomponent || model == CK_Multicomponent) {
@@ -174,12 +180,57 @@ void StFlow::enableSoret(bool withSoret)
     }
 }
 
+void StFlow::setThreads(size_t nthreads)
+{
+    m_nthreads = (nthreads == 0) ? hardwareThreads() : nthreads;
+    clearThreadCopies();
+}
+
+void StFlow::makeThreadCopies()
+{
+    if (m_thread_thermo.size() + 1 >= m_nthreads) {
+        return;
+    }
+    clearThreadCopies();
+    MixTransport* mixtrans = dynamic_cast<MixTransport*>(m_trans);
+    for (size_t t = 1; t < m_nthreads; t++) {
+        IdealGasPhase* gas = dynamic_cast<IdealGasPhase*>(
+            m_thermo->duplMyselfAsThermoPhase());
+        m_thread_thermo.emplace_back(gas);
+        m_thread_kin.emplace_back(m_kin->duplMyselfAsKinetics({gas}));
+        if (m_transport_option == c_Mixav_Transport && mixtrans) {
+            m_thread_trans.emplace_back(mixtrans->duplMyselfAsTransport());
+            m_thread_trans.back()->setThermo(*gas);
+        }
+    }
+}
+
 void StFlow::setGas(const doublereal* x, size_t j)
 {
-    m_thermo->setTemperature(T(x,j));
+    setGas(x, j, *m_thermo);
+}
+
+void StFlow::setGas(const doublereal* x, size_t j, IdealGasPhase& gas) const
+{
+    gas.setTemperature(T(x,j));
     const doublereal* yy = x + m_nv*j + c_offset_Y;
-    m_thermo->setMassFractions_NoNorm(yy);
-    m_thermo->setPressure(m_press);
+    gas.setMassFractions_NoNorm(yy);
+    gas.setPressure(m_press);
+}
+
+void StFlow::updateThermo(const doublereal* x, size_t j0, size_t j1)
+{
+    size_t nthreads = nThreadsFor(j1 - j0 + 1);
+    if (nthreads <= 1) {
+        updateThermo(x, j0, j1, *m_thermo);
+        return;
+    }
+    makeThreadCopies();
+    size_t npts = j1 - j0 + 1;
+    parallel_for(nthreads, nthreads, [&](size_t t) {
+        updateThermo(x, j0 + t * npts / nthreads,
+                     j0 + (t + 1) * npts / nthreads - 1, threadPhase(t));
+    });
 }
 
 void StFlow::setGasAtMidpoint(const doublereal* x, size_t j)
@@ -223,8 +274,12 @@ void StFlow::eval(size_t jg, doublereal* xg,
         return;
     }
 
+    // true if the residual at all points is being evaluated for a group of
+    // perturbed columns of the Jacobian (see MultiJac::setColoring)
+    bool colored = (m_jac && m_jac->coloredEval());
+
     // if evaluating a Jacobian, compute the steady-state residual
-    if (jg != npos) {
+    if (jg != npos || colored) {
         rdt = 0.0;
     }
 
@@ -247,13 +302,11 @@ void StFlow::eval(size_t jg, doublereal* xg,
     size_t j0 = std::max<size_t>(jmin, 1) - 1;
     size_t j1 = std::min(jmax+1,m_points-1);
 
-    size_t j, k;
-
     // ------------ update properties ------------
 
     updateThermo(x, j0, j1);
     // update transport properties only if a Jacobian is not being evaluated
-    if (jg == npos) {
+    if (jg == npos && !colored) {
         updateTransport(x, j0, j1);
     }
 
@@ -261,78 +314,56 @@ void StFlow::eval(size_t jg, doublereal* xg,
     // Jacobian is being evaluated
     updateDiffFluxes(x, j0, j1);
 
-    //----------------------------------------------------
-    // evaluate the residual equations at all required
-    // grid points
-    //----------------------------------------------------
-    doublereal sum, sum2, dtdzj;
-
     // calculation of qdotRadiation
-
-    // The simple radiation model used was established by Y. Liu and B. Rogg [Y.
-    // Liu and B. Rogg, Modelling of thermally radiating diffusion flames with
-    // detailed chemistry and transport, EUROTHERM Seminars, 17:114-127, 1991].
-    // This model uses the optically thin limit and the gray-gas approximation
-    // to simply calculate a volume specified heat flux out of the Planck
-    // absorption coefficients, the boundary emissivities and the temperature.
-    // The model considers only CO2 and H2O as radiating species. Polynomial
-    // lines calculate the species Planck coefficients for H2O and CO2. The data
-    // for the lines is taken from the RADCAL program [Grosshandler, W. L.,
-    // RADCAL: A Narrow-Band Model for Radiation Calculations in a Combustion
-    // Environment, NIST technical note 1402, 1993]. The coefficients for the
-    // polynomials are taken from [http://www.sandia.gov/TNF/radiation.html].
-
     if (m_do_radiation) {
-        // variable definitions for the Planck absorption coefficient and the
-        // radiation calculation:
-        doublereal k_P_ref = 1.0*OneAtm;
-
-        // polynomial coefficients:
-        const doublereal c_H2O[6] = {-0.23093, -1.12390, 9.41530, -2.99880,
-                                     0.51382, -1.86840e-5};
-        const doublereal c_CO2[6] = {18.741, -121.310, 273.500, -194.050,
-                                     56.310, -5.8169};
-
         // calculation of the two boundary values
         double boundary_Rad_left = m_epsilon_left * StefanBoltz * pow(T(x, 0), 4);
         double boundary_Rad_right = m_epsilon_right * StefanBoltz * pow(T(x, m_points - 1), 4);
+        if (!colored) {
+            m_boundary_rad_left = boundary_Rad_left;
+            m_boundary_rad_right = boundary_Rad_right;
+        }
 
         // loop over all grid points
-        for (size_t j = jmin; j < jmax; j++) {
-            // helping variable for the calculation
-            double radiative_heat_loss = 0;
-
-            // calculation of the mean Planck absorption coefficient
-            double k_P = 0;
-            // absorption coefficient for H2O
-            if (m_kRadiating[1] != npos) {
-                double k_P_H2O = 0;
-                for (size_t n = 0; n <= 5; n++) {
-                    k_P_H2O += c_H2O[n] * pow(1000 / T(x, j), (double) n);
-                }
-                k_P_H2O /= k_P_ref;
-                k_P += m_press * X(x, m_kRadiating[1], j) * k_P_H2O;
-            }
-            // absorption coefficient for CO2
-            if (m_kRadiating[0] != npos) {
-                double k_P_CO2 = 0;
-                for (size_t n = 0; n <= 5; n++) {
-                    k_P_CO2 += c_CO2[n] * pow(1000 / T(x, j), (double) n);
-                }
-                k_P_CO2 /= k_P_ref;
-                k_P += m_press * X(x, m_kRadiating[0], j) * k_P_CO2;
-            }
-
-            // calculation of the radiative heat loss term
-            radiative_heat_loss = 2 * k_P *(2 * StefanBoltz * pow(T(x, j), 4)
-            - boundary_Rad_left - boundary_Rad_right);
+        for (size_t j = jmin; j <= jmax; j++) {
+            // For a colored Jacobian, the boundary temperatures may be
+            // perturbed together with other points. Only the points next to
+            // each boundary, which are in the stencil of the boundary point,
+            // see the perturbed values.
+            double rad_left = (colored && j > 1) ?
+                m_boundary_rad_left : boundary_Rad_left;
+            double rad_right = (colored && j + 2 < m_points) ?
+                m_boundary_rad_right : boundary_Rad_right;
 
             // set the radiative heat loss vector
-            m_qdotRadiation[j] = radiative_heat_loss;
+            m_qdotRadiation[j] = radiativeHeatLoss(x, j, m_wtm[j], rad_left,
+                                                   rad_right);
         }
     }
 
-    for (j = jmin; j <= jmax; j++) {
+    //----------------------------------------------------
+    // evaluate the residual equations at all required
+    // grid points
+    //----------------------------------------------------
+    size_t nthreads = nThreadsFor(jmax - jmin + 1);
+    if (nthreads <= 1) {
+        evalPoints(x, rsd, diag, rdt, jmin, jmax, *m_thermo, *m_kin);
+    } else {
+        makeThreadCopies();
+        size_t npts = jmax - jmin + 1;
+        parallel_for(nthreads, nthreads, [&](size_t t) {
+            evalPoints(x, rsd, diag, rdt, jmin + t * npts / nthreads,
+                       jmin + (t + 1) * npts / nthreads - 1, threadPhase(t),
+                       threadKinetics(t));
+        });
+    }
+}
+
+void StFlow::evalPoints(doublereal* x, doublereal* rsd, integer* diag,
+                        doublereal rdt, size_t jmin, size_t jmax,
+                        IdealGasPhase& gas, Kinetics& kin)
+{
+    for (size_t j = jmin; j <= jmax; j++) {
         //----------------------------------------------
         //         left boundary
         //----------------------------------------------
@@ -357,8 +388,8 @@ void StFlow::eval(size_t jg, doublereal* xg,
 
             // The default boundary condition for species is zero flux. However,
             // the boundary object may modify this.
-            sum = 0.0;
-            for (k = 0; k < m_nsp; k++) {
+            doublereal sum = 0.0;
+            for (size_t k = 0; k < m_nsp; k++) {
                 sum += Y(x,k,0);
                 rsd[index(c_offset_Y + k, 0)] =
                     -(m_flux(k,0) + rho_u(x,0)* Y(x,k,0));
@@ -387,9 +418,9 @@ void StFlow::eval(size_t jg, doublereal* xg,
             //   \rho dY_k/dt + \rho u dY_k/dz + dJ_k/dz
             //   = M_k\omega_k
             //-------------------------------------------------
-            getWdot(x,j);
+            getWdot(x, j, gas, kin);
             doublereal convec, diffus;
-            for (k = 0; k < m_nsp; k++) {
+            for (size_t k = 0; k < m_nsp; k++) {
                 convec = rho_u(x,j)*dYdz(x,k,j);
                 diffus = 2.0*(m_flux(k,j) - m_flux(k,j-1))
                          /(z(j+1) - z(j-1));
@@ -409,21 +440,21 @@ void StFlow::eval(size_t jg, doublereal* xg,
             //      - sum_k(J_k c_p_k / M_k) dT/dz
             //-----------------------------------------------
             if (m_do_energy[j]) {
-                setGas(x,j);
+                setGas(x, j, gas);
 
                 // heat release term
-                const vector_fp& h_RT = m_thermo->enthalpy_RT_ref();
-                const vector_fp& cp_R = m_thermo->cp_R_ref();
-                sum = 0.0;
-                sum2 = 0.0;
+                const vector_fp& h_RT = gas.enthalpy_RT_ref();
+                const vector_fp& cp_R = gas.cp_R_ref();
+                doublereal sum = 0.0;
+                doublereal sum2 = 0.0;
                 doublereal flxk;
-                for (k = 0; k < m_nsp; k++) {
+                for (size_t k = 0; k < m_nsp; k++) {
                     flxk = 0.5*(m_flux(k,j-1) + m_flux(k,j));
                     sum += wdot(k,j)*h_RT[k];
                     sum2 += flxk*cp_R[k]/m_wt[k];
                 }
                 sum *= GasConstant * T(x,j);
-                dtdzj = dTdz(x,j);
+                doublereal dtdzj = dTdz(x,j);
                 sum2 *= GasConstant * dtdzj;
 
                 rsd[index(c_offset_T, j)] = - m_cp[j]*rho_u(x,j)*dtdzj
@@ -446,7 +477,43 @@ void StFlow::eval(size_t jg, doublereal* xg,
 
 void StFlow::updateTransport(doublereal* x, size_t j0, size_t j1)
 {
-    if (m_transport_option == c_Mixav_Transport) {
+    MixTransport* mixtrans = dynamic_cast<MixTransport*>(m_trans);
+    if (m_transport_option == c_Mixav_Transport && mixtrans) {
+        // Evaluate the properties at all of the midpoints together
+        size_t npts = j1 - j0;
+        m_tbar.resize(npts);
+        m_pbar.assign(npts, m_press);
+        m_xbar.resize(npts*m_nsp);
+        for (size_t j = j0; j < j1; j++) {
+            m_tbar[j-j0] = 0.5*(T(x,j)+T(x,j+1));
+            doublereal* xbar = &m_xbar[(j-j0)*m_nsp];
+            doublereal sum = 0.0;
+            for (size_t k = 0; k < m_nsp; k++) {
+                xbar[k] = 0.5*(Y(x,k,j) + Y(x,k,j+1)) / m_wt[k];
+                sum += xbar[k];
+            }
+            for (size_t k = 0; k < m_nsp; k++) {
+                xbar[k] /= sum;
+            }
+        }
+        size_t nthreads = nThreadsFor(npts);
+        if (nthreads > 1) {
+            makeThreadCopies();
+        }
+        parallel_for(nthreads, nthreads, [&](size_t t) {
+            MixTransport* tr = t ? static_cast<MixTransport*>(
+                m_thread_trans[t-1].get()) : mixtrans;
+            size_t i0 = t * npts / nthreads;
+            size_t i1 = (t + 1) * npts / nthreads;
+            size_t j = j0 + i0;
+            tr->getMixTransportProperties(i1 - i0, &m_tbar[i0], &m_pbar[i0],
+                &m_xbar[i0*m_nsp], m_nsp, m_dovisc ? &m_visc[j] : 0,
+                &m_tcon[j], &m_diff[j*m_nsp], m_nsp);
+        });
+        if (!m_dovisc) {
+            std::fill(m_visc.begin() + j0, m_visc.begin() + j1, 0.0);
+        }
+    } else if (m_transport_option == c_Mixav_Transport) {
         for (size_t j = j0; j < j1; j++) {
             setGasAtMidpoint(x,j);
             m_visc[j] = (m_dovisc ? m_trans->viscosity() : 0.0);
@@ -575,6 +642,370 @@ void StFlow::updateDiffFluxes(const doublereal* x, size_t j0, size_t j1)
     }
 }
 
+doublereal StFlow::radiativeHeatLoss(const doublereal* x, size_t j,
+                                     doublereal wtm, doublereal rad_left,
+                                     doublereal rad_right) const
+{
+    // The simple radiation model used was established by Y. Liu and B. Rogg [Y.
+    // Liu and B. Rogg, Modelling of thermally radiating diffusion flames with
+    // detailed chemistry and transport, EUROTHERM Seminars, 17:114-127, 1991].
+    // This model uses the optically thin limit and the gray-gas approximation
+    // to simply calculate a volume specified heat flux out of the Planck
+    // absorption coefficients, the boundary emissivities and the temperature.
+    // The model considers only CO2 and H2O as radiating species. Polynomial
+    // lines calculate the species Planck coefficients for H2O and CO2. The data
+    // for the lines is taken from the RADCAL program [Grosshandler, W. L.,
+    // RADCAL: A Narrow-Band Model for Radiation Calculations in a Combustion
+    // Environment, NIST technical note 1402, 1993]. The coefficients for the
+    // polynomials are taken from [http://www.sandia.gov/TNF/radiation.html].
+
+    // variable definitions for the Planck absorption coefficient and the
+    // radiation calculation:
+    doublereal k_P_ref = 1.0*OneAtm;
+
+    // polynomial coefficients:
+    const doublereal c_H2O[6] = {-0.23093, -1.12390, 9.41530, -2.99880,
+                                 0.51382, -1.86840e-5};
+    const doublereal c_CO2[6] = {18.741, -121.310, 273.500, -194.050,
+                                 56.310, -5.8169};
+
+    // calculation of the mean Planck absorption coefficient
+    double k_P = 0;
+    // absorption coefficient for H2O
+    if (m_kRadiating[1] != npos) {
+        double k_P_H2O = 0;
+        for (size_t n = 0; n <= 5; n++) {
+            k_P_H2O += c_H2O[n] * pow(1000 / T(x, j), (double) n);
+        }
+        k_P_H2O /= k_P_ref;
+        k_P += m_press * (wtm*Y(x, m_kRadiating[1], j)/m_wt[m_kRadiating[1]])
+               * k_P_H2O;
+    }
+    // absorption coefficient for CO2
+    if (m_kRadiating[0] != npos) {
+        double k_P_CO2 = 0;
+        for (size_t n = 0; n <= 5; n++) {
+            k_P_CO2 += c_CO2[n] * pow(1000 / T(x, j), (double) n);
+        }
+        k_P_CO2 /= k_P_ref;
+        k_P += m_press * (wtm*Y(x, m_kRadiating[0], j)/m_wt[m_kRadiating[0]])
+               * k_P_CO2;
+    }
+
+    // calculation of the radiative heat loss term
+    return 2 * k_P *(2 * StefanBoltz * pow(T(x, j), 4) - rad_left - rad_right);
+}
+
+bool StFlow::analyticJacobian(size_t j) const
+{
+    // The equations at the first and last points may be modified by the
+    // adjacent boundary domains, so the columns for the points that appear
+    // in their stencils are computed by finite differences
+    return j >= 2 && j + 2 < m_points;
+}
+
+void StFlow::evalJacobian(doublereal* xg, MultiJac& jac)
+{
+    if (m_points < 5) {
+        return;
+    }
+    doublereal* x = xg + loc();
+    size_t nc = m_nsp + 1; // temperature and mass fractions
+    m_jac_hRT.resize(m_nsp, m_points);
+    m_jac_cpR.resize(m_nsp, m_points);
+    m_jac_drho.assign(nc, 0.0);
+    m_jac_dcp.assign(nc, 0.0);
+    m_jac_dqrad.assign(nc, 0.0);
+    m_jac_dwdot.resize(m_nsp, nc);
+    m_jac_dhRT.resize(m_nsp);
+    m_jac_dcpR.resize(m_nsp);
+    m_jac_work.resize(m_nsp);
+
+    // properties at the unperturbed state. The transport properties are held
+    // fixed, as for the finite difference Jacobian.
+    updateThermo(x, 0, m_points - 1);
+    updateDiffFluxes(x, 0, m_points - 1);
+    for (size_t j = 1; j < m_points - 1; j++) {
+        getWdot(x, j);
+        const vector_fp& h_RT = m_thermo->enthalpy_RT_ref();
+        const vector_fp& cp_R = m_thermo->cp_R_ref();
+        copy(h_RT.begin(), h_RT.end(), &m_jac_hRT(0, j));
+        copy(cp_R.begin(), cp_R.end(), &m_jac_cpR(0, j));
+    }
+    double rad_left = m_epsilon_left * StefanBoltz * pow(T(x, 0), 4);
+    double rad_right = m_epsilon_right * StefanBoltz * pow(T(x, m_points - 1), 4);
+
+    // column index of local component c (temperature or mass fraction)
+    auto comp = [](size_t c) {
+        return (c == 0) ? c_offset_T : c_offset_Y + c - 1;
+    };
+
+    for (size_t j = 2; j + 2 < m_points; j++) {
+        // derivatives of the local thermochemical properties with respect to
+        // T and Y_k at point j
+        double qrad = 0.0;
+        if (m_do_radiation) {
+            qrad = radiativeHeatLoss(x, j, m_wtm[j], rad_left, rad_right);
+        }
+        for (size_t c = 0; c < nc; c++) {
+            doublereal& xc = x[index(comp(c), j)];
+            doublereal xsave = xc;
+            xc = xsave + jac.perturbation(xsave);
+            doublereal rdx = 1.0/(xc - xsave);
+            setGas(x, j);
+            m_jac_drho[c] = (m_thermo->density() - m_rho[j])*rdx;
+            m_jac_dcp[c] = (m_thermo->cp_mass() - m_cp[j])*rdx;
+            m_kin->getNetProductionRates(m_jac_work.data());
+            for (size_t k = 0; k < m_nsp; k++) {
+                m_jac_dwdot(k, c) = (m_jac_work[k] - m_wdot(k, j))*rdx;
+            }
+            if (c == 0) {
+                const vector_fp& h_RT = m_thermo->enthalpy_RT_ref();
+                const vector_fp& cp_R = m_thermo->cp_R_ref();
+                for (size_t k = 0; k < m_nsp; k++) {
+                    m_jac_dhRT[k] = (h_RT[k] - m_jac_hRT(k, j))*rdx;
+                    m_jac_dcpR[k] = (cp_R[k] - m_jac_cpR(k, j))*rdx;
+                }
+            }
+            if (m_do_radiation) {
+                m_jac_dqrad[c] = (radiativeHeatLoss(x, j,
+                    m_thermo->meanMolecularWeight(), rad_left, rad_right)
+                    - qrad) * rdx;
+            }
+            xc = xsave;
+        }
+
+        // derivatives of the fluxes at the midpoints j-1/2 and j+1/2
+        getFluxDerivs(x, j - 1, j, m_jac_dFleft);
+        getFluxDerivs(x, j, j, m_jac_dFright);
+
+        for (size_t i = j - 1; i <= j + 1; i++) {
+            // Jacobian element for the residual of component n at point i
+            // with respect to component m at point j
+            auto J = [&](size_t n, size_t m) -> doublereal& {
+                return jac.value(loc() + index(n, i), loc() + index(m, j));
+            };
+
+            // derivatives with respect to the upwind derivative and the
+            // second derivative terms at point i
+            size_t jloc = (u(x,i) > 0.0 ? i : i + 1);
+            double d_upwind = 0.0;
+            if (j == jloc) {
+                d_upwind = 1.0 / m_dz[jloc-1];
+            } else if (j + 1 == jloc) {
+                d_upwind = -1.0 / m_dz[jloc-1];
+            }
+            double dzl = z(i) - z(i-1);
+            double dzr = z(i+1) - z(i);
+            double dzc = z(i+1) - z(i-1);
+            auto d_diffusion = [&](const vector_fp& f) {
+                if (j == i + 1) {
+                    return 2.0 * f[i] / (dzr * dzc);
+                } else if (j == i) {
+                    return -2.0 * (f[i] / dzr + f[i-1] / dzl) / dzc;
+                } else {
+                    return 2.0 * f[i-1] / (dzl * dzc);
+                }
+            };
+
+            // derivatives of the fluxes at i+1/2 and i-1/2 with respect to
+            // the solution at point j
+            const Array2D* dFr = (i == j) ? &m_jac_dFright :
+                                 (i + 1 == j) ? &m_jac_dFleft : nullptr;
+            const Array2D* dFl = (i == j) ? &m_jac_dFleft :
+                                 (i == j + 1) ? &m_jac_dFright : nullptr;
+            double rho = m_rho[i];
+
+            // continuity
+            double d_rhou = 0.0, d_rhoV = 0.0, d_T = 0.0;
+            continuityDerivs(i, j, d_rhou, d_rhoV, d_T);
+            J(c_offset_U, c_offset_U) = d_rhou * m_rho[j];
+            J(c_offset_U, c_offset_V) = d_rhoV * m_rho[j];
+            for (size_t c = 0; c < nc; c++) {
+                J(c_offset_U, comp(c)) = (d_rhou * u(x,j) + d_rhoV * V(x,j))
+                                         * m_jac_drho[c];
+            }
+            J(c_offset_U, c_offset_T) += d_T;
+
+            // radial momentum
+            J(c_offset_V, c_offset_V) = d_diffusion(m_visc) / rho
+                                        - u(x,i) * d_upwind;
+            if (i == j) {
+                J(c_offset_V, c_offset_V) -= 2.0 * V(x,i);
+                J(c_offset_V, c_offset_U) = -dVdz(x,i);
+                J(c_offset_V, c_offset_L) = -1.0 / rho;
+                double rV = (shear(x,i) - lambda(x,i)) / (rho * rho);
+                for (size_t c = 0; c < nc; c++) {
+                    J(c_offset_V, comp(c)) = -rV * m_jac_drho[c];
+                }
+            }
+
+            // species
+            for (size_t k = 0; k < m_nsp; k++) {
+                size_t n = c_offset_Y + k;
+                double N_k = m_wt[k] * m_wdot(k,i)
+                    - 2.0 * (m_flux(k,i) - m_flux(k,i-1)) / dzc;
+                for (size_t c = 0; c < nc; c++) {
+                    double dN = 0.0;
+                    if (dFr) {
+                        dN -= 2.0 * (*dFr)(k,c) / dzc;
+                    }
+                    if (dFl) {
+                        dN += 2.0 * (*dFl)(k,c) / dzc;
+                    }
+                    if (i == j) {
+                        dN += m_wt[k] * m_jac_dwdot(k,c);
+                        J(n, comp(c)) = dN / rho
+                            - N_k / (rho * rho) * m_jac_drho[c];
+                    } else {
+                        J(n, comp(c)) = dN / rho;
+                    }
+                }
+                J(n, n) -= u(x,i) * d_upwind;
+                if (i == j) {
+                    J(n, c_offset_U) = -dYdz(x,k,i);
+                }
+            }
+
+            // energy
+            if (m_do_energy[i]) {
+                // residual is -u*dT/dz + Q/(rho*cp)
+                double rcp = rho * m_cp[i];
+                double dtdz = dTdz(x,i);
+                double sum = 0.0, sum2 = 0.0;
+                for (size_t k = 0; k < m_nsp; k++) {
+                    sum += m_wdot(k,i) * m_jac_hRT(k,i);
+                    sum2 += 0.5 * (m_flux(k,i-1) + m_flux(k,i))
+                            * m_jac_cpR(k,i) / m_wt[k];
+                }
+                double Q = -divHeatFlux(x,i) - GasConstant * T(x,i) * sum
+                           - GasConstant * dtdz * sum2 - m_qdotRadiation[i];
+                for (size_t c = 0; c < nc; c++) {
+                    double dsum2 = 0.0;
+                    for (size_t k = 0; k < m_nsp; k++) {
+                        double dflx = 0.0;
+                        if (dFr) {
+                            dflx += (*dFr)(k,c);
+                        }
+                        if (dFl) {
+                            dflx += (*dFl)(k,c);
+                        }
+                        dsum2 += 0.5 * dflx * m_jac_cpR(k,i) / m_wt[k];
+                    }
+                    double dQ = 0.0;
+                    if (i == j) {
+                        double dsum = 0.0;
+                        for (size_t k = 0; k < m_nsp; k++) {
+                            dsum += m_jac_dwdot(k,c) * m_jac_hRT(k,i);
+                        }
+                        if (c == 0) {
+                            for (size_t k = 0; k < m_nsp; k++) {
+                                dsum += m_wdot(k,i) * m_jac_dhRT[k];
+                                dsum2 += 0.5 * (m_flux(k,i-1) + m_flux(k,i))
+                                         * m_jac_dcpR[k] / m_wt[k];
+                            }
+                            dQ -= GasConstant * sum;
+                        }
+                        dQ -= GasConstant * T(x,i) * dsum + m_jac_dqrad[c];
+                    }
+                    dQ -= GasConstant * dtdz * dsum2;
+                    if (c == 0) {
+                        dQ += d_diffusion(m_tcon)
+                              - GasConstant * d_upwind * sum2;
+                    }
+                    double value = dQ / rcp;
+                    if (i == j) {
+                        value -= Q / (rcp * rcp) * (m_cp[i] * m_jac_drho[c]
+                                                    + rho * m_jac_dcp[c]);
+                    }
+                    J(c_offset_T, comp(c)) = value;
+                }
+                J(c_offset_T, c_offset_T) -= u(x,i) * d_upwind;
+                if (i == j) {
+                    J(c_offset_T, c_offset_U) = -dtdz;
+                }
+            } else if (i == j) {
+                J(c_offset_T, c_offset_T) = 1.0;
+            }
+
+            // lambda
+            if (i == j) {
+                J(c_offset_L, c_offset_L) = 1.0;
+            } else if (i == j + 1) {
+                J(c_offset_L, c_offset_L) = -1.0;
+            }
+        }
+    }
+}
+
+void StFlow::getFluxDerivs(const doublereal* x, size_t m, size_t j,
+                           Array2D& dF)
+{
+    dF.resize(m_nsp, m_nsp + 1);
+    doublereal dz = z(m+1) - z(m);
+    doublereal wtm = m_wtm[j];
+
+    switch (m_transport_option) {
+    case c_Mixav_Transport: {
+        // flux_k = a_k*(X_k(m) - X_k(m+1))/dz - Y_k(m) * sum, where the
+        // coefficients a_k are proportional to rho/wtm = P/(R*T)
+        double sign = (j == m) ? 1.0 : -1.0;
+        double rho = density(m);
+        double sum = 0.0, sumaX = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_jac_work[k] = m_wt[k]*(rho*m_diff[k+m_nsp*m]/m_wtm[m]);
+            sum += m_jac_work[k]*(X(x,k,m) - X(x,k,m+1))/dz;
+            sumaX += m_jac_work[k]*X(x,k,j);
+        }
+        for (size_t k = 0; k < m_nsp; k++) {
+            dF(k,0) = (j == m) ? -m_flux(k,m)/T(x,m) : 0.0;
+        }
+        for (size_t l = 0; l < m_nsp; l++) {
+            // dX_k/dY_l = delta_kl*wtm/W_k - X_k*wtm/W_l
+            double c = sign*wtm/(m_wt[l]*dz);
+            double dsum = c*(m_jac_work[l] - sumaX);
+            for (size_t k = 0; k < m_nsp; k++) {
+                dF(k,l+1) = - c*m_jac_work[k]*X(x,k,j) - Y(x,k,m)*dsum;
+            }
+            dF(l,l+1) += sign*m_jac_work[l]*wtm/(m_wt[l]*dz);
+            if (j == m) {
+                dF(l,l+1) -= sum;
+            }
+        }
+        break;
+    }
+
+    case c_Multi_Transport: {
+        double sign = (j == m) ? -1.0 : 1.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            double sumX = 0.0;
+            for (size_t l = 0; l < m_nsp; l++) {
+                sumX += m_wt[l] * m_multidiff[mindex(k,l,m)] * X(x,l,j);
+            }
+            double c = sign * m_diff[k+m*m_nsp] / dz;
+            dF(k,0) = 0.0;
+            for (size_t l = 0; l < m_nsp; l++) {
+                dF(k,l+1) = c * wtm * (m_multidiff[mindex(k,l,m)]
+                                       - sumX / m_wt[l]);
+            }
+        }
+        break;
+    }
+
+    default:
+        throw CanteraError("getFluxDerivs", "unknown transport model");
+    }
+
+    if (m_do_soret) {
+        doublereal Tsum = T(x,m+1) + T(x,m);
+        doublereal dgradlogT = 4.0 * ((j == m) ? -T(x,m+1) : T(x,m))
+                               / (Tsum * Tsum * dz);
+        for (size_t k = 0; k < m_nsp; k++) {
+            dF(k,0) -= m_dthermal(k,m)*dgradlogT;
+        }
+    }
+}
+
 string StFlow::componentName(size_t n) const
 {
     switch (n) {
@@ -885,6 +1316,19 @@ void AxiStagnFlow::evalContinuity(size_t j, doublereal* x, doublereal* rsd,
     diag[index(c_offset_U, j)] = 0;
 }
 
+void AxiStagnFlow::continuityDerivs(size_t i, size_t j, doublereal& d_rhou,
+                                    doublereal& d_rhoV, doublereal& d_T) const
+{
+    d_rhou = d_rhoV = d_T = 0.0;
+    if (j == i + 1) {
+        d_rhou = -1.0 / m_dz[i];
+        d_rhoV = -1.0;
+    } else if (j == i) {
+        d_rhou = 1.0 / m_dz[i];
+        d_rhoV = -1.0;
+    }
+}
+
 FreeFlame::FreeFlame(IdealGasPhase* ph, size_t nsp, size_t points) :
     StFlow(ph, nsp, points),
     m_zfixed(Undef),
@@ -946,6 +1390,35 @@ void FreeFlame::evalContinuity(size_t j, doublereal* x, doublereal* rsd,
     diag[index(c_offset_U, j)] = 0;
 }
 
+void FreeFlame::continuityDerivs(size_t i, size_t j, doublereal& d_rhou,
+                                 doublereal& d_rhoV, doublereal& d_T) const
+{
+    d_rhou = d_rhoV = d_T = 0.0;
+    if (z(i) > m_zfixed) {
+        if (j == i) {
+            d_rhou = -1.0 / m_dz[i-1];
+            d_rhoV = -1.0;
+        } else if (j + 1 == i) {
+            d_rhou = 1.0 / m_dz[i-1];
+            d_rhoV = -1.0;
+        }
+    } else if (z(i) == m_zfixed) {
+        if (j == i && m_do_energy[i]) {
+            d_T = 1.0;
+        } else if (j == i) {
+            d_rhou = 1.0;
+        }
+    } else if (z(i) < m_zfixed) {
+        if (j == i + 1) {
+            d_rhou = -1.0 / m_dz[i];
+            d_rhoV = -1.0;
+        } else if (j == i) {
+            d_rhou = 1.0 / m_dz[i];
+            d_rhoV = -1.0;
+        }
+    }
+}
+
 void FreeFlame::_finalize(const doublereal* x)
 {
     StFlow::_finalize(x);
@@ -988,4 +1461,22 @@ XML_Node& FreeFlame::save(XML_Node& o, const doublereal* const sol)
     return flow;
 }
 
+void FreeFlame::getAttributes(std::map<std::string, doublereal>& attribs) const
+{
+    if (m_zfixed != Undef) {
+        attribs["z_fixed"] = m_zfixed;
+        attribs["t_fixed"] = m_tfixed;
+    }
+}
+
+void FreeFlame::setAttributes(const std::map<std::string, doublereal>& attribs)
+{
+    auto z = attribs.find("z_fixed");
+    auto t = attribs.find("t_fixed");
+    if (z != attribs.end() && t != attribs.end()) {
+        m_zfixed = z->second;
+        m_tfixed = t->second;
+    }
+}
+
 } // namespace
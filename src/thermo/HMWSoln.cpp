@@ -274,6 +274,7 @@ HMWSoln& HMWSoln::operator=(const HMWSoln& b)
         m_Psi_ijk_LL = b.m_Psi_ijk_LL;
         m_Psi_ijk_P = b.m_Psi_ijk_P;
         m_Psi_ijk_coeff = b.m_Psi_ijk_coeff;
+        m_Psi_ijk_nonzero = b.m_Psi_ijk_nonzero;
         m_Lambda_nj = b.m_Lambda_nj;
         m_Lambda_nj_L = b.m_Lambda_nj_L;
         m_Lambda_nj_LL = b.m_Lambda_nj_LL;
@@ -359,6 +360,9 @@ HMWSoln& HMWSoln::operator=(const HMWSoln& b)
         CROP_ln_gamma_k_max = b.CROP_ln_gamma_k_max;
         CROP_speciesCropped_ = b.CROP_speciesCropped_;
         m_debugCalc = b.m_debugCalc;
+
+        // Cached values in this object may correspond to different parameters
+        m_cache.clear();
     }
     return *this;
 }
@@ -1220,6 +1224,14 @@ void HMWSoln::counterIJ_setup() const
 
 void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
 {
+    // The coefficients depend only on temperature, so they don't need to be
+    // recomputed when only the composition changes.
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature())) {
+        return;
+    }
+
     double T = temperature();
     const double twoT = 2.0 * T;
     const double invT = 1.0 / T;
@@ -1413,52 +1425,39 @@ void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
         }
     }
 
+    // Only the Psi_ijk interactions with nonzero coefficients need to be
+    // updated. The others remain zero.
     switch(m_formPitzerTemp) {
     case PITZER_TEMP_CONSTANT:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0];
-              }
-          }
+      for (size_t n : m_Psi_ijk_nonzero) {
+          const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+          m_Psi_ijk[n] = Psi_coeff[0];
       }
       break;
     case PITZER_TEMP_LINEAR:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0] + Psi_coeff[1]*tlin;
-                  m_Psi_ijk_L[n] = Psi_coeff[1];
-                  m_Psi_ijk_LL[n] = 0.0;
-              }
-          }
+      for (size_t n : m_Psi_ijk_nonzero) {
+          const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+          m_Psi_ijk[n] = Psi_coeff[0] + Psi_coeff[1]*tlin;
+          m_Psi_ijk_L[n] = Psi_coeff[1];
+          m_Psi_ijk_LL[n] = 0.0;
       }
       break;
     case PITZER_TEMP_COMPLEX1:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0]
-                                 + Psi_coeff[1]*tlin
-                                 + Psi_coeff[2]*tquad
-                                 + Psi_coeff[3]*tinv
-                                 + Psi_coeff[4]*tln;
-                  m_Psi_ijk_L[n] = Psi_coeff[1]
-                                   + Psi_coeff[2]*twoT
-                                   - Psi_coeff[3]*invT2
-                                   + Psi_coeff[4]*invT;
-                  m_Psi_ijk_LL[n] =
-                      Psi_coeff[2]*2.0
-                      + Psi_coeff[3]*twoinvT3
-                      - Psi_coeff[4]*invT2;
-              }
-          }
+      for (size_t n : m_Psi_ijk_nonzero) {
+          const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+          m_Psi_ijk[n] = Psi_coeff[0]
+                         + Psi_coeff[1]*tlin
+                         + Psi_coeff[2]*tquad
+                         + Psi_coeff[3]*tinv
+                         + Psi_coeff[4]*tln;
+          m_Psi_ijk_L[n] = Psi_coeff[1]
+                           + Psi_coeff[2]*twoT
+                           - Psi_coeff[3]*invT2
+                           + Psi_coeff[4]*invT;
+          m_Psi_ijk_LL[n] =
+              Psi_coeff[2]*2.0
+              + Psi_coeff[3]*twoinvT3
+              - Psi_coeff[4]*invT2;
       }
       break;
     }
@@ -1537,44 +1536,12 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
              " Species          Species            g(x)  hfunc(x)\n",
              m_debugCalc);
 
-    // calculate g(x) and hfunc(x) for each cation-anion pair MX. In the
-    // original literature, hfunc, was called gprime. However, it's not the
-    // derivative of g(x), so I renamed it.
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // Only loop over oppositely charge species
-            if (charge(i)*charge(j) < 0) {
-                // x is a reduced function variable
-                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
-                if (x1 > 1.0E-100) {
-                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    m_hfunc_IJ[counterIJ] = -2.0 *
-                                       (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    m_gfunc_IJ[counterIJ] = 0.0;
-                    m_hfunc_IJ[counterIJ] = 0.0;
-                }
-
-                if (m_Beta2MX_ij[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        m_h2func_IJ[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        m_g2func_IJ[counterIJ] = 0.0;
-                        m_h2func_IJ[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                m_gfunc_IJ[counterIJ] = 0.0;
-                m_hfunc_IJ[counterIJ] = 0.0;
-            }
-            if (m_debugCalc) {
+    // calculate g(x) and hfunc(x) for each cation-anion pair MX
+    calc_gfuncs(Is);
+    if (m_debugCalc) {
+        for (size_t i = 1; i < (m_kk - 1); i++) {
+            for (size_t j = (i+1); j < m_kk; j++) {
+                size_t counterIJ = m_CounterIJ[m_kk*i + j];
                 writelogf(" %-16s %-16s %9.5f %9.5f \n", speciesName(i),
                           speciesName(j), m_gfunc_IJ[counterIJ], m_hfunc_IJ[counterIJ]);
             }
@@ -2264,47 +2231,13 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
              m_debugCalc);
 
     // calculate g(x) and hfunc(x) for each cation-anion pair MX
-    // In the original literature, hfunc, was called gprime. However,
-    // it's not the derivative of g(x), so I renamed it.
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // Only loop over oppositely charge species
-            if (charge(i)*charge(j) < 0) {
-                // x is a reduced function variable
-                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
-                if (x1 > 1.0E-100) {
-                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    m_hfunc_IJ[counterIJ] = -2.0 *
-                                       (1.0-(1.0 + x1 + 0.5 * x1 *x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    m_gfunc_IJ[counterIJ] = 0.0;
-                    m_hfunc_IJ[counterIJ] = 0.0;
-                }
-
-                if (m_Beta2MX_ij_L[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        m_h2func_IJ[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        m_g2func_IJ[counterIJ] = 0.0;
-                        m_h2func_IJ[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                m_gfunc_IJ[counterIJ] = 0.0;
-                m_hfunc_IJ[counterIJ] = 0.0;
-            }
-            if (m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                writelogf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                          m_gfunc_IJ[counterIJ], m_hfunc_IJ[counterIJ]);
+    calc_gfuncs(Is);
+    if (m_debugCalc) {
+        for (size_t i = 1; i < (m_kk - 1); i++) {
+            for (size_t j = (i+1); j < m_kk; j++) {
+                size_t counterIJ = m_CounterIJ[m_kk*i + j];
+                writelogf(" %-16s %-16s %9.5f %9.5f \n", speciesName(i),
+                          speciesName(j), m_gfunc_IJ[counterIJ], m_hfunc_IJ[counterIJ]);
             }
         }
     }
@@ -2872,46 +2805,14 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
              " Species          Species            g(x)  hfunc(x)   \n",
              m_debugCalc);
 
-    // calculate gfunc(x) and hfunc(x) for each cation-anion pair MX. In the
-    // original literature, hfunc, was called gprime. However, it's not the
-    // derivative of gfunc(x), so I renamed it.
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // Only loop over oppositely charge species
-            if (charge(i)*charge(j) < 0) {
-                // x is a reduced function variable
-                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
-                if (x1 > 1.0E-100) {
-                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 *x1);
-                    m_hfunc_IJ[counterIJ] = -2.0*
-                                       (1.0-(1.0 + x1 + 0.5*x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    m_gfunc_IJ[counterIJ] = 0.0;
-                    m_hfunc_IJ[counterIJ] = 0.0;
-                }
-
-                if (m_Beta2MX_ij_LL[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        m_h2func_IJ[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        m_g2func_IJ[counterIJ] = 0.0;
-                        m_h2func_IJ[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                m_gfunc_IJ[counterIJ] = 0.0;
-                m_hfunc_IJ[counterIJ] = 0.0;
-            }
-            if (m_debugCalc) {
-                writelogf(" %-16s %-16s %9.5f %9.5f \n", speciesName(i), speciesName(j),
-                          m_gfunc_IJ[counterIJ], m_hfunc_IJ[counterIJ]);
+    // calculate g(x) and hfunc(x) for each cation-anion pair MX
+    calc_gfuncs(Is);
+    if (m_debugCalc) {
+        for (size_t i = 1; i < (m_kk - 1); i++) {
+            for (size_t j = (i+1); j < m_kk; j++) {
+                size_t counterIJ = m_CounterIJ[m_kk*i + j];
+                writelogf(" %-16s %-16s %9.5f %9.5f \n", speciesName(i),
+                          speciesName(j), m_gfunc_IJ[counterIJ], m_hfunc_IJ[counterIJ]);
             }
         }
     }
@@ -3478,43 +3379,11 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
              m_debugCalc);
 
     // calculate g(x) and hfunc(x) for each cation-anion pair MX
-    // In the original literature, hfunc, was called gprime. However,
-    // it's not the derivative of g(x), so I renamed it.
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            // Find the counterIJ for the symmetric binary interaction
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            // Only loop over oppositely charge species
-            if (charge(i)*charge(j) < 0) {
-                // x is a reduced function variable
-                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
-                if (x1 > 1.0E-100) {
-                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    m_hfunc_IJ[counterIJ] = -2.0*
-                                       (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    m_gfunc_IJ[counterIJ] = 0.0;
-                    m_hfunc_IJ[counterIJ] = 0.0;
-                }
-
-                if (m_Beta2MX_ij_P[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        m_h2func_IJ[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        m_g2func_IJ[counterIJ] = 0.0;
-                        m_h2func_IJ[counterIJ] = 0.0;
-                    }
-                }
-            } else {
-                m_gfunc_IJ[counterIJ] = 0.0;
-                m_hfunc_IJ[counterIJ] = 0.0;
-            }
-            if (m_debugCalc) {
+    calc_gfuncs(Is);
+    if (m_debugCalc) {
+        for (size_t i = 1; i < (m_kk - 1); i++) {
+            for (size_t j = (i+1); j < m_kk; j++) {
+                size_t counterIJ = m_CounterIJ[m_kk*i + j];
                 writelogf(" %-16s %-16s %9.5f %9.5f \n", speciesName(i),
                           speciesName(j), m_gfunc_IJ[counterIJ], m_hfunc_IJ[counterIJ]);
             }
@@ -4060,6 +3929,60 @@ void HMWSoln::calc_thetas(int z1, int z2,
     }
 }
 
+void HMWSoln::calc_gfuncs(double is) const
+{
+    // The functions depend only on the ionic strength. The set of pairs for
+    // which g2(x2) is needed depends on the temperature through the Beta2
+    // coefficients.
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(is, temperature())) {
+        return;
+    }
+
+    // In the original literature, hfunc, was called gprime. However, it's not
+    // the derivative of g(x), so I renamed it.
+    double sqrtIs = sqrt(is);
+    for (size_t i = 1; i < (m_kk - 1); i++) {
+        for (size_t j = (i+1); j < m_kk; j++) {
+            // Find the counterIJ for the symmetric binary interaction
+            size_t counterIJ = m_CounterIJ[m_kk*i + j];
+
+            // Only loop over oppositely charge species
+            if (charge(i)*charge(j) < 0) {
+                // x is a reduced function variable
+                double x1 = sqrtIs * m_Alpha1MX_ij[counterIJ];
+                if (x1 > 1.0E-100) {
+                    m_gfunc_IJ[counterIJ] = 2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
+                    m_hfunc_IJ[counterIJ] = -2.0 *
+                                       (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
+                } else {
+                    m_gfunc_IJ[counterIJ] = 0.0;
+                    m_hfunc_IJ[counterIJ] = 0.0;
+                }
+
+                if (m_Beta2MX_ij[counterIJ] != 0.0 ||
+                    m_Beta2MX_ij_L[counterIJ] != 0.0 ||
+                    m_Beta2MX_ij_LL[counterIJ] != 0.0 ||
+                    m_Beta2MX_ij_P[counterIJ] != 0.0) {
+                    double x2 = sqrtIs * m_Alpha2MX_ij[counterIJ];
+                    if (x2 > 1.0E-100) {
+                        m_g2func_IJ[counterIJ] = 2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
+                        m_h2func_IJ[counterIJ] = -2.0 *
+                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
+                    } else {
+                        m_g2func_IJ[counterIJ] = 0.0;
+                        m_h2func_IJ[counterIJ] = 0.0;
+                    }
+                }
+            } else {
+                m_gfunc_IJ[counterIJ] = 0.0;
+                m_hfunc_IJ[counterIJ] = 0.0;
+            }
+        }
+    }
+}
+
 void HMWSoln::s_updateIMS_lnMolalityActCoeff() const
 {
     // Calculate the molalities. Currently, the molalities may not be current
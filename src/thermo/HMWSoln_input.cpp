@@ -1441,6 +1441,21 @@ void HMWSoln::initThermoXML(XML_Node& phaseNode, const std::string& id_)
         }
     }
 
+    // Make a list of the Psi_ijk interactions that are actually used
+    m_Psi_ijk_nonzero.clear();
+    for (size_t n = 0; n < m_Psi_ijk_coeff.nColumns(); n++) {
+        for (size_t j = 0; j < m_Psi_ijk_coeff.nRows(); j++) {
+            if (m_Psi_ijk_coeff(j, n) != 0.0) {
+                m_Psi_ijk_nonzero.push_back(n);
+                break;
+            }
+        }
+    }
+
+    // Temperature-dependent coefficients may have been computed with
+    // incomplete parameters
+    m_cache.clear();
+
     IMS_typeCutoff_ = 2;
     if (IMS_typeCutoff_ == 2) {
         calcIMSCutoffParams_();
@@ -128,6 +128,7 @@ IonsFromNeutralVPSSTP::operator=(const IonsFromNeutralVPSSTP& b)
     dlnActCoeffdlnX_diag_NeutralMolecule_ = b.dlnActCoeffdlnX_diag_NeutralMolecule_;
     dlnActCoeffdlnN_diag_NeutralMolecule_ = b.dlnActCoeffdlnN_diag_NeutralMolecule_;
     dlnActCoeffdlnN_NeutralMolecule_ = b.dlnActCoeffdlnN_NeutralMolecule_;
+    m_cache.clear();
 
     return *this;
 }
@@ -270,7 +271,7 @@ void IonsFromNeutralVPSSTP::getDissociationCoeffs(vector_fp& coeffs,
 void IonsFromNeutralVPSSTP::getActivityCoefficients(doublereal* ac) const
 {
     // Update the activity coefficients
-    s_update_lnActCoeff();
+    s_update_lnActCoeff_all();
 
     // take the exp of the internally stored coefficients.
     for (size_t k = 0; k < m_kk; k++) {
@@ -293,7 +294,7 @@ void IonsFromNeutralVPSSTP::getChemPotentials(doublereal* mu) const
         neutralMoleculePhase_->getChemPotentials(mu);
         break;
     case cIonSolnType_SINGLEANION:
-        neutralMoleculePhase_->getLnActivityCoefficients(lnActCoeff_NeutralMolecule_.data());
+        s_update_lnActCoeff_all();
         fact2 = 2.0 * RT() * log(2.0);
 
         // Do the cation list
@@ -344,8 +345,7 @@ void IonsFromNeutralVPSSTP::getPartialMolarEnthalpies(doublereal* hbar) const
 
     // Update the activity coefficients, This also update the internally stored
     // molalities.
-    s_update_lnActCoeff();
-    s_update_dlnActCoeffdT();
+    s_update_lnActCoeff_all();
     for (size_t k = 0; k < m_kk; k++) {
         hbar[k] -= RT() * temperature() * dlnActCoeffdT_Scaled_[k];
     }
@@ -358,8 +358,7 @@ void IonsFromNeutralVPSSTP::getPartialMolarEntropies(doublereal* sbar) const
 
     // Update the activity coefficients, This also update the internally stored
     // molalities.
-    s_update_lnActCoeff();
-    s_update_dlnActCoeffdT();
+    s_update_lnActCoeff_all();
 
     for (size_t k = 0; k < m_kk; k++) {
         double xx = std::max(moleFractions_[k], SmallNumber);
@@ -374,8 +373,7 @@ void IonsFromNeutralVPSSTP::getPartialMolarEntropies(doublereal* sbar) const
 
 void IonsFromNeutralVPSSTP::getdlnActCoeffdlnX_diag(doublereal* dlnActCoeffdlnX_diag) const
 {
-    s_update_lnActCoeff();
-    s_update_dlnActCoeff_dlnX_diag();
+    s_update_lnActCoeff_all();
 
     for (size_t k = 0; k < m_kk; k++) {
         dlnActCoeffdlnX_diag[k] = dlnActCoeffdlnX_diag_[k];
@@ -384,8 +382,7 @@ void IonsFromNeutralVPSSTP::getdlnActCoeffdlnX_diag(doublereal* dlnActCoeffdlnX_
 
 void IonsFromNeutralVPSSTP::getdlnActCoeffdlnN_diag(doublereal* dlnActCoeffdlnN_diag) const
 {
-    s_update_lnActCoeff();
-    s_update_dlnActCoeff_dlnN_diag();
+    s_update_lnActCoeff_all();
 
     for (size_t k = 0; k < m_kk; k++) {
         dlnActCoeffdlnN_diag[k] = dlnActCoeffdlnN_diag_[k];
@@ -394,7 +391,7 @@ void IonsFromNeutralVPSSTP::getdlnActCoeffdlnN_diag(doublereal* dlnActCoeffdlnN_
 
 void IonsFromNeutralVPSSTP::getdlnActCoeffdlnN(const size_t ld, doublereal* dlnActCoeffdlnN)
 {
-    s_update_lnActCoeff();
+    s_update_lnActCoeff_all();
     s_update_dlnActCoeff_dlnN();
     double* data =  & dlnActCoeffdlnN_(0,0);
     for (size_t k = 0; k < m_kk; k++) {
@@ -865,11 +862,30 @@ void IonsFromNeutralVPSSTP::initThermoXML(XML_Node& phaseNode, const std::string
     GibbsExcessVPSSTP::initThermoXML(phaseNode, id_);
 }
 
-void IonsFromNeutralVPSSTP::s_update_lnActCoeff() const
+void IonsFromNeutralVPSSTP::s_update_lnActCoeff_all() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
+
     size_t icat, jNeut;
-    // Get the activity coefficiens of the neutral molecules
+    // Get the activity coefficients of the neutral molecules, and their
+    // derivatives if the neutral molecule phase provides them
     neutralMoleculePhase_->getLnActivityCoefficients(lnActCoeff_NeutralMolecule_.data());
+    if (geThermo) {
+        geThermo->getdlnActCoeffdT(dlnActCoeffdT_NeutralMolecule_.data());
+        geThermo->getdlnActCoeffdlnX_diag(dlnActCoeffdlnX_diag_NeutralMolecule_.data());
+        geThermo->getdlnActCoeffdlnN_diag(dlnActCoeffdlnN_diag_NeutralMolecule_.data());
+    } else {
+        dlnActCoeffdT_NeutralMolecule_.assign(numNeutralMoleculeSpecies_, 0.0);
+        dlnActCoeffdlnX_diag_NeutralMolecule_.assign(numNeutralMoleculeSpecies_, 0.0);
+        dlnActCoeffdlnN_diag_NeutralMolecule_.assign(numNeutralMoleculeSpecies_, 0.0);
+        dlnActCoeffdT_Scaled_.assign(m_kk, 0.0);
+        dlnActCoeffdlnX_diag_.assign(m_kk, 0.0);
+        dlnActCoeffdlnN_diag_.assign(m_kk, 0.0);
+    }
 
     switch (ionSolnType_) {
     case cIonSolnType_PASSTHROUGH:
@@ -882,29 +898,37 @@ void IonsFromNeutralVPSSTP::s_update_lnActCoeff() const
             jNeut = fm_invert_ionForNeutral[icat];
             double fmij = fm_neutralMolec_ions_[icat + jNeut * m_kk];
             lnActCoeff_Scaled_[icat] = lnActCoeff_NeutralMolecule_[jNeut] / fmij;
+            dlnActCoeffdT_Scaled_[icat] = dlnActCoeffdT_NeutralMolecule_[jNeut] / fmij;
+            dlnActCoeffdlnX_diag_[icat] = dlnActCoeffdlnX_diag_NeutralMolecule_[jNeut] / fmij;
+            dlnActCoeffdlnN_diag_[icat] = dlnActCoeffdlnN_diag_NeutralMolecule_[jNeut] / fmij;
         }
 
         // Do the anion list
         icat = anionList_[0];
-        jNeut = fm_invert_ionForNeutral[icat];
-        lnActCoeff_Scaled_[icat]= 0.0;
+        lnActCoeff_Scaled_[icat] = 0.0;
+        dlnActCoeffdT_Scaled_[icat] = 0.0;
+        dlnActCoeffdlnX_diag_[icat] = 0.0;
+        dlnActCoeffdlnN_diag_[icat] = 0.0;
 
         // Do the list of neutral molecules
         for (size_t k = 0; k < passThroughList_.size(); k++) {
             icat = passThroughList_[k];
             jNeut = fm_invert_ionForNeutral[icat];
             lnActCoeff_Scaled_[icat] = lnActCoeff_NeutralMolecule_[jNeut];
+            dlnActCoeffdT_Scaled_[icat] = dlnActCoeffdT_NeutralMolecule_[jNeut];
+            dlnActCoeffdlnX_diag_[icat] = dlnActCoeffdlnX_diag_NeutralMolecule_[jNeut];
+            dlnActCoeffdlnN_diag_[icat] = dlnActCoeffdlnN_diag_NeutralMolecule_[jNeut];
         }
         break;
 
     case cIonSolnType_SINGLECATION:
-        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeff", "Unimplemented type");
+        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeff_all", "Unimplemented type");
         break;
     case cIonSolnType_MULTICATIONANION:
-        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeff", "Unimplemented type");
+        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeff_all", "Unimplemented type");
         break;
     default:
-        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeff", "Unimplemented type");
+        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeff_all", "Unimplemented type");
         break;
     }
 }
@@ -964,156 +988,6 @@ void IonsFromNeutralVPSSTP::getdlnActCoeffds(const doublereal dTds, const double
     }
 }
 
-void IonsFromNeutralVPSSTP::s_update_dlnActCoeffdT() const
-{
-    size_t icat, jNeut;
-
-    // Get the activity coefficients of the neutral molecules
-    if (!geThermo) {
-        dlnActCoeffdT_Scaled_.assign(m_kk, 0.0);
-        return;
-    }
-
-    geThermo->getdlnActCoeffdT(dlnActCoeffdT_NeutralMolecule_.data());
-
-    switch (ionSolnType_) {
-    case cIonSolnType_PASSTHROUGH:
-        break;
-    case cIonSolnType_SINGLEANION:
-        // Do the cation list
-        for (size_t k = 0; k < cationList_.size(); k++) {
-            //! Get the id for the next cation
-            icat = cationList_[k];
-            jNeut = fm_invert_ionForNeutral[icat];
-            double fmij = fm_neutralMolec_ions_[icat + jNeut * m_kk];
-            dlnActCoeffdT_Scaled_[icat] = dlnActCoeffdT_NeutralMolecule_[jNeut]/fmij;
-        }
-
-        // Do the anion list
-        icat = anionList_[0];
-        jNeut = fm_invert_ionForNeutral[icat];
-        dlnActCoeffdT_Scaled_[icat]= 0.0;
-
-        // Do the list of neutral molecules
-        for (size_t k = 0; k < passThroughList_.size(); k++) {
-            icat = passThroughList_[k];
-            jNeut = fm_invert_ionForNeutral[icat];
-            dlnActCoeffdT_Scaled_[icat] = dlnActCoeffdT_NeutralMolecule_[jNeut];
-        }
-        break;
-
-    case cIonSolnType_SINGLECATION:
-        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeffdT", "Unimplemented type");
-        break;
-    case cIonSolnType_MULTICATIONANION:
-        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeffdT", "Unimplemented type");
-        break;
-    default:
-        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeffdT", "Unimplemented type");
-        break;
-    }
-}
-
-void IonsFromNeutralVPSSTP::s_update_dlnActCoeff_dlnX_diag() const
-{
-    size_t icat, jNeut;
-
-    // Get the activity coefficients of the neutral molecules
-    if (!geThermo) {
-        dlnActCoeffdlnX_diag_.assign(m_kk, 0.0);
-        return;
-    }
-
-    geThermo->getdlnActCoeffdlnX_diag(dlnActCoeffdlnX_diag_NeutralMolecule_.data());
-
-    switch (ionSolnType_) {
-    case cIonSolnType_PASSTHROUGH:
-        break;
-    case cIonSolnType_SINGLEANION:
-        // Do the cation list
-        for (size_t k = 0; k < cationList_.size(); k++) {
-            // Get the id for the next cation
-            icat = cationList_[k];
-            jNeut = fm_invert_ionForNeutral[icat];
-            double fmij = fm_neutralMolec_ions_[icat + jNeut * m_kk];
-            dlnActCoeffdlnX_diag_[icat] = dlnActCoeffdlnX_diag_NeutralMolecule_[jNeut]/fmij;
-        }
-
-        // Do the anion list
-        icat = anionList_[0];
-        jNeut = fm_invert_ionForNeutral[icat];
-        dlnActCoeffdlnX_diag_[icat]= 0.0;
-
-        // Do the list of neutral molecules
-        for (size_t k = 0; k < passThroughList_.size(); k++) {
-            icat = passThroughList_[k];
-            jNeut = fm_invert_ionForNeutral[icat];
-            dlnActCoeffdlnX_diag_[icat] = dlnActCoeffdlnX_diag_NeutralMolecule_[jNeut];
-        }
-        break;
-
-    case cIonSolnType_SINGLECATION:
-        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeff_dlnX_diag()", "Unimplemented type");
-        break;
-    case cIonSolnType_MULTICATIONANION:
-        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeff_dlnX_diag()", "Unimplemented type");
-        break;
-    default:
-        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeff_dlnX_diag()", "Unimplemented type");
-        break;
-    }
-}
-
-void IonsFromNeutralVPSSTP::s_update_dlnActCoeff_dlnN_diag() const
-{
-    size_t icat, jNeut;
-
-    // Get the activity coefficients of the neutral molecules
-    if (!geThermo) {
-        dlnActCoeffdlnN_diag_.assign(m_kk, 0.0);
-        return;
-    }
-
-    geThermo->getdlnActCoeffdlnN_diag(dlnActCoeffdlnN_diag_NeutralMolecule_.data());
-
-    switch (ionSolnType_) {
-    case cIonSolnType_PASSTHROUGH:
-        break;
-    case cIonSolnType_SINGLEANION:
-        // Do the cation list
-        for (size_t k = 0; k < cationList_.size(); k++) {
-            // Get the id for the next cation
-            icat = cationList_[k];
-            jNeut = fm_invert_ionForNeutral[icat];
-            double fmij = fm_neutralMolec_ions_[icat + jNeut * m_kk];
-            dlnActCoeffdlnN_diag_[icat] = dlnActCoeffdlnN_diag_NeutralMolecule_[jNeut]/fmij;
-        }
-
-        // Do the anion list
-        icat = anionList_[0];
-        jNeut = fm_invert_ionForNeutral[icat];
-        dlnActCoeffdlnN_diag_[icat]= 0.0;
-
-        // Do the list of neutral molecules
-        for (size_t k = 0; k < passThroughList_.size(); k++) {
-            icat = passThroughList_[k];
-            jNeut = fm_invert_ionForNeutral[icat];
-            dlnActCoeffdlnN_diag_[icat] = dlnActCoeffdlnN_diag_NeutralMolecule_[jNeut];
-        }
-        break;
-
-    case cIonSolnType_SINGLECATION:
-        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeff_dlnN_diag()", "Unimplemented type");
-        break;
-    case cIonSolnType_MULTICATIONANION:
-        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeff_dlnN_diag()", "Unimplemented type");
-        break;
-    default:
-        throw CanteraError("IonsFromNeutralVPSSTP::s_update_lnActCoeff_dlnN_diag()", "Unimplemented type");
-        break;
-    }
-}
-
 void IonsFromNeutralVPSSTP::s_update_dlnActCoeff_dlnN() const
 {
     size_t kcat = 0, kNeut = 0, mcat = 0, mNeut = 0;
@@ -1167,7 +1041,7 @@ void IonsFromNeutralVPSSTP::s_update_dlnActCoeff_dlnN() const
             kNeut = fm_invert_ionForNeutral[kcat];
             dlnActCoeffdlnN_diag_[kcat] = dlnActCoeffdlnN_diag_NeutralMolecule_[kNeut];
 
-            for (size_t m = 0; m < m_kk; m++) {
+            for (size_t m = 0; m < passThroughList_.size(); m++) {
                 mcat = passThroughList_[m];
                 mNeut = fm_invert_ionForNeutral[mcat];
                 dlnActCoeffdlnN_(kcat, mcat) = dlnActCoeffdlnN_NeutralMolecule_(kNeut, mNeut);
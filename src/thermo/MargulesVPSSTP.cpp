@@ -72,6 +72,7 @@ MargulesVPSSTP& MargulesVPSSTP::operator=(const MargulesVPSSTP& b)
     m_pSpecies_B_ij = b.m_pSpecies_B_ij;
     formMargules_ = b.formMargules_;
     formTempModel_ = b.formTempModel_;
+    m_cache.clear();
 
     return *this;
 }
@@ -86,7 +87,7 @@ ThermoPhase* MargulesVPSSTP::duplMyselfAsThermoPhase() const
 void MargulesVPSSTP::getLnActivityCoefficients(doublereal* lnac) const
 {
     // Update the activity coefficients
-    s_update_lnActCoeff();
+    s_update_lnActCoeff_all();
 
     // take the exp of the internally stored coefficients.
     for (size_t k = 0; k < m_kk; k++) {
@@ -112,7 +113,7 @@ void MargulesVPSSTP::getChemPotentials(doublereal* mu) const
     getStandardChemPotentials(mu);
 
     // Update the activity coefficients
-    s_update_lnActCoeff();
+    s_update_lnActCoeff_all();
     for (size_t k = 0; k < m_kk; k++) {
         double xx = std::max(moleFractions_[k], SmallNumber);
         mu[k] += RT() * (log(xx) + lnActCoeff_Scaled_[k]);
@@ -172,8 +173,7 @@ void MargulesVPSSTP::getPartialMolarEnthalpies(doublereal* hbar) const
 
     // Update the activity coefficients, This also update the internally stored
     // molalities.
-    s_update_lnActCoeff();
-    s_update_dlnActCoeff_dT();
+    s_update_lnActCoeff_all();
     for (size_t k = 0; k < m_kk; k++) {
         hbar[k] -= RT() * temperature() * dlnActCoeffdT_Scaled_[k];
     }
@@ -187,8 +187,7 @@ void MargulesVPSSTP::getPartialMolarCp(doublereal* cpbar) const
 
     // Update the activity coefficients, This also update the internally stored
     // molalities.
-    s_update_lnActCoeff();
-    s_update_dlnActCoeff_dT();
+    s_update_lnActCoeff_all();
 
     for (size_t k = 0; k < m_kk; k++) {
         cpbar[k] -= 2 * T * dlnActCoeffdT_Scaled_[k] + T * T * d2lnActCoeffdT2_Scaled_[k];
@@ -207,8 +206,7 @@ void MargulesVPSSTP::getPartialMolarEntropies(doublereal* sbar) const
 
     // Update the activity coefficients, This also update the internally stored
     // molalities.
-    s_update_lnActCoeff();
-    s_update_dlnActCoeff_dT();
+    s_update_lnActCoeff_all();
 
     for (size_t k = 0; k < m_kk; k++) {
         double xx = std::max(moleFractions_[k], SmallNumber);
@@ -300,65 +298,95 @@ void MargulesVPSSTP::initThermoXML(XML_Node& phaseNode, const std::string& id_)
             }
         }
     }
+    // The interaction parameters have changed, so any cached activity
+    // coefficients are invalid
+    m_cache.clear();
 
     // Go down the chain
     GibbsExcessVPSSTP::initThermoXML(phaseNode, id_);
 }
 
-void MargulesVPSSTP::s_update_lnActCoeff() const
+void MargulesVPSSTP::s_update_lnActCoeff_all() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), stateMFNumber())) {
+        return;
+    }
+
     double T = temperature();
+    double invT = 1.0 / T;
+    double invRTT = 1.0 / GasConstant*invT*invT;
     lnActCoeff_Scaled_.assign(m_kk, 0.0);
+    dlnActCoeffdT_Scaled_.assign(m_kk, 0.0);
+    dlnActCoeffdlnX_diag_.assign(m_kk, 0.0);
+    dlnActCoeffdlnN_.zero();
+
+    // Each binary term contributes a value that is common to all species,
+    // which is accumulated separately and added once at the end. Similarly,
+    // the matrix of derivatives wrt log(moles) is split into
+    //     dlnActCoeffdlnN(k,m) = X_m * (C + u_k + u_m + P_km)
+    // where C is a constant, u is a vector, and P has only a few entries for
+    // each binary term.
+    double all = 0.0;
+    double allT = 0.0;
+    double C = 0.0;
+    vector_fp u(m_kk, 0.0);
     for (size_t i = 0; i < numBinaryInteractions_; i++) {
         size_t iA = m_pSpecies_A_ij[i];
         size_t iB = m_pSpecies_B_ij[i];
-        double g0 = (m_HE_b_ij[i] - T * m_SE_b_ij[i]) / RT();
-        double g1 = (m_HE_c_ij[i] - T * m_SE_c_ij[i]) / RT();
         double XA = moleFractions_[iA];
         double XB = moleFractions_[iB];
-        const doublereal XAXB = XA * XB;
-        const doublereal g0g1XB = (g0 + g1 * XB);
-        const doublereal all = -1.0 * XAXB * g0g1XB - XAXB * XB * g1;
-        for (size_t iK = 0; iK < m_kk; iK++) {
-            lnActCoeff_Scaled_[iK] += all;
-        }
+        double XAXB = XA * XB;
+        double g0 = (m_HE_b_ij[i] - T * m_SE_b_ij[i]) / RT();
+        double g1 = (m_HE_c_ij[i] - T * m_SE_c_ij[i]) / RT();
+        double h0 = -m_HE_b_ij[i] * invRTT;
+        double h1 = -m_HE_c_ij[i] * invRTT;
+
+        // Activity coefficients
+        double g0g1XB = g0 + g1 * XB;
+        all += -1.0 * XAXB * g0g1XB - XAXB * XB * g1;
         lnActCoeff_Scaled_[iA] += XB * g0g1XB;
         lnActCoeff_Scaled_[iB] += XA * g0g1XB + XAXB * g1;
+
+        // Temperature derivatives
+        double h0h1XB = h0 + h1 * XB;
+        allT += -1.0 * XAXB * h0h1XB - XAXB * XB * h1;
+        dlnActCoeffdT_Scaled_[iA] += XB * h0h1XB;
+        dlnActCoeffdT_Scaled_[iB] += XA * h0h1XB + XAXB * h1;
+
+        // Derivatives wrt log(mole fractions)
+        dlnActCoeffdlnX_diag_[iA] += XAXB*(2*g1*-2*g0-6*g1*XB);
+        dlnActCoeffdlnX_diag_[iB] += XAXB*(2*g1*-2*g0-6*g1*XB);
+
+        // Derivatives wrt log(moles)
+        double c1 = g0 + 2 * g1 * XB;
+        double c2 = 2 * g1 * XA;
+        C += 2 * c1 * XAXB + c2 * XB * XB;
+        u[iA] -= c1 * XB;
+        u[iB] -= c1 * XA + c2 * XB;
+        dlnActCoeffdlnN_(iA, iB) += c1;
+        dlnActCoeffdlnN_(iB, iA) += c1;
+        dlnActCoeffdlnN_(iB, iB) += c2;
     }
-}
 
-void MargulesVPSSTP::s_update_dlnActCoeff_dT() const
-{
-    doublereal invT = 1.0 / temperature();
-    doublereal invRTT = 1.0 / GasConstant*invT*invT;
-    dlnActCoeffdT_Scaled_.assign(m_kk, 0.0);
-    d2lnActCoeffdT2_Scaled_.assign(m_kk, 0.0);
-    for (size_t i = 0; i < numBinaryInteractions_; i++) {
-        size_t iA = m_pSpecies_A_ij[i];
-        size_t iB = m_pSpecies_B_ij[i];
-        double XA = moleFractions_[iA];
-        double XB = moleFractions_[iB];
-        double g0 = -m_HE_b_ij[i] * invRTT;
-        double g1 = -m_HE_c_ij[i] * invRTT;
-        const doublereal XAXB = XA * XB;
-        const doublereal g0g1XB = (g0 + g1 * XB);
-        const doublereal all = -1.0 * XAXB * g0g1XB - XAXB * XB * g1;
-        const doublereal mult = 2.0 * invT;
-        const doublereal dT2all = mult * all;
-        for (size_t iK = 0; iK < m_kk; iK++) {
-            dlnActCoeffdT_Scaled_[iK] += all;
-            d2lnActCoeffdT2_Scaled_[iK] -= dT2all;
+    for (size_t k = 0; k < m_kk; k++) {
+        lnActCoeff_Scaled_[k] += all;
+        dlnActCoeffdT_Scaled_[k] += allT;
+        d2lnActCoeffdT2_Scaled_[k] = -2.0 * invT * dlnActCoeffdT_Scaled_[k];
+    }
+    for (size_t m = 0; m < m_kk; m++) {
+        for (size_t k = 0; k < m_kk; k++) {
+            dlnActCoeffdlnN_(k,m) = moleFractions_[m] *
+                (dlnActCoeffdlnN_(k,m) + C + u[k] + u[m]);
         }
-        dlnActCoeffdT_Scaled_[iA] += XB * g0g1XB;
-        dlnActCoeffdT_Scaled_[iB] += XA * g0g1XB + XAXB * g1;
-        d2lnActCoeffdT2_Scaled_[iA] -= mult * XB * g0g1XB;
-        d2lnActCoeffdT2_Scaled_[iB] -= mult * (XA * g0g1XB + XAXB * g1);
+        dlnActCoeffdlnN_diag_[m] = dlnActCoeffdlnN_(m,m);
     }
 }
 
 void MargulesVPSSTP::getdlnActCoeffdT(doublereal* dlnActCoeffdT) const
 {
-    s_update_dlnActCoeff_dT();
+    s_update_lnActCoeff_all();
     for (size_t k = 0; k < m_kk; k++) {
         dlnActCoeffdT[k] = dlnActCoeffdT_Scaled_[k];
     }
@@ -366,7 +394,7 @@ void MargulesVPSSTP::getdlnActCoeffdT(doublereal* dlnActCoeffdT) const
 
 void MargulesVPSSTP::getd2lnActCoeffdT2(doublereal* d2lnActCoeffdT2) const
 {
-    s_update_dlnActCoeff_dT();
+    s_update_lnActCoeff_all();
     for (size_t k = 0; k < m_kk; k++) {
         d2lnActCoeffdT2[k] = d2lnActCoeffdT2_Scaled_[k];
     }
@@ -376,7 +404,7 @@ void MargulesVPSSTP::getdlnActCoeffds(const doublereal dTds, const doublereal* c
                                        doublereal* dlnActCoeffds) const
 {
     double T = temperature();
-    s_update_dlnActCoeff_dT();
+    s_update_lnActCoeff_all();
     for (size_t iK = 0; iK < m_kk; iK++) {
         dlnActCoeffds[iK] = 0.0;
     }
@@ -401,100 +429,9 @@ void MargulesVPSSTP::getdlnActCoeffds(const doublereal dTds, const doublereal* c
     }
 }
 
-void MargulesVPSSTP::s_update_dlnActCoeff_dlnN_diag() const
-{
-    double T = temperature();
-    dlnActCoeffdlnN_diag_.assign(m_kk, 0.0);
-
-    for (size_t iK = 0; iK < m_kk; iK++) {
-        double XK = moleFractions_[iK];
-
-        for (size_t i = 0; i < numBinaryInteractions_; i++) {
-            size_t iA = m_pSpecies_A_ij[i];
-            size_t iB = m_pSpecies_B_ij[i];
-            size_t delAK = 0;
-            size_t delBK = 0;
-
-            if (iA==iK) {
-                delAK = 1;
-            } else if (iB==iK) {
-                delBK = 1;
-            }
-
-            double XA = moleFractions_[iA];
-            double XB = moleFractions_[iB];
-
-            double g0 = (m_HE_b_ij[i] - T * m_SE_b_ij[i]) / RT();
-            double g1 = (m_HE_c_ij[i] - T * m_SE_c_ij[i]) / RT();
-
-            dlnActCoeffdlnN_diag_[iK] += 2*(delBK-XB)*(g0*(delAK-XA)+g1*(2*(delAK-XA)*XB+XA*(delBK-XB)));
-        }
-        dlnActCoeffdlnN_diag_[iK] = XK*dlnActCoeffdlnN_diag_[iK];
-    }
-}
-
-void MargulesVPSSTP::s_update_dlnActCoeff_dlnN() const
-{
-    double T = temperature();
-    dlnActCoeffdlnN_.zero();
-
-    // Loop over the activity coefficient gamma_k
-    for (size_t iK = 0; iK < m_kk; iK++) {
-        for (size_t iM = 0; iM < m_kk; iM++) {
-            double XM = moleFractions_[iM];
-            for (size_t i = 0; i < numBinaryInteractions_; i++) {
-                size_t iA = m_pSpecies_A_ij[i];
-                size_t iB = m_pSpecies_B_ij[i];
-                double delAK = 0.0;
-                double delBK = 0.0;
-                double delAM = 0.0;
-                double delBM = 0.0;
-                if (iA==iK) {
-                    delAK = 1.0;
-                } else if (iB==iK) {
-                    delBK = 1.0;
-                }
-                if (iA==iM) {
-                    delAM = 1.0;
-                } else if (iB==iM) {
-                    delBM = 1.0;
-                }
-
-                double XA = moleFractions_[iA];
-                double XB = moleFractions_[iB];
-                double g0 = (m_HE_b_ij[i] - T * m_SE_b_ij[i]) / RT();
-                double g1 = (m_HE_c_ij[i] - T * m_SE_c_ij[i]) / RT();
-                dlnActCoeffdlnN_(iK,iM) += g0*((delAM-XA)*(delBK-XB)+(delAK-XA)*(delBM-XB));
-                dlnActCoeffdlnN_(iK,iM) += 2*g1*((delAM-XA)*(delBK-XB)*XB+(delAK-XA)*(delBM-XB)*XB+(delBM-XB)*(delBK-XB)*XA);
-            }
-            dlnActCoeffdlnN_(iK,iM) = XM*dlnActCoeffdlnN_(iK,iM);
-        }
-    }
-}
-
-void MargulesVPSSTP::s_update_dlnActCoeff_dlnX_diag() const
-{
-    doublereal T = temperature();
-    dlnActCoeffdlnX_diag_.assign(m_kk, 0.0);
-
-    for (size_t i = 0; i < numBinaryInteractions_; i++) {
-        size_t iA = m_pSpecies_A_ij[i];
-        size_t iB = m_pSpecies_B_ij[i];
-
-        doublereal XA = moleFractions_[iA];
-        doublereal XB = moleFractions_[iB];
-
-        doublereal g0 = (m_HE_b_ij[i] - T * m_SE_b_ij[i]) / RT();
-        doublereal g1 = (m_HE_c_ij[i] - T * m_SE_c_ij[i]) / RT();
-
-        dlnActCoeffdlnX_diag_[iA] += XA*XB*(2*g1*-2*g0-6*g1*XB);
-        dlnActCoeffdlnX_diag_[iB] += XA*XB*(2*g1*-2*g0-6*g1*XB);
-    }
-}
-
 void MargulesVPSSTP::getdlnActCoeffdlnN_diag(doublereal* dlnActCoeffdlnN_diag) const
 {
-    s_update_dlnActCoeff_dlnN_diag();
+    s_update_lnActCoeff_all();
     for (size_t k = 0; k < m_kk; k++) {
         dlnActCoeffdlnN_diag[k] = dlnActCoeffdlnN_diag_[k];
     }
@@ -502,7 +439,7 @@ void MargulesVPSSTP::getdlnActCoeffdlnN_diag(doublereal* dlnActCoeffdlnN_diag) c
 
 void MargulesVPSSTP::getdlnActCoeffdlnX_diag(doublereal* dlnActCoeffdlnX_diag) const
 {
-    s_update_dlnActCoeff_dlnX_diag();
+    s_update_lnActCoeff_all();
     for (size_t k = 0; k < m_kk; k++) {
         dlnActCoeffdlnX_diag[k] = dlnActCoeffdlnX_diag_[k];
     }
@@ -510,7 +447,7 @@ void MargulesVPSSTP::getdlnActCoeffdlnX_diag(doublereal* dlnActCoeffdlnX_diag) c
 
 void MargulesVPSSTP::getdlnActCoeffdlnN(const size_t ld, doublereal* dlnActCoeffdlnN)
 {
-    s_update_dlnActCoeff_dlnN();
+    s_update_lnActCoeff_all();
     double* data =  & dlnActCoeffdlnN_(0,0);
     for (size_t k = 0; k < m_kk; k++) {
         for (size_t m = 0; m < m_kk; m++) {
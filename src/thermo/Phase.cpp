@@ -69,6 +69,8 @@ Phase& Phase::operator=(const Phase& right)
     m_stateNum = -1;
 
     m_speciesNames = right.m_speciesNames;
+    m_speciesIndices = right.m_speciesIndices;
+    m_species = right.m_species;
     m_speciesComp = right.m_speciesComp;
     m_speciesCharge = right.m_speciesCharge;
     m_speciesSize = right.m_speciesSize;
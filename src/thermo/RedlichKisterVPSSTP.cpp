@@ -70,6 +70,7 @@ RedlichKisterVPSSTP& RedlichKisterVPSSTP::operator=(const RedlichKisterVPSSTP& b
     formRedlichKister_ = b.formRedlichKister_;
     formTempModel_ = b.formTempModel_;
     dlnActCoeff_dX_ = b.dlnActCoeff_dX_;
+    m_cache.clear();
 
     return *this;
 }
@@ -84,7 +85,7 @@ ThermoPhase* RedlichKisterVPSSTP::duplMyselfAsThermoPhase() const
 void RedlichKisterVPSSTP::getLnActivityCoefficients(doublereal* lnac) const
 {
     // Update the activity coefficients
-    s_update_lnActCoeff();
+    s_update_lnActCoeff_all();
 
     for (size_t k = 0; k < m_kk; k++) {
         lnac[k] = lnActCoeff_Scaled_[k];
@@ -108,7 +109,7 @@ void RedlichKisterVPSSTP::getChemPotentials(doublereal* mu) const
     // updates of standard state as a function of T and P
     getStandardChemPotentials(mu);
     // Update the activity coefficients
-    s_update_lnActCoeff();
+    s_update_lnActCoeff_all();
 
     for (size_t k = 0; k < m_kk; k++) {
         double xx = std::max(moleFractions_[k], SmallNumber);
@@ -166,8 +167,7 @@ void RedlichKisterVPSSTP::getPartialMolarEnthalpies(doublereal* hbar) const
 
     // Update the activity coefficients, This also update the internally stored
     // molalities.
-    s_update_lnActCoeff();
-    s_update_dlnActCoeff_dT();
+    s_update_lnActCoeff_all();
     for (size_t k = 0; k < m_kk; k++) {
         hbar[k] -= GasConstant * T * T * dlnActCoeffdT_Scaled_[k];
     }
@@ -180,8 +180,7 @@ void RedlichKisterVPSSTP::getPartialMolarCp(doublereal* cpbar) const
 
     // Update the activity coefficients, This also update the internally stored
     // molalities.
-    s_update_lnActCoeff();
-    s_update_dlnActCoeff_dT();
+    s_update_lnActCoeff_all();
 
     for (size_t k = 0; k < m_kk; k++) {
         cpbar[k] -= 2 * T * dlnActCoeffdT_Scaled_[k] + T * T * d2lnActCoeffdT2_Scaled_[k];
@@ -200,8 +199,7 @@ void RedlichKisterVPSSTP::getPartialMolarEntropies(doublereal* sbar) const
 
     // Update the activity coefficients, This also update the internally stored
     // molalities.
-    s_update_lnActCoeff();
-    s_update_dlnActCoeff_dT();
+    s_update_lnActCoeff_all();
 
     for (size_t k = 0; k < m_kk; k++) {
         double xx = std::max(moleFractions_[k], SmallNumber);
@@ -231,6 +229,7 @@ void RedlichKisterVPSSTP::initThermo()
 void RedlichKisterVPSSTP::initLengths()
 {
     dlnActCoeffdlnN_.resize(m_kk, m_kk);
+    dlnActCoeff_dX_.resize(m_kk, m_kk, 0.0);
 }
 
 void RedlichKisterVPSSTP::initThermoXML(XML_Node& phaseNode, const std::string& id_)
@@ -273,14 +272,36 @@ void RedlichKisterVPSSTP::initThermoXML(XML_Node& phaseNode, const std::string&
             }
         }
     }
+    // The interaction parameters have changed, so any cached activity
+    // coefficients are invalid
+    m_cache.clear();
     // Go down the chain
     GibbsExcessVPSSTP::initThermoXML(phaseNode, id_);
 }
 
-void RedlichKisterVPSSTP::s_update_lnActCoeff() const
+void RedlichKisterVPSSTP::s_update_lnActCoeff_all() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), stateMFNumber())) {
+        return;
+    }
+
     doublereal T = temperature();
+    doublereal invRT = 1.0 / (GasConstant * T);
     lnActCoeff_Scaled_.assign(m_kk, 0.0);
+    dlnActCoeffdT_Scaled_.assign(m_kk, 0.0);
+    d2lnActCoeffdT2_Scaled_.assign(m_kk, 0.0);
+    dlnActCoeffdlnX_diag_.assign(m_kk, 0.0);
+    dlnActCoeff_dX_.zero();
+
+    // Each binary term contributes to the activity coefficients of all of the
+    // species other than A and B. These contributions are accumulated
+    // separately, with the corresponding amounts removed from species A and B,
+    // and added to all species at the end.
+    doublereal all = 0.0;
+    doublereal allT = 0.0;
+    vector_fp allX(m_kk, 0.0);
 
     // Scaling: I moved the division of RT higher so that we are always dealing
     // with G/RT dimensionless terms within the routine. There is a severe
@@ -291,85 +312,112 @@ void RedlichKisterVPSSTP::s_update_lnActCoeff() const
         size_t iB = m_pSpecies_B_ij[i];
         double XA = moleFractions_[iA];
         double XB = moleFractions_[iB];
+        doublereal XAXB = XA * XB;
         doublereal deltaX = XA - XB;
         size_t N = m_N_ij[i];
         vector_fp& he_vec = m_HE_m_ij[i];
         vector_fp& se_vec = m_SE_m_ij[i];
+
+        // Polynomial sums in deltaX and their derivatives, evaluated together
+        // for the excess Gibbs free energy (sum*, scaled by RT below) and for
+        // its temperature derivative (sumT*)
         doublereal poly = 1.0;
         doublereal polyMm1 = 1.0;
+        doublereal polyMm2 = 1.0;
         doublereal sum = 0.0;
-        doublereal sumMm1 = 0.0;
         doublereal sum2 = 0.0;
+        doublereal sumMm1 = 0.0;
+        doublereal sum2Mm1 = 0.0;
+        doublereal sumMm2 = 0.0;
+        doublereal sumT = 0.0;
+        doublereal sum2T = 0.0;
+        doublereal sumMm1T = 0.0;
         for (size_t m = 0; m < N; m++) {
-            doublereal A_ge = (he_vec[m] - T * se_vec[m]) / (GasConstant * T);
+            doublereal A_ge = he_vec[m] - T * se_vec[m];
+            doublereal A_geT = - se_vec[m];
             sum += A_ge * poly;
             sum2 += A_ge * (m + 1) * poly;
+            sumT += A_geT * poly;
+            sum2T += A_geT * (m + 1) * poly;
             poly *= deltaX;
             if (m >= 1) {
                 sumMm1 += (A_ge * polyMm1 * m);
+                sum2Mm1 += (A_ge * polyMm1 * m * (1.0 + m));
+                sumMm1T += (A_geT * polyMm1 * m);
                 polyMm1 *= deltaX;
             }
+            if (m >= 2) {
+                sumMm2 += (A_ge * polyMm2 * m * (m - 1.0));
+                polyMm2 *= deltaX;
+            }
         }
+        sum *= invRT;
+        sum2 *= invRT;
+        sumMm1 *= invRT;
+        sum2Mm1 *= invRT;
+        sumMm2 *= invRT;
         doublereal oneMXA = 1.0 - XA;
         doublereal oneMXB = 1.0 - XB;
-        for (size_t k = 0; k < m_kk; k++) {
-            if (iA == k) {
-                lnActCoeff_Scaled_[k] += (oneMXA * XB * sum) + (XA * XB * sumMm1 * (oneMXA + XB));
-            } else if (iB == k) {
-                lnActCoeff_Scaled_[k] += (oneMXB * XA * sum) + (XA * XB * sumMm1 * (-oneMXB - XA));
-            } else {
-                lnActCoeff_Scaled_[k] += -(XA * XB * sum2);
-            }
-        }
-        // Debug against formula in literature
-    }
-}
 
-void RedlichKisterVPSSTP::s_update_dlnActCoeff_dT() const
-{
-    dlnActCoeffdT_Scaled_.assign(m_kk, 0.0);
-    d2lnActCoeffdT2_Scaled_.assign(m_kk, 0.0);
+        // Derivatives wrt the mole fractions
+        doublereal dXA_other = - XB * sum2 - XAXB * sum2Mm1;
+        doublereal dXB_other = - XA * sum2 + XAXB * sum2Mm1;
+        dlnActCoeff_dX_(iA, iA) += (- XB * sum + (1.0 - XA) * XB * sumMm1
+                                    + XB * sumMm1 * (1.0 - 2.0 * XA + XB)
+                                    + XAXB * sumMm2 * (1.0 - XA + XB))
+                                   - dXA_other;
+        dlnActCoeff_dX_(iA, iB) += ((1.0 - XA) * sum - (1.0 - XA) * XB * sumMm1
+                                    + XA * sumMm1 * (1.0 + 2.0 * XB - XA)
+                                    - XAXB * sumMm2 * (1.0 - XA + XB))
+                                   - dXB_other;
+        dlnActCoeff_dX_(iB, iA) += ((1.0 - XB) * sum
+                                    + sumMm1 * ((1.0 - XB) * (XA - XB) - 2.0 * XAXB)
+                                    - XAXB * sumMm2 * (1.0 + XA - XB))
+                                   - dXA_other;
+        dlnActCoeff_dX_(iB, iB) += (- XA * sum - (1.0 - XB) * XA * sumMm1
+                                    + XA * sumMm1 * (XB - XA - (1.0 - XB))
+                                    - XAXB * sumMm2 * (-XA - (1.0 - XB)))
+                                   - dXB_other;
+        allX[iA] += dXA_other;
+        allX[iB] += dXB_other;
+
+        // Activity coefficients
+        lnActCoeff_Scaled_[iA] += (oneMXA * XB * sum) + (XAXB * sumMm1 * (oneMXA + XB))
+                                  + XAXB * sum2;
+        lnActCoeff_Scaled_[iB] += (oneMXB * XA * sum) + (XAXB * sumMm1 * (-oneMXB - XA))
+                                  + XAXB * sum2;
+        all -= XAXB * sum2;
+
+        // Temperature derivatives
+        dlnActCoeffdT_Scaled_[iA] += (oneMXA * XB * sumT) + (XAXB * sumMm1T * (oneMXA + XB))
+                                     + XAXB * sum2T;
+        dlnActCoeffdT_Scaled_[iB] += (oneMXB * XA * sumT) + (XAXB * sumMm1T * (-oneMXB - XA))
+                                     + XAXB * sum2T;
+        allT -= XAXB * sum2T;
+
+        // Derivatives wrt log(mole fractions)
+        dlnActCoeffdlnX_diag_[iA] +=
+            XA * (- (1-XA+XB) * sum + 2*(1.0 - XA) * XB * sumMm1
+                  + sumMm1 * (XB * (1 - 2*XA + XB) - XA * (1 - XA + 2*XB))
+                  + 2 * XAXB * sumMm2 * (1.0 - XA + XB));
+        dlnActCoeffdlnX_diag_[iB] +=
+            XB * (- (1-XB+XA) * sum - 2*(1.0 - XB) * XA * sumMm1
+                  + sumMm1 * (XA * (2*XB - XA - 1) - XB * (-2*XA + XB - 1))
+                  - 2 * XAXB * sumMm2 * (-XA - 1 + XB));
+    }
 
-    for (size_t i = 0; i < numBinaryInteractions_; i++) {
-        size_t iA = m_pSpecies_A_ij[i];
-        size_t iB = m_pSpecies_B_ij[i];
-        double XA = moleFractions_[iA];
-        double XB = moleFractions_[iB];
-        doublereal deltaX = XA - XB;
-        size_t N = m_N_ij[i];
-        doublereal poly = 1.0;
-        doublereal sum = 0.0;
-        vector_fp& se_vec = m_SE_m_ij[i];
-        doublereal sumMm1 = 0.0;
-        doublereal polyMm1 = 1.0;
-        doublereal sum2 = 0.0;
-        for (size_t m = 0; m < N; m++) {
-            doublereal A_ge = - se_vec[m];
-            sum += A_ge * poly;
-            sum2 += A_ge * (m + 1) * poly;
-            poly *= deltaX;
-            if (m >= 1) {
-                sumMm1 += (A_ge * polyMm1 * m);
-                polyMm1 *= deltaX;
-            }
-        }
-        doublereal oneMXA = 1.0 - XA;
-        doublereal oneMXB = 1.0 - XB;
-        for (size_t k = 0; k < m_kk; k++) {
-            if (iA == k) {
-                dlnActCoeffdT_Scaled_[k] += (oneMXA * XB * sum) + (XA * XB * sumMm1 * (oneMXA + XB));
-            } else if (iB == k) {
-                dlnActCoeffdT_Scaled_[k] += (oneMXB * XA * sum) + (XA * XB * sumMm1 * (-oneMXB - XA));
-            } else {
-                dlnActCoeffdT_Scaled_[k] += -(XA * XB * sum2);
-            }
+    for (size_t k = 0; k < m_kk; k++) {
+        lnActCoeff_Scaled_[k] += all;
+        dlnActCoeffdT_Scaled_[k] += allT;
+        for (size_t j = 0; j < m_kk; j++) {
+            dlnActCoeff_dX_(k, j) += allX[j];
         }
     }
 }
 
 void RedlichKisterVPSSTP::getdlnActCoeffdT(doublereal* dlnActCoeffdT) const
 {
-    s_update_dlnActCoeff_dT();
+    s_update_lnActCoeff_all();
     for (size_t k = 0; k < m_kk; k++) {
         dlnActCoeffdT[k] = dlnActCoeffdT_Scaled_[k];
     }
@@ -377,130 +425,16 @@ void RedlichKisterVPSSTP::getdlnActCoeffdT(doublereal* dlnActCoeffdT) const
 
 void RedlichKisterVPSSTP::getd2lnActCoeffdT2(doublereal* d2lnActCoeffdT2) const
 {
-    s_update_dlnActCoeff_dT();
+    s_update_lnActCoeff_all();
     for (size_t k = 0; k < m_kk; k++) {
         d2lnActCoeffdT2[k] = d2lnActCoeffdT2_Scaled_[k];
     }
 }
 
-void RedlichKisterVPSSTP::s_update_dlnActCoeff_dlnX_diag() const
-{
-    double T = temperature();
-    dlnActCoeffdlnX_diag_.assign(m_kk, 0.0);
-
-    for (size_t i = 0; i <  numBinaryInteractions_; i++) {
-      size_t iA =  m_pSpecies_A_ij[i];
-      size_t iB =  m_pSpecies_B_ij[i];
-      double XA = moleFractions_[iA];
-      double XB = moleFractions_[iB];
-      double deltaX = XA - XB;
-      size_t N = m_N_ij[i];
-      double poly = 1.0;
-      double sum = 0.0;
-      vector_fp& he_vec = m_HE_m_ij[i];
-      vector_fp& se_vec = m_SE_m_ij[i];
-      double sumMm1 = 0.0;
-      double polyMm1 = 1.0;
-      double polyMm2 = 1.0;
-      double sumMm2 = 0.0;
-      for (size_t m = 0; m < N; m++) {
-          double A_ge = (he_vec[m] -  T * se_vec[m]) / (GasConstant * T);;
-          sum += A_ge * poly;
-          poly *= deltaX;
-          if (m >= 1) {
-              sumMm1  += (A_ge * polyMm1 * m);
-              polyMm1 *= deltaX;
-          }
-          if (m >= 2) {
-              sumMm2 += (A_ge * polyMm2 * m * (m - 1.0));
-              polyMm2 *= deltaX;
-          }
-      }
-
-      for (size_t k = 0; k < m_kk; k++) {
-          if (iA == k) {
-              dlnActCoeffdlnX_diag_[k] +=
-                  XA * (- (1-XA+XB) * sum + 2*(1.0 - XA) * XB * sumMm1
-                        + sumMm1 * (XB * (1 - 2*XA + XB) - XA * (1 - XA + 2*XB))
-                        + 2 * XA * XB * sumMm2 * (1.0 - XA + XB));
-          } else  if (iB == k) {
-              dlnActCoeffdlnX_diag_[k] +=
-                  XB * (- (1-XB+XA) * sum - 2*(1.0 - XB) * XA * sumMm1
-                        + sumMm1 * (XA * (2*XB - XA - 1) - XB * (-2*XA + XB - 1))
-                        - 2 * XA * XB * sumMm2 * (-XA - 1 + XB));
-          }
-      }
-    }
-}
-
-void RedlichKisterVPSSTP::s_update_dlnActCoeff_dX_() const
-{
-    doublereal T = temperature();
-    dlnActCoeff_dX_.zero();
-
-    for (size_t i = 0; i < numBinaryInteractions_; i++) {
-        size_t iA = m_pSpecies_A_ij[i];
-        size_t iB = m_pSpecies_B_ij[i];
-        double XA = moleFractions_[iA];
-        double XB = moleFractions_[iB];
-        doublereal deltaX = XA - XB;
-        size_t N = m_N_ij[i];
-        doublereal poly = 1.0;
-        doublereal sum = 0.0;
-        vector_fp& he_vec = m_HE_m_ij[i];
-        vector_fp& se_vec = m_SE_m_ij[i];
-        doublereal sumMm1 = 0.0;
-        doublereal polyMm1 = 1.0;
-        doublereal polyMm2 = 1.0;
-        doublereal sum2 = 0.0;
-        doublereal sum2Mm1 = 0.0;
-        doublereal sumMm2 = 0.0;
-        for (size_t m = 0; m < N; m++) {
-            doublereal A_ge = he_vec[m] - T * se_vec[m];
-            sum += A_ge * poly;
-            sum2 += A_ge * (m + 1) * poly;
-            poly *= deltaX;
-            if (m >= 1) {
-                sumMm1 += (A_ge * polyMm1 * m);
-                sum2Mm1 += (A_ge * polyMm1 * m * (1.0 + m));
-                polyMm1 *= deltaX;
-            }
-            if (m >= 2) {
-                sumMm2 += (A_ge * polyMm2 * m * (m - 1.0));
-                polyMm2 *= deltaX;
-            }
-        }
-
-        for (size_t k = 0; k < m_kk; k++) {
-            if (iA == k) {
-                dlnActCoeff_dX_(k, iA) += (- XB * sum + (1.0 - XA) * XB * sumMm1
-                                           + XB * sumMm1 * (1.0 - 2.0 * XA + XB)
-                                           + XA * XB * sumMm2 * (1.0 - XA + XB));
-
-                dlnActCoeff_dX_(k, iB) += ((1.0 - XA) * sum - (1.0 - XA) * XB * sumMm1
-                                           + XA * sumMm1 * (1.0 + 2.0 * XB - XA)
-                                           - XA * XB * sumMm2 * (1.0 - XA + XB));
-            } else if (iB == k) {
-                dlnActCoeff_dX_(k, iA) += ((1.0 - XB) * sum + (1.0 - XA) * XB * sumMm1
-                                           + XB * sumMm1 * (1.0 - 2.0 * XA + XB)
-                                           + XA * XB * sumMm2 * (1.0 - XA + XB));
-
-                dlnActCoeff_dX_(k, iB) += (- XA * sum - (1.0 - XB) * XA * sumMm1
-                                           + XA * sumMm1 * (XB - XA - (1.0 - XB))
-                                           - XA * XB * sumMm2 * (-XA - (1.0 - XB)));
-            } else {
-                dlnActCoeff_dX_(k, iA) += (- XB * sum2 - XA * XB * sum2Mm1);
-                dlnActCoeff_dX_(k, iB) += (- XA * sum2 + XA * XB * sum2Mm1);
-            }
-        }
-    }
-}
-
 void RedlichKisterVPSSTP::getdlnActCoeffds(const doublereal dTds, const doublereal* const dXds,
         doublereal* dlnActCoeffds) const
 {
-    s_update_dlnActCoeff_dT();
-    s_update_dlnActCoeff_dX_();
+    s_update_lnActCoeff_all();
     for (size_t k = 0; k < m_kk; k++) {
         dlnActCoeffds[k] = dlnActCoeffdT_Scaled_[k] * dTds;
         for (size_t j = 0; j < m_kk; j++) {
@@ -511,7 +445,7 @@ void RedlichKisterVPSSTP::getdlnActCoeffds(const doublereal dTds, const doublere
 
 void RedlichKisterVPSSTP::getdlnActCoeffdlnN_diag(doublereal* dlnActCoeffdlnN_diag) const
 {
-    s_update_dlnActCoeff_dX_();
+    s_update_lnActCoeff_all();
     for (size_t j = 0; j < m_kk; j++) {
         dlnActCoeffdlnN_diag[j] = dlnActCoeff_dX_(j, j);
         for (size_t k = 0; k < m_kk; k++) {
@@ -522,7 +456,7 @@ void RedlichKisterVPSSTP::getdlnActCoeffdlnN_diag(doublereal* dlnActCoeffdlnN_di
 
 void RedlichKisterVPSSTP::getdlnActCoeffdlnX_diag(doublereal* dlnActCoeffdlnX_diag) const
 {
-    s_update_dlnActCoeff_dlnX_diag();
+    s_update_lnActCoeff_all();
     for (size_t k = 0; k < m_kk; k++) {
         dlnActCoeffdlnX_diag[k] = dlnActCoeffdlnX_diag_[k];
     }
@@ -530,7 +464,7 @@ void RedlichKisterVPSSTP::getdlnActCoeffdlnX_diag(doublereal* dlnActCoeffdlnX_di
 
 void RedlichKisterVPSSTP::getdlnActCoeffdlnN(const size_t ld, doublereal* dlnActCoeffdlnN)
 {
-    s_update_dlnActCoeff_dX_();
+    s_update_lnActCoeff_all();
     double* data =  & dlnActCoeffdlnN_(0,0);
     for (size_t k = 0; k < m_kk; k++) {
         for (size_t m = 0; m < m_kk; m++) {
@@ -547,7 +481,6 @@ void RedlichKisterVPSSTP::resizeNumInteractions(const size_t num)
     m_N_ij.resize(num, npos);
     m_HE_m_ij.resize(num);
     m_SE_m_ij.resize(num);
-    dlnActCoeff_dX_.resize(num, num, 0.0);
 }
 
 void RedlichKisterVPSSTP::readXMLBinarySpecies(XML_Node& xmLBinarySpecies)
@@ -33,6 +33,7 @@ RedlichKwongMFTP::RedlichKwongMFTP() :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_dadT_current(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -44,6 +45,7 @@ RedlichKwongMFTP::RedlichKwongMFTP(const std::string& infile, const std::string&
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_dadT_current(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -56,6 +58,7 @@ RedlichKwongMFTP::RedlichKwongMFTP(XML_Node& phaseRefRoot, const std::string& id
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_dadT_current(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -68,6 +71,7 @@ RedlichKwongMFTP::RedlichKwongMFTP(const RedlichKwongMFTP& b) :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_dadT_current(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -87,6 +91,7 @@ RedlichKwongMFTP& RedlichKwongMFTP::operator=(const RedlichKwongMFTP& b)
         m_formTempParam = b.m_formTempParam;
         m_b_current = b.m_b_current;
         m_a_current = b.m_a_current;
+        m_dadT_current = b.m_dadT_current;
         a_vec_Curr_ = b.a_vec_Curr_;
         b_vec_Curr_ = b.b_vec_Curr_;
         a_coeff_vec = b.a_coeff_vec;
@@ -661,6 +666,8 @@ void RedlichKwongMFTP::initThermoXML(XML_Node& phaseNode, const std::string& id)
         calcCriticalConditions(ai, bi, a0coeff, aTcoeff, m_pc_Species[i], m_tc_Species[i], m_vc_Species[i]);
     }
 
+    // Values of a and b computed before the parameters were read are invalid
+    m_cache.clear();
     MixtureFugacityTP::initThermoXML(phaseNode, id);
 }
 
@@ -891,7 +898,9 @@ doublereal RedlichKwongMFTP::densityCalc(doublereal TKelvin, doublereal presPa,
                 if (phaseRequested == FLUID_GAS || phaseRequested == FLUID_SUPERCRIT) {
                     rhoguess = presPa * mmw / (GasConstant * TKelvin);
                 } else if (phaseRequested >= FLUID_LIQUID_0) {
-                    double lqvol = liquidVolEst(TKelvin, presPa);
+                    // liquidVolEst() may change the pressure it is given
+                    double pres = presPa;
+                    double lqvol = liquidVolEst(TKelvin, pres);
                     rhoguess = mmw / lqvol;
                 }
             }
@@ -903,40 +912,101 @@ doublereal RedlichKwongMFTP::densityCalc(doublereal TKelvin, doublereal presPa,
     }
 
     doublereal volguess = mmw / rhoguess;
-    NSolns_ = NicholsSolve(TKelvin, presPa, m_a_current, m_b_current, Vroot_);
 
-    doublereal molarVolLast = Vroot_[0];
-    if (NSolns_ >= 2) {
+    // The roots only depend on the temperature, pressure and composition, so
+    // the cubic only needs to be solved again if one of these has changed
+    static const int cacheId = m_cache.getId();
+    CachedArray cached = m_cache.getArray(cacheId);
+    if (!cached.validate(TKelvin, presPa, stateMFNumber())) {
+        NSolns_ = NicholsSolve(TKelvin, presPa, m_a_current, m_b_current, Vroot_);
+        cached.value.assign({double(NSolns_), Vroot_[0], Vroot_[1], Vroot_[2]});
+    } else {
+        NSolns_ = int(cached.value[0]);
+        std::copy(cached.value.begin() + 1, cached.value.end(), Vroot_);
+    }
+
+    doublereal molarVolLast = selectRoot(NSolns_, Vroot_, TKelvin, tcrit,
+                                         phaseRequested, volguess);
+    if (molarVolLast < 0.0) {
+        return molarVolLast;
+    }
+    return mmw / molarVolLast;
+}
+
+void RedlichKwongMFTP::densitiesCalc(size_t nStates, const doublereal* TKelvin,
+                                     const doublereal* presPa, int phaseRequested,
+                                     doublereal* rho) const
+{
+    // b and the two coefficients of a = a0 + aT * T depend only on the
+    // composition, which is the same for all of the states
+    doublereal b = 0.0;
+    doublereal a0 = 0.0;
+    doublereal aT = 0.0;
+    for (size_t i = 0; i < m_kk; i++) {
+        b += moleFractions_[i] * b_vec_Curr_[i];
+        for (size_t j = 0; j < m_kk; j++) {
+            size_t counter = i * m_kk + j;
+            a0 += a_coeff_vec(0, counter) * moleFractions_[i] * moleFractions_[j];
+            aT += a_coeff_vec(1, counter) * moleFractions_[i] * moleFractions_[j];
+        }
+    }
+    if (m_formTempParam == 0) {
+        aT = 0.0;
+    }
+
+    doublereal tcrit = critTemperature();
+    doublereal mmw = meanMolecularWeight();
+    doublereal Vroot[3];
+    doublereal molarVolPrev = -1.0;
+    for (size_t n = 0; n < nStates; n++) {
+        int nSolns = NicholsSolve(TKelvin[n], presPa[n], a0 + aT * TKelvin[n],
+                                  b, Vroot);
+        // Stay on the branch of the previous state; start from the gas branch
+        doublereal volguess = molarVolPrev;
+        if (volguess <= 0.0) {
+            volguess = GasConstant * TKelvin[n] / presPa[n];
+        }
+        doublereal molarVol = selectRoot(nSolns, Vroot, TKelvin[n], tcrit,
+                                         phaseRequested, volguess);
+        if (molarVol > 0.0) {
+            rho[n] = mmw / molarVol;
+            molarVolPrev = molarVol;
+        } else {
+            rho[n] = molarVol;
+        }
+    }
+}
+
+doublereal RedlichKwongMFTP::selectRoot(int nSolns, const doublereal Vroot[3],
+                                        doublereal TKelvin, doublereal tcrit,
+                                        int phaseRequested, doublereal volguess) const
+{
+    if (nSolns >= 2) {
         if (phaseRequested >= FLUID_LIQUID_0) {
-            molarVolLast = Vroot_[0];
+            return Vroot[0];
         } else if (phaseRequested == FLUID_GAS || phaseRequested == FLUID_SUPERCRIT) {
-            molarVolLast = Vroot_[2];
+            return Vroot[2];
+        } else if (volguess > Vroot[1]) {
+            return Vroot[2];
         } else {
-            if (volguess > Vroot_[1]) {
-                molarVolLast = Vroot_[2];
-            } else {
-                molarVolLast = Vroot_[0];
-            }
+            return Vroot[0];
         }
-    } else if (NSolns_ == 1) {
+    } else if (nSolns == 1) {
         if (phaseRequested == FLUID_GAS || phaseRequested == FLUID_SUPERCRIT || phaseRequested == FLUID_UNDEFINED) {
-            molarVolLast = Vroot_[0];
+            return Vroot[0];
         } else {
             return -2.0;
         }
-    } else if (NSolns_ == -1) {
+    } else if (nSolns == -1) {
         if (phaseRequested >= FLUID_LIQUID_0 || phaseRequested == FLUID_UNDEFINED || phaseRequested == FLUID_SUPERCRIT) {
-            molarVolLast = Vroot_[0];
+            return Vroot[0];
         } else if (TKelvin > tcrit) {
-            molarVolLast = Vroot_[0];
+            return Vroot[0];
         } else {
             return -2.0;
         }
-    } else {
-        molarVolLast = Vroot_[0];
-        return -1.0;
     }
-    return mmw / molarVolLast;
+    return -1.0;
 }
 
 doublereal RedlichKwongMFTP::densSpinodalLiquid() const
@@ -1028,21 +1098,49 @@ void RedlichKwongMFTP::updateAB()
 {
     double temp = temperature();
     if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                a_vec_Curr_[counter] = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
+        // The pair interaction terms only depend on the temperature
+        static const int pairCacheId = m_cache.getId();
+        CachedScalar pairCached = m_cache.getScalar(pairCacheId);
+        if (!pairCached.validate(temp)) {
+            for (size_t i = 0; i < m_kk; i++) {
+                for (size_t j = 0; j < m_kk; j++) {
+                    size_t counter = i * m_kk + j;
+                    a_vec_Curr_[counter] = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
+                }
             }
         }
     }
 
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temp, stateMFNumber())) {
+        return;
+    }
+
+    // The a coefficient matrices are symmetric, so only the lower triangle
+    // needs to be summed
     m_b_current = 0.0;
     m_a_current = 0.0;
+    m_dadT_current = 0.0;
     for (size_t i = 0; i < m_kk; i++) {
-        m_b_current += moleFractions_[i] * b_vec_Curr_[i];
-        for (size_t j = 0; j < m_kk; j++) {
-            m_a_current += a_vec_Curr_[i * m_kk + j] * moleFractions_[i] * moleFractions_[j];
+        doublereal xi = moleFractions_[i];
+        if (xi == 0.0) {
+            continue;
+        }
+        m_b_current += xi * b_vec_Curr_[i];
+        size_t ii = i * m_kk + i;
+        doublereal asum = 0.5 * a_vec_Curr_[ii] * xi;
+        doublereal dadTsum = 0.5 * a_coeff_vec(1,ii) * xi;
+        for (size_t j = 0; j < i; j++) {
+            size_t counter = i * m_kk + j;
+            asum += a_vec_Curr_[counter] * moleFractions_[j];
+            dadTsum += a_coeff_vec(1,counter) * moleFractions_[j];
         }
+        m_a_current += 2.0 * xi * asum;
+        m_dadT_current += 2.0 * xi * dadTsum;
+    }
+    if (m_formTempParam == 0) {
+        m_dadT_current = 0.0;
     }
 }
 
@@ -1073,16 +1171,7 @@ void RedlichKwongMFTP::calculateAB(doublereal temp, doublereal& aCalc, doublerea
 
 doublereal RedlichKwongMFTP::da_dt() const
 {
-    doublereal dadT = 0.0;
-    if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                dadT+= a_coeff_vec(1,counter) * moleFractions_[i] * moleFractions_[j];
-            }
-        }
-    }
-    return dadT;
+    return m_dadT_current;
 }
 
 void RedlichKwongMFTP::calcCriticalConditions(doublereal a, doublereal b, doublereal a0_coeff, doublereal aT_coeff,
@@ -0,0 +1,223 @@
+/**
+ * @file WaterDensityTable.cpp
+ * Definitions for a tabulated representation of the density of water as a
+ * function of temperature and pressure (See class
+ * \link Cantera::WaterDensityTable WaterDensityTable\endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at http://www.cantera.org/license.txt for license and copyright information.
+
+#include "cantera/thermo/WaterDensityTable.h"
+#include "cantera/thermo/WaterPropsIAPWS.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+//! Step in ln(P) used to evaluate the mixed derivative at the nodes
+static const doublereal lnP_step = 1.0E-3;
+
+//! Calculate the density and its first derivatives at a node of the table
+/*!
+ * @param water     Object used to evaluate the equation of state
+ * @param T         Temperature (kelvin)
+ * @param P         Pressure (Pascal)
+ * @param phase     Phase of water to find
+ * @param rhoguess  Guess for the density, or -1.0 for no guess
+ * @param rho_T     Output derivative of the density wrt T at constant P
+ * @param rho_lnP   Output derivative of the density wrt ln(P) at constant T
+ * @returns the density, or -1.0 if it could not be found
+ */
+static doublereal nodeDensity(WaterPropsIAPWS& water, doublereal T,
+                              doublereal P, int phase, doublereal rhoguess,
+                              doublereal& rho_T, doublereal& rho_lnP)
+{
+    doublereal rho = water.density(T, P, phase, rhoguess);
+    if (rho <= 0.0) {
+        return -1.0;
+    }
+    doublereal kappa = water.isothermalCompressibility();
+    if (kappa <= 0.0) {
+        return -1.0;
+    }
+    rho_T = - rho * water.coeffThermExp();
+    rho_lnP = P * rho * kappa;
+    return rho;
+}
+
+WaterDensityTable::WaterDensityTable(doublereal Tmin, doublereal Tmax,
+                                     doublereal Pmin, doublereal Pmax,
+                                     size_t nT, size_t nP, doublereal rtol) :
+    m_nT(nT),
+    m_nP(nP),
+    m_Tmin(Tmin),
+    m_dT(0.0),
+    m_lnPmin(0.0),
+    m_dlnP(0.0),
+    m_maxError(0.0)
+{
+    if (nT < 2 || nP < 2) {
+        throw CanteraError("WaterDensityTable::WaterDensityTable",
+                           "At least two nodes are needed in each direction");
+    }
+    if (Tmin <= 0.0 || Tmax <= Tmin || Pmin <= 0.0 || Pmax <= Pmin) {
+        throw CanteraError("WaterDensityTable::WaterDensityTable",
+                           "Invalid table bounds: T = [{}, {}], P = [{}, {}]",
+                           Tmin, Tmax, Pmin, Pmax);
+    }
+    m_dT = (Tmax - Tmin) / (nT - 1);
+    m_lnPmin = log(Pmin);
+    m_dlnP = (log(Pmax) - m_lnPmin) / (nP - 1);
+
+    WaterPropsIAPWS water;
+    doublereal Tc = water.Tcrit();
+    doublereal Pc = water.Pcrit();
+    vector_fp psat(nT, Pc);
+    vector_fp pres(nP);
+    for (size_t j = 0; j < nP; j++) {
+        pres[j] = exp(m_lnPmin + j * m_dlnP);
+    }
+
+    // Density and derivatives at the nodes. Nodes on the saturation curve
+    // are assigned to the liquid. Unconverged nodes are stored as NaN, which
+    // removes all of the cells that touch them below.
+    m_rho.assign(nT * nP, NAN);
+    m_rho_T.assign(nT * nP, NAN);
+    m_rho_lnP.assign(nT * nP, NAN);
+    m_rho_TlnP.assign(nT * nP, NAN);
+    for (size_t i = 0; i < nT; i++) {
+        doublereal T = m_Tmin + i * m_dT;
+        if (T < Tc) {
+            psat[i] = water.psat(T);
+        }
+        int lastPhase = -1;
+        doublereal rhoLast = -1.0;
+        for (size_t j = 0; j < nP; j++) {
+            int phase = WATER_SUPERCRIT;
+            if (T < Tc) {
+                phase = (pres[j] >= psat[i]) ? WATER_LIQUID : WATER_GAS;
+            }
+            doublereal rhoguess = (phase == lastPhase) ? rhoLast : -1.0;
+            doublereal rho_T, rho_lnP, rhoT_lo, rhoT_hi, dum;
+            doublereal rho = nodeDensity(water, T, pres[j], phase, rhoguess,
+                                         rho_T, rho_lnP);
+            lastPhase = phase;
+            rhoLast = rho;
+            if (rho <= 0.0) {
+                lastPhase = -1;
+                continue;
+            }
+            // Mixed derivative from a central difference of d(rho)/dT
+            if (nodeDensity(water, T, pres[j] * exp(-lnP_step), phase, rho,
+                            rhoT_lo, dum) <= 0.0 ||
+                nodeDensity(water, T, pres[j] * exp(lnP_step), phase, rho,
+                            rhoT_hi, dum) <= 0.0) {
+                continue;
+            }
+            size_t n = i * nP + j;
+            m_rho[n] = rho;
+            m_rho_T[n] = rho_T;
+            m_rho_lnP[n] = rho_lnP;
+            m_rho_TlnP[n] = (rhoT_hi - rhoT_lo) / (2.0 * lnP_step);
+        }
+    }
+
+    // Assign each cell to a phase, and check the interpolant against the
+    // exact solution at the cell center.
+    m_cellPhase.assign((nT - 1) * (nP - 1), -1);
+    for (size_t i = 0; i < nT - 1; i++) {
+        doublereal T = m_Tmin + i * m_dT;
+        for (size_t j = 0; j < nP - 1; j++) {
+            int phase = -1;
+            if (T >= Tc) {
+                phase = WATER_SUPERCRIT;
+            } else if (pres[j] >= ((T + m_dT >= Tc) ? Pc : psat[i+1])) {
+                phase = WATER_LIQUID;
+            } else if (pres[j+1] < psat[i]) {
+                phase = WATER_GAS;
+            } else {
+                // Crossed by the saturation curve
+                continue;
+            }
+            size_t n = i * nP + j;
+            if (std::isnan(m_rho[n]) || std::isnan(m_rho[n+1]) ||
+                std::isnan(m_rho[n+nP]) || std::isnan(m_rho[n+nP+1])) {
+                continue;
+            }
+            doublereal rhoInterp = interp(i, j, 0.5, 0.5);
+            doublereal rho = water.density(T + 0.5 * m_dT,
+                                           exp(m_lnPmin + (j + 0.5) * m_dlnP),
+                                           phase, rhoInterp);
+            if (rho <= 0.0) {
+                continue;
+            }
+            doublereal err = fabs(rhoInterp - rho) / rho;
+            if (err <= rtol) {
+                m_cellPhase[i * (nP - 1) + j] = phase;
+                m_maxError = std::max(m_maxError, err);
+            }
+        }
+    }
+}
+
+doublereal WaterDensityTable::density(doublereal temperature,
+                                      doublereal pressure, int phase) const
+{
+    doublereal x = (temperature - m_Tmin) / m_dT;
+    if (!(x >= 0.0 && x <= m_nT - 1) || !(pressure > 0.0)) {
+        return -1.0;
+    }
+    doublereal y = (log(pressure) - m_lnPmin) / m_dlnP;
+    if (!(y >= 0.0 && y <= m_nP - 1)) {
+        return -1.0;
+    }
+    size_t i = std::min(static_cast<size_t>(x), m_nT - 2);
+    size_t j = std::min(static_cast<size_t>(y), m_nP - 2);
+    int cellPhase = m_cellPhase[i * (m_nP - 1) + j];
+    if (cellPhase < 0 ||
+        (phase == WATER_LIQUID && cellPhase == WATER_GAS) ||
+        (phase == WATER_GAS && cellPhase == WATER_LIQUID)) {
+        return -1.0;
+    }
+    return interp(i, j, x - i, y - j);
+}
+
+size_t WaterDensityTable::nValidCells() const
+{
+    size_t n = 0;
+    for (size_t k = 0; k < m_cellPhase.size(); k++) {
+        if (m_cellPhase[k] >= 0) {
+            n++;
+        }
+    }
+    return n;
+}
+
+doublereal WaterDensityTable::interp(size_t i, size_t j, doublereal s,
+                                     doublereal t) const
+{
+    // Cubic Hermite basis functions for the values (h0) and the slopes (h1)
+    // at the two ends of the interval, in each direction
+    doublereal h0s[2] = {(1.0 + 2.0 * s) * (1.0 - s) * (1.0 - s),
+                         s * s * (3.0 - 2.0 * s)};
+    doublereal h1s[2] = {s * (1.0 - s) * (1.0 - s) * m_dT,
+                         s * s * (s - 1.0) * m_dT};
+    doublereal h0t[2] = {(1.0 + 2.0 * t) * (1.0 - t) * (1.0 - t),
+                         t * t * (3.0 - 2.0 * t)};
+    doublereal h1t[2] = {t * (1.0 - t) * (1.0 - t) * m_dlnP,
+                         t * t * (t - 1.0) * m_dlnP};
+    doublereal rho = 0.0;
+    for (size_t a = 0; a < 2; a++) {
+        for (size_t b = 0; b < 2; b++) {
+            size_t n = (i + a) * m_nP + j + b;
+            rho += m_rho[n] * h0s[a] * h0t[b]
+                   + m_rho_T[n] * h1s[a] * h0t[b]
+                   + m_rho_lnP[n] * h0s[a] * h1t[b]
+                   + m_rho_TlnP[n] * h1s[a] * h1t[b];
+        }
+    }
+    return rho;
+}
+
+}
@@ -46,7 +46,8 @@ WaterPropsIAPWS::WaterPropsIAPWS() :
 WaterPropsIAPWS::WaterPropsIAPWS(const WaterPropsIAPWS& b) :
     tau(b.tau),
     delta(b.delta),
-    iState(b.iState)
+    iState(b.iState),
+    m_densTable(b.m_densTable)
 {
     m_phi.tdpolycalc(tau, delta);
 }
@@ -59,6 +60,7 @@ WaterPropsIAPWS& WaterPropsIAPWS::operator=(const WaterPropsIAPWS& b)
     tau = b.tau;
     delta = b.delta;
     iState = b.iState;
+    m_densTable = b.m_densTable;
     m_phi.tdpolycalc(tau, delta);
     return *this;
 }
@@ -99,6 +101,28 @@ doublereal WaterPropsIAPWS::pressure() const
 doublereal WaterPropsIAPWS::density(doublereal temperature, doublereal pressure,
                                     int phase, doublereal rhoguess)
 {
+    if (m_densTable) {
+        int tablePhase = phase;
+        if (phase == -1) {
+            tablePhase = (rhoguess > Rho_c) ? WATER_LIQUID : WATER_GAS;
+        }
+        doublereal rhoTable = m_densTable->density(temperature, pressure,
+                                                   tablePhase);
+        if (rhoTable > 0.0) {
+            doublereal p_red = pressure * M_water / (Rgas * temperature * Rho_c);
+            doublereal delta_retn = m_phi.dpolish(p_red, T_c / temperature,
+                                                  rhoTable / Rho_c);
+            if (delta_retn > 0.0) {
+                // m_phi has already been evaluated at the solution
+                calcDim(temperature, delta_retn * Rho_c);
+                delta = delta_retn;
+                return delta_retn * Rho_c;
+            }
+            // Fall back to the damped iteration, using the table value as
+            // the initial guess
+            rhoguess = rhoTable;
+        }
+    }
     doublereal deltaGuess = 0.0;
     if (rhoguess == -1.0) {
         if (phase != -1) {
@@ -953,6 +953,30 @@ doublereal WaterPropsIAPWSphi::dfind(doublereal p_red, doublereal tau, doublerea
     return dd;
 }
 
+doublereal WaterPropsIAPWSphi::dpolish(doublereal p_red, doublereal tau,
+                                       doublereal deltaGuess)
+{
+    doublereal dd = deltaGuess;
+    doublereal pcheck = 1.0E-30 + 1.0E-8 * p_red;
+    for (int n = 0; n < 6; n++) {
+        tdpolycalc(tau, dd);
+        doublereal q1 = phiR_d();
+        doublereal pred0 = dd + dd * dd * q1;
+        if (fabs(pred0-p_red) < pcheck) {
+            return dd;
+        }
+        doublereal dpddelta = 1.0 + 2.0 * dd * q1 + dd * dd * phiR_dd();
+        if (dpddelta <= 0.0) {
+            break;
+        }
+        dd -= (pred0 - p_red) / dpddelta;
+        if (dd <= 0.0) {
+            break;
+        }
+    }
+    return 0.0;
+}
+
 doublereal WaterPropsIAPWSphi::gibbs_RT() const
 {
     doublereal delta = DELTAsave;
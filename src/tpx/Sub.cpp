@@ -6,6 +6,7 @@
 #include "cantera/tpx/Sub.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/global.h"
+#include <iostream>
 
 using std::string;
 using namespace Cantera;
@@ -35,16 +36,17 @@ double Substance::P()
     return TwoPhase() ? Ps() : Pp();
 }
 
-const double DeltaT = 0.000001;
-
 double Substance::dPsdT()
 {
-    double tsave = T;
-    double ps1 = Ps();
-    T += DeltaT;
-    double dpdt = (Ps() - ps1)/DeltaT;
-    T = tsave;
-    return dpdt;
+    // Clausius-Clapeyron equation, evaluated at the saturated states
+    Ps();
+    double Rho_save = Rho;
+    Rho = Rhv;
+    double sv = sp();
+    Rho = Rhf;
+    double sf = sp();
+    Rho = Rho_save;
+    return (sv - sf)/(1.0/Rhv - 1.0/Rhf);
 }
 
 int Substance::TwoPhase()
@@ -82,6 +84,10 @@ double Substance::Tsat(double p)
     int LoopCount = 0;
     double tol = 1.e-6*p;
     double Tsave = T;
+    double Test = satTableTsat(p);
+    if (Test > 0.0) {
+        T = Test;
+    }
     if (T < Tmin()) {
         T = 0.5*(Tcrit() - Tmin());
     }
@@ -284,13 +290,17 @@ void Substance::update_sat()
 {
     if ((T != Tslast) && (T < Tcrit())) {
         double Rho_save = Rho;
-        double pp = Psat();
+        double pp, rhf0, rhv0;
+        if (!satTableEstimate(T, pp, rhf0, rhv0)) {
+            pp = Psat(); // trial value = Psat from correlation
+            rhf0 = ldens(); // trial value = liquid density
+            rhv0 = pp*MolWt()/(8314.0*T); // trial value = ideal gas
+        }
         double lps = log(pp);
-        // trial value = Psat from correlation
         int i;
         for (i = 0; i<20; i++) {
             if (i==0) {
-                Rho = ldens(); // trial value = liquid density
+                Rho = rhf0;
             } else {
                 Rho = Rhf;
             }
@@ -299,7 +309,7 @@ void Substance::update_sat()
 
             double gf = hp() - T*sp();
             if (i==0) {
-                Rho = pp*MolWt()/(8314.0*T); // trial value = ideal gas
+                Rho = rhv0;
             } else {
                 Rho = Rhv;
             }
@@ -348,6 +358,124 @@ void Substance::update_sat()
     }
 }
 
+void Substance::buildSatTable(size_t n)
+{
+    if (n < 2) {
+        throw CanteraError("Substance::buildSatTable",
+                           "At least two points are required");
+    }
+    clearSatTable();
+    double Tsave = T;
+    double Rhosave = Rho;
+    double tc = Tcrit();
+    double tmin = Tmin();
+    std::vector<double> tt, lp, rf, rv;
+    for (size_t k = 0; k < n; k++) {
+        // Uniform spacing in sqrt(Tcrit - T), stopping short of Tcrit
+        double u = 1.0 - double(k)/n;
+        T = tc - (tc - tmin)*u*u;
+        try {
+            update_sat();
+        } catch (CanteraError&) {
+            // Leave out points where the saturation state can't be found
+            continue;
+        }
+        tt.push_back(T);
+        lp.push_back(log(Pst));
+        rf.push_back(Rhf);
+        rv.push_back(Rhv);
+    }
+    T = Tsave;
+    Rho = Rhosave;
+    if (tt.size() < 2) {
+        throw CanteraError("Substance::buildSatTable",
+                           "Saturation curve could not be evaluated");
+    }
+    m_satT = tt;
+    m_satLogP = lp;
+    m_satRhf = rf;
+    m_satRhv = rv;
+}
+
+void Substance::writeSatTable(std::ostream& s) const
+{
+    s << m_name << "\n" << m_satT.size() << "\n";
+    for (size_t k = 0; k < m_satT.size(); k++) {
+        s << fmt::format("{:.17g} {:.17g} {:.17g} {:.17g}\n", m_satT[k],
+                         m_satLogP[k], m_satRhf[k], m_satRhv[k]);
+    }
+}
+
+void Substance::readSatTable(std::istream& s)
+{
+    std::string name;
+    size_t n = 0;
+    std::getline(s, name);
+    s >> n;
+    if (!s || n < 2) {
+        throw CanteraError("Substance::readSatTable",
+                           "Invalid saturation table header");
+    } else if (name != m_name) {
+        throw CanteraError("Substance::readSatTable",
+            "Saturation table for '{}' can't be used for '{}'", name, m_name);
+    }
+    std::vector<double> tt(n), lp(n), rf(n), rv(n);
+    for (size_t k = 0; k < n; k++) {
+        s >> tt[k] >> lp[k] >> rf[k] >> rv[k];
+        if (!s) {
+            throw CanteraError("Substance::readSatTable",
+                               "Error reading point {} of {}", k, n);
+        }
+        if (tt[k] < Tmin() || tt[k] >= Tcrit() || rv[k] <= 0.0
+            || rf[k] <= rv[k] || (k > 0 && (tt[k] <= tt[k-1]
+                                            || lp[k] <= lp[k-1]))) {
+            throw CanteraError("Substance::readSatTable",
+                               "Invalid saturation state at T = {}", tt[k]);
+        }
+    }
+    m_satT = tt;
+    m_satLogP = lp;
+    m_satRhf = rf;
+    m_satRhv = rv;
+}
+
+void Substance::clearSatTable()
+{
+    m_satT.clear();
+    m_satLogP.clear();
+    m_satRhf.clear();
+    m_satRhv.clear();
+}
+
+bool Substance::satTableEstimate(double t, double& ps, double& rhf,
+                                 double& rhv) const
+{
+    if (m_satT.empty() || t < m_satT.front() || t > m_satT.back()) {
+        return false;
+    }
+    size_t k = std::upper_bound(m_satT.begin(), m_satT.end(), t)
+               - m_satT.begin();
+    k = std::min(k, m_satT.size() - 1) - 1;
+    double f = (t - m_satT[k])/(m_satT[k+1] - m_satT[k]);
+    ps = exp(m_satLogP[k] + f*(m_satLogP[k+1] - m_satLogP[k]));
+    rhf = m_satRhf[k] + f*(m_satRhf[k+1] - m_satRhf[k]);
+    rhv = m_satRhv[k] + f*(m_satRhv[k+1] - m_satRhv[k]);
+    return true;
+}
+
+double Substance::satTableTsat(double p) const
+{
+    double lp = log(p);
+    if (m_satT.empty() || lp < m_satLogP.front() || lp > m_satLogP.back()) {
+        return -1.0;
+    }
+    size_t k = std::upper_bound(m_satLogP.begin(), m_satLogP.end(), lp)
+               - m_satLogP.begin();
+    k = std::min(k, m_satLogP.size() - 1) - 1;
+    double f = (lp - m_satLogP[k])/(m_satLogP[k+1] - m_satLogP[k]);
+    return m_satT[k] + f*(m_satT[k+1] - m_satT[k]);
+}
+
 double Substance::vprop(propertyFlag::type ijob)
 {
     switch (ijob) {
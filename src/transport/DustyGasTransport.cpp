@@ -18,6 +18,11 @@ namespace Cantera
 DustyGasTransport::DustyGasTransport(thermo_t* thermo) :
     Transport(thermo),
     m_temp(-1.0),
+    m_hmatrix_ok(false),
+    m_multidiff_ok(false),
+    m_hmatrix_temp(-1.0),
+    m_hmatrix_pres(-1.0),
+    m_xtol(0.0),
     m_gradP(0.0),
     m_knudsen_ok(false),
     m_bulk_ok(false),
@@ -31,6 +36,11 @@ DustyGasTransport::DustyGasTransport(thermo_t* thermo) :
 
 DustyGasTransport::DustyGasTransport(const DustyGasTransport& right) :
     m_temp(-1.0),
+    m_hmatrix_ok(false),
+    m_multidiff_ok(false),
+    m_hmatrix_temp(-1.0),
+    m_hmatrix_pres(-1.0),
+    m_xtol(0.0),
     m_gradP(0.0),
     m_knudsen_ok(false),
     m_bulk_ok(false),
@@ -56,6 +66,13 @@ DustyGasTransport& DustyGasTransport::operator=(const DustyGasTransport& right)
     m_dk = right.m_dk;
     m_temp = right.m_temp;
     m_multidiff = right.m_multidiff;
+    m_hmatrix = right.m_hmatrix;
+    m_hmatrix_ok = right.m_hmatrix_ok;
+    m_multidiff_ok = right.m_multidiff_ok;
+    m_hmatrix_temp = right.m_hmatrix_temp;
+    m_hmatrix_pres = right.m_hmatrix_pres;
+    m_hmatrix_x = right.m_hmatrix_x;
+    m_xtol = right.m_xtol;
     m_spwork = right.m_spwork;
     m_spwork2 = right.m_spwork2;
     m_gradP = right.m_gradP;
@@ -101,6 +118,9 @@ void DustyGasTransport::initialize(ThermoPhase* phase, Transport* gastr)
     m_multidiff.resize(m_nsp, m_nsp);
     m_d.resize(m_nsp, m_nsp);
     m_dk.resize(m_nsp, 0.0);
+    m_hmatrix.resize(m_nsp, m_nsp);
+    m_hmatrix.m_useReturnErrorCode = 1;
+    m_hmatrix_x.resize(m_nsp, -1.0);
 
     m_x.resize(m_nsp, 0.0);
     m_thermo->getMoleFractions(m_x.data());
@@ -108,6 +128,8 @@ void DustyGasTransport::initialize(ThermoPhase* phase, Transport* gastr)
     // set flags all false
     m_knudsen_ok = false;
     m_bulk_ok = false;
+    m_hmatrix_ok = false;
+    m_multidiff_ok = false;
 
     m_spwork.resize(m_nsp);
     m_spwork2.resize(m_nsp);
@@ -152,7 +174,7 @@ void DustyGasTransport::eval_H_matrix()
     for (size_t k = 0; k < m_nsp; k++) {
         // evaluate off-diagonal terms
         for (size_t j = 0; j < m_nsp; j++) {
-            m_multidiff(k,j) = -m_x[k]/m_d(k,j);
+            m_hmatrix(k,j) = -m_x[k]/m_d(k,j);
         }
 
         // evaluate diagonal term
@@ -162,7 +184,7 @@ void DustyGasTransport::eval_H_matrix()
                 sum += m_x[j]/m_d(k,j);
             }
         }
-        m_multidiff(k,k) = 1.0/m_dk[k] + sum;
+        m_hmatrix(k,k) = 1.0/m_dk[k] + sum;
     }
 }
 
@@ -199,11 +221,7 @@ void DustyGasTransport::getMolarFluxes(const doublereal* const state1,
     doublereal gradp = (p2 - p1)/delta;
     doublereal tbar = 0.5*(t1 + t2);
     m_thermo->setState_TPX(tbar, pbar, cbar);
-    updateMultiDiffCoeffs();
-
-    // Multiply m_multidiff and gradc together and store the result in fluxes[]
-    multiply(m_multidiff, gradc, fluxes);
-    divide_each(cbar, cbar + m_nsp, m_dk.begin());
+    updateHMatrix();
 
     // if no permeability has been specified, use result for
     // close-packed spheres
@@ -217,28 +235,82 @@ void DustyGasTransport::getMolarFluxes(const doublereal* const state1,
         b = m_perm;
     }
     b *= gradp / m_gastran->viscosity();
-    scale(cbar, cbar + m_nsp, cbar, b);
 
-    // Multiply m_multidiff with cbar and add it to fluxes
-    increment(m_multidiff, cbar, fluxes);
-    scale(fluxes, fluxes + m_nsp, fluxes, -1.0);
+    // Solve H * fluxes = -(gradc + b * cbar / D_knud)
+    for (size_t k = 0; k < m_nsp; k++) {
+        fluxes[k] = -(gradc[k] + b * cbar[k] / m_dk[k]);
+    }
+    int ierr = m_hmatrix.solve(fluxes);
+    if (ierr != 0) {
+        throw CanteraError("DustyGasTransport::getMolarFluxes",
+                           "solve returned ierr = {}", ierr);
+    }
 }
 
-void DustyGasTransport::updateMultiDiffCoeffs()
+void DustyGasTransport::getMolarFluxes(size_t npairs, const doublereal* state1,
+                                       const doublereal* state2,
+                                       const doublereal* delta,
+                                       doublereal* fluxes)
+{
+    size_t nstate = m_nsp + 2;
+    for (size_t n = 0; n < npairs; n++) {
+        getMolarFluxes(state1 + n*nstate, state2 + n*nstate, delta[n],
+                       fluxes + n*m_nsp);
+    }
+}
+
+void DustyGasTransport::updateHMatrix()
 {
     // see if temperature has changed
     updateTransport_T();
 
     // update the mole fractions
     updateTransport_C();
+
+    doublereal pres = m_thermo->pressure();
+    if (m_hmatrix_ok && m_temp == m_hmatrix_temp &&
+        fabs(pres - m_hmatrix_pres) <= m_xtol * m_hmatrix_pres) {
+        doublereal dxmax = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            dxmax = std::max(dxmax, fabs(m_x[k] - m_hmatrix_x[k]));
+        }
+        if (dxmax <= m_xtol) {
+            return;
+        }
+    }
+
     eval_H_matrix();
+    m_multidiff_ok = false;
+    m_hmatrix_ok = false;
+    int ierr = m_hmatrix.factor();
+    if (ierr != 0) {
+        throw CanteraError("DustyGasTransport::updateHMatrix",
+                           "factor returned ierr = {}", ierr);
+    }
+    m_hmatrix_ok = true;
+    m_hmatrix_temp = m_temp;
+    m_hmatrix_pres = pres;
+    m_hmatrix_x = m_x;
+}
+
+void DustyGasTransport::updateMultiDiffCoeffs()
+{
+    updateHMatrix();
+    if (m_multidiff_ok) {
+        return;
+    }
 
-    // invert H
-    int ierr = invert(m_multidiff);
+    // invert H using its LU factorization
+    m_multidiff.zero();
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_multidiff(k,k) = 1.0;
+    }
+    int ierr = m_hmatrix.solve(m_multidiff.ptrColumn(0), m_nsp, m_nsp);
     if (ierr != 0) {
         throw CanteraError("DustyGasTransport::updateMultiDiffCoeffs",
-                           "invert returned ierr = {}", ierr);
+                           "solve returned ierr = {}", ierr);
     }
+    m_multidiff_ok = true;
 }
 
 void DustyGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* const d)
@@ -279,6 +351,7 @@ void DustyGasTransport::setPorosity(doublereal porosity)
     m_porosity = porosity;
     m_knudsen_ok = false;
     m_bulk_ok = false;
+    m_hmatrix_ok = false;
 }
 
 void DustyGasTransport::setTortuosity(doublereal tort)
@@ -286,12 +359,14 @@ void DustyGasTransport::setTortuosity(doublereal tort)
     m_tortuosity = tort;
     m_knudsen_ok = false;
     m_bulk_ok = false;
+    m_hmatrix_ok = false;
 }
 
 void DustyGasTransport::setMeanPoreRadius(doublereal rbar)
 {
     m_pore_radius = rbar;
     m_knudsen_ok = false;
+    m_hmatrix_ok = false;
 }
 
 void DustyGasTransport::setMeanParticleDiameter(doublereal dbar)
@@ -304,6 +379,11 @@ void DustyGasTransport::setPermeability(doublereal B)
     m_perm = B;
 }
 
+void DustyGasTransport::setCompositionTolerance(doublereal xtol)
+{
+    m_xtol = xtol;
+}
+
 Transport& DustyGasTransport::gasTransport()
 {
     return *m_gastran;
@@ -2,9 +2,14 @@
 #include "cantera/transport/GasTransport.h"
 #include "MMCollisionInt.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/base/parallel.h"
 #include "cantera/numerics/polyfit.h"
 #include "cantera/transport/TransportData.h"
 
+#include <fstream>
+#include <mutex>
+#include <random>
+
 namespace Cantera
 {
 
@@ -12,6 +17,19 @@ namespace Cantera
 //! except in CK mode, where the degree is 6.
 #define COLL_INT_POLY_DEGREE 8
 
+//! number of temperatures used to generate the property fits
+#define PROPERTY_FIT_POINTS 50
+
+//! Version of the format written by GasTransport::writeFits(). This should be
+//! incremented whenever the format or the fitting procedure changes, so that
+//! stale cache files are not used.
+#define FIT_CACHE_VERSION 1
+
+static std::mutex fit_options_mutex;
+static std::string fit_cache_dir;
+static bool fit_cache_dir_set = false;
+static size_t fit_threads = 0;
+
 GasTransport::GasTransport(ThermoPhase* thermo) :
     Transport(thermo),
     m_viscmix(0.0),
@@ -33,6 +51,7 @@ GasTransport::GasTransport(ThermoPhase* thermo) :
 }
 
 GasTransport::GasTransport(const GasTransport& right) :
+    Transport(right),
     m_viscmix(0.0),
     m_visc_ok(false),
     m_viscwt_ok(false),
@@ -49,10 +68,16 @@ GasTransport::GasTransport(const GasTransport& right) :
     m_t32(0.0),
     m_log_level(0)
 {
+    *this = right;
 }
 
 GasTransport& GasTransport::operator=(const GasTransport& right)
 {
+    if (&right == this) {
+        return *this;
+    }
+    Transport::operator=(right);
+
     m_molefracs = right.m_molefracs;
     m_viscmix = right.m_viscmix;
     m_visc_ok = right.m_visc_ok;
@@ -63,9 +88,11 @@ GasTransport& GasTransport::operator=(const GasTransport& right)
     m_phi = right.m_phi;
     m_spwork = right.m_spwork;
     m_visc = right.m_visc;
+    m_visccoeffs = right.m_visccoeffs;
     m_mw = right.m_mw;
-    m_wratjk = right.m_wratjk;
-    m_wratkj1 = right.m_wratkj1;
+    m_wilke_c = right.m_wilke_c;
+    m_mw_m14 = right.m_mw_m14;
+    m_wilke_a = right.m_wilke_a;
     m_sqvisc = right.m_sqvisc;
     m_polytempvec = right.m_polytempvec;
     m_temp = right.m_temp;
@@ -76,6 +103,8 @@ GasTransport& GasTransport::operator=(const GasTransport& right)
     m_t14 = right.m_t14;
     m_t32 = right.m_t32;
     m_diffcoeffs = right.m_diffcoeffs;
+    m_diffcoeffs_packed = right.m_diffcoeffs_packed;
+    m_bdiff_inv = right.m_bdiff_inv;
     m_bdiff = right.m_bdiff;
     m_condcoeffs = right.m_condcoeffs;
     m_poly = right.m_poly;
@@ -84,6 +113,7 @@ GasTransport& GasTransport::operator=(const GasTransport& right)
     m_bstar_poly = right.m_bstar_poly;
     m_cstar_poly = right.m_cstar_poly;
     m_zrot = right.m_zrot;
+    m_crot = right.m_crot;
     m_polar = right.m_polar;
     m_alpha = right.m_alpha;
     m_eps = right.m_eps;
@@ -154,26 +184,49 @@ doublereal GasTransport::viscosity()
 
 void GasTransport::updateViscosity_T()
 {
-    doublereal vratiokj, wratiojk, factor1;
     if (!m_spvisc_ok) {
         updateSpeciesViscosities();
     }
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_wilke_a[k] = m_sqvisc[k] * m_mw_m14[k];
+    }
 
     // see Eq. (9-5.15) of Reid, Prausnitz, and Poling
     for (size_t j = 0; j < m_nsp; j++) {
-        for (size_t k = j; k < m_nsp; k++) {
-            vratiokj = m_visc[k]/m_visc[j];
-            wratiojk = m_mw[j]/m_mw[k];
-
-            // Note that m_wratjk(k,j) holds the square root of m_wratjk(j,k)!
-            factor1 = 1.0 + (m_sqvisc[k]/m_sqvisc[j]) * m_wratjk(k,j);
-            m_phi(k,j) = factor1*factor1 / (sqrt(8.0) * m_wratkj1(j,k));
-            m_phi(j,k) = m_phi(k,j)/(vratiokj * wratiojk);
+        double aj = m_wilke_a[j];
+        double rj = 1.0 / (aj * aj);
+        const double* c = m_wilke_c.ptrColumn(j);
+        double* phi = m_phi.ptrColumn(j);
+        for (size_t k = 0; k < m_nsp; k++) {
+            double t = m_wilke_a[k] + aj;
+            phi[k] = c[k] * t * t * rj;
         }
     }
     m_viscwt_ok = true;
 }
 
+doublereal GasTransport::wilkeViscosity(const double* visc, const double* a,
+                                        const double* x, double* denom) const
+{
+    // see Eq. (9-5.15) of Reid, Prausnitz, and Poling. The loop over k runs
+    // down a column of m_wilke_c, and can be vectorized.
+    std::fill(denom, denom + m_nsp, 0.0);
+    for (size_t j = 0; j < m_nsp; j++) {
+        double aj = a[j];
+        double wj = x[j] / (aj * aj);
+        const double* c = m_wilke_c.ptrColumn(j);
+        for (size_t k = 0; k < m_nsp; k++) {
+            double t = a[k] + aj;
+            denom[k] += c[k] * t * t * wj;
+        }
+    }
+    doublereal vismix = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        vismix += x[k] * visc[k] / denom[k];
+    }
+    return vismix;
+}
+
 void GasTransport::updateSpeciesViscosities()
 {
     update_T();
@@ -195,27 +248,66 @@ void GasTransport::updateSpeciesViscosities()
 void GasTransport::updateDiff_T()
 {
     update_T();
-    // evaluate binary diffusion coefficients at unit pressure
+    double* b = m_bdiff_inv.data();
+    evalBinaryDiffFits(m_logt, m_t32, b);
     size_t ic = 0;
+    for (size_t i = 0; i < m_nsp; i++) {
+        for (size_t j = i; j < m_nsp; j++) {
+            m_bdiff(i,j) = b[ic];
+            m_bdiff(j,i) = b[ic];
+            ic++;
+        }
+    }
+    for (ic = 0; ic < m_bdiff_inv.size(); ic++) {
+        b[ic] = 1.0 / b[ic];
+    }
+    m_bindiff_ok = true;
+}
+
+void GasTransport::evalBinaryDiffFits(double logt, double t32, double* b) const
+{
+    // Evaluate the polynomial fits for all of the species pairs together
+    // using Horner's rule. The inner loops run over contiguous arrays, so
+    // they can be vectorized by the compiler.
+    size_t npair = m_diffcoeffs.size();
+    size_t ncoeff = m_diffcoeffs_packed.size() / npair;
+    const double* c = &m_diffcoeffs_packed[(ncoeff - 1) * npair];
+    std::copy(c, c + npair, b);
+    for (size_t n = ncoeff - 1; n > 0; n--) {
+        c -= npair;
+        for (size_t ic = 0; ic < npair; ic++) {
+            b[ic] = b[ic] * logt + c[ic];
+        }
+    }
+
+    // evaluate binary diffusion coefficients at unit pressure
     if (m_mode == CK_Mode) {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = exp(dot4(m_polytempvec, m_diffcoeffs[ic]));
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
-            }
+        for (size_t ic = 0; ic < npair; ic++) {
+            b[ic] = exp(b[ic]);
         }
     } else {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = m_temp * m_sqrt_t*dot5(m_polytempvec,
-                                                      m_diffcoeffs[ic]);
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
-            }
+        for (size_t ic = 0; ic < npair; ic++) {
+            b[ic] *= t32;
         }
     }
-    m_bindiff_ok = true;
+}
+
+void GasTransport::sumInvBinaryDiff(const double* binv, const double* w,
+                                    double* sum) const
+{
+    std::fill(sum, sum + m_nsp, 0.0);
+    size_t ic = 0;
+    for (size_t i = 0; i < m_nsp; i++) {
+        ic++; // skip the diagonal term
+        double wi = w[i];
+        double sumi = 0.0;
+        for (size_t j = i + 1; j < m_nsp; j++) {
+            sumi += w[j] * binv[ic];
+            sum[j] += wi * binv[ic];
+            ic++;
+        }
+        sum[i] += sumi;
+    }
 }
 
 void GasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal* const d)
@@ -255,13 +347,10 @@ void GasTransport::getMixDiffCoeffs(doublereal* const d)
         for (size_t k = 0; k < m_nsp; k++) {
             sumxw += m_molefracs[k] * m_mw[k];
         }
+        vector_fp sums(m_nsp);
+        sumInvBinaryDiff(m_bdiff_inv.data(), m_molefracs.data(), sums.data());
         for (size_t k = 0; k < m_nsp; k++) {
-            double sum2 = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != k) {
-                    sum2 += m_molefracs[j] / m_bdiff(j,k);
-                }
-            }
+            double sum2 = sums[k];
             if (sum2 <= 0.0) {
                 d[k] = m_bdiff(k,k) / p;
             } else {
@@ -285,13 +374,10 @@ void GasTransport::getMixDiffCoeffsMole(doublereal* const d)
     if (m_nsp == 1) {
         d[0] = m_bdiff(0,0) / p;
     } else {
+        vector_fp sums(m_nsp);
+        sumInvBinaryDiff(m_bdiff_inv.data(), m_molefracs.data(), sums.data());
         for (size_t k = 0; k < m_nsp; k++) {
-            double sum2 = 0.0;
-            for (size_t j = 0; j < m_nsp; j++) {
-                if (j != k) {
-                    sum2 += m_molefracs[j] / m_bdiff(j,k);
-                }
-            }
+            double sum2 = sums[k];
             if (sum2 <= 0.0) {
                 d[k] = m_bdiff(k,k) / p;
             } else {
@@ -317,16 +403,15 @@ void GasTransport::getMixDiffCoeffsMass(doublereal* const d)
     if (m_nsp == 1) {
         d[0] = m_bdiff(0,0) / p;
     } else {
+        vector_fp sums1(m_nsp), sums2(m_nsp), xw(m_nsp);
+        for (size_t k = 0; k < m_nsp; k++) {
+            xw[k] = m_molefracs[k] * m_mw[k];
+        }
+        sumInvBinaryDiff(m_bdiff_inv.data(), m_molefracs.data(), sums1.data());
+        sumInvBinaryDiff(m_bdiff_inv.data(), xw.data(), sums2.data());
         for (size_t k=0; k<m_nsp; k++) {
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            for (size_t i=0; i<m_nsp; i++) {
-                if (i==k) {
-                    continue;
-                }
-                sum1 += m_molefracs[i] / m_bdiff(k,i);
-                sum2 += m_molefracs[i] * m_mw[i] / m_bdiff(k,i);
-            }
+            double sum1 = sums1[k];
+            double sum2 = sums2[k];
             sum1 *= p;
             sum2 *= p * m_molefracs[k] / (mmw - m_mw[k]*m_molefracs[k]);
             d[k] = 1.0 / (sum1 + sum2);
@@ -348,18 +433,18 @@ void GasTransport::init(thermo_t* thermo, int mode, int log_level)
     m_visc.resize(m_nsp);
     m_sqvisc.resize(m_nsp);
     m_phi.resize(m_nsp, m_nsp, 0.0);
+    m_wilke_a.resize(m_nsp);
     m_bdiff.resize(m_nsp, m_nsp);
 
     // make a local copy of the molecular weights
     m_mw = m_thermo->molecularWeights();
 
-    m_wratjk.resize(m_nsp, m_nsp, 0.0);
-    m_wratkj1.resize(m_nsp, m_nsp, 0.0);
+    m_mw_m14.resize(m_nsp);
+    m_wilke_c.resize(m_nsp, m_nsp, 0.0);
     for (size_t j = 0; j < m_nsp; j++) {
-        for (size_t k = j; k < m_nsp; k++) {
-            m_wratjk(j,k) = sqrt(m_mw[j]/m_mw[k]);
-            m_wratjk(k,j) = sqrt(m_wratjk(j,k));
-            m_wratkj1(j,k) = sqrt(1.0 + m_mw[k]/m_mw[j]);
+        m_mw_m14[j] = 1.0 / sqrt(sqrt(m_mw[j]));
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_wilke_c(k,j) = 1.0 / sqrt(8.0 * (1.0 + m_mw[k]/m_mw[j]));
         }
     }
 
@@ -439,16 +524,214 @@ void GasTransport::setupMM()
         tstar_max = 99.9;
     }
 
-    // initialize the collision integral calculator for the desired T* range
-    debuglog("*** collision_integrals ***\n", m_log_level);
-    MMCollisionInt integrals;
-    integrals.init(tstar_min, tstar_max, m_log_level);
-    fitCollisionIntegrals(integrals);
-    debuglog("*** end of collision_integrals ***\n", m_log_level);
-    // make polynomial fits
-    debuglog("*** property fits ***\n", m_log_level);
-    fitProperties(integrals);
-    debuglog("*** end of property fits ***\n", m_log_level);
+    // check for previously generated fits for the same species data
+    std::string cacheDir = fitCacheDirectory();
+    std::string key, cacheFile;
+    bool cached = false;
+    if (!cacheDir.empty()) {
+        key = fitCacheKey();
+        cacheFile = cacheDir + "/transport-fits-" + key + ".txt";
+        std::ifstream s(cacheFile);
+        cached = s && readFits(s, key);
+        if (cached) {
+            debuglog("*** using fits from " + cacheFile + " ***\n",
+                     m_log_level);
+        }
+    }
+
+    if (!cached) {
+        // initialize the collision integral calculator for the desired T* range
+        debuglog("*** collision_integrals ***\n", m_log_level);
+        MMCollisionInt integrals;
+        integrals.init(tstar_min, tstar_max, m_log_level);
+        fitCollisionIntegrals(integrals);
+        debuglog("*** end of collision_integrals ***\n", m_log_level);
+        // make polynomial fits
+        debuglog("*** property fits ***\n", m_log_level);
+        fitProperties(integrals);
+        debuglog("*** end of property fits ***\n", m_log_level);
+
+        if (!cacheFile.empty()) {
+            // Write to a temporary file which is then renamed, so that other
+            // processes never read a partially written file. Failing to write
+            // the cache is not an error.
+            std::random_device rd;
+            std::string tmpFile = fmt::format("{}.{:x}", cacheFile, rd());
+            bool ok;
+            {
+                std::ofstream s(tmpFile);
+                writeFits(s, key);
+                ok = s.good();
+            }
+            if (!ok || std::rename(tmpFile.c_str(), cacheFile.c_str()) != 0) {
+                std::remove(tmpFile.c_str());
+            }
+        }
+    }
+
+    // Store the coefficients of the binary diffusion coefficient fits in
+    // coefficient-major order for updateDiff_T()
+    size_t npair = m_diffcoeffs.size();
+    size_t ncoeffs = (npair ? m_diffcoeffs[0].size() : 0);
+    m_diffcoeffs_packed.assign(ncoeffs * npair, 0.0);
+    for (size_t ic = 0; ic < npair; ic++) {
+        for (size_t n = 0; n < ncoeffs; n++) {
+            m_diffcoeffs_packed[n * npair + ic] = m_diffcoeffs[ic][n];
+        }
+    }
+    m_bdiff_inv.resize(npair);
+}
+
+void GasTransport::setFitCacheDirectory(const std::string& dir)
+{
+    std::unique_lock<std::mutex> lock(fit_options_mutex);
+    fit_cache_dir = dir;
+    fit_cache_dir_set = true;
+}
+
+std::string GasTransport::fitCacheDirectory()
+{
+    std::unique_lock<std::mutex> lock(fit_options_mutex);
+    if (!fit_cache_dir_set) {
+        const char* dir = getenv("CANTERA_TRANSPORT_CACHE");
+        fit_cache_dir = (dir ? dir : "");
+        fit_cache_dir_set = true;
+    }
+    return fit_cache_dir;
+}
+
+void GasTransport::setFitThreads(size_t nthreads)
+{
+    std::unique_lock<std::mutex> lock(fit_options_mutex);
+    fit_threads = nthreads;
+}
+
+size_t GasTransport::fitThreads()
+{
+    std::unique_lock<std::mutex> lock(fit_options_mutex);
+    return (fit_threads ? fit_threads : hardwareThreads());
+}
+
+std::string GasTransport::fitCacheKey()
+{
+    // Serialize everything that the fits depend on at full precision
+    std::string data = fmt::format("{} {} {} {} {:.17g} {:.17g}\n",
+        FIT_CACHE_VERSION, m_mode, COLL_INT_POLY_DEGREE, m_nsp,
+        m_thermo->minTemp(), m_thermo->maxTemp());
+    const vector_fp& mw = m_thermo->molecularWeights();
+    for (size_t k = 0; k < m_nsp; k++) {
+        data += fmt::format("{} {:.17g} {:.17g} {:.17g} {:.17g} {:.17g} "
+                            "{:.17g} {:.17g}\n", m_thermo->speciesName(k),
+                            mw[k], m_sigma[k], m_eps[k], m_dipole(k,k),
+                            m_alpha[k], m_zrot[k], m_crot[k]);
+    }
+
+    // The conductivity fits depend on the heat capacities at the same
+    // temperatures used in fitProperties()
+    const size_t np = PROPERTY_FIT_POINTS;
+    double dt = (m_thermo->maxTemp() - m_thermo->minTemp())/(np-1);
+    vector_fp cp_R(m_nsp);
+    for (size_t n = 0; n < np; n++) {
+        m_thermo->setTemperature(m_thermo->minTemp() + dt*n);
+        m_thermo->getCp_R_ref(cp_R.data());
+        for (size_t k = 0; k < m_nsp; k++) {
+            data += fmt::format("{:.17g} ", cp_R[k]);
+        }
+    }
+
+    // 64-bit FNV-1a hash
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return fmt::format("{:016x}", hash);
+}
+
+void GasTransport::writeFits(std::ostream& s, const std::string& key) const
+{
+    size_t npoly = m_astar_poly.size();
+    s << key << "\n";
+    s << fmt::format("{} {} {}\n", m_mode, m_nsp, npoly);
+    for (const auto* fits : {&m_omega22_poly, &m_astar_poly, &m_bstar_poly,
+                             &m_cstar_poly}) {
+        for (const auto& c : *fits) {
+            for (double a : c) {
+                s << fmt::format("{:.17g} ", a);
+            }
+            s << "\n";
+        }
+    }
+    for (size_t i = 0; i < m_nsp; i++) {
+        for (size_t j = i; j < m_nsp; j++) {
+            s << m_poly[i][j] << " ";
+        }
+        s << "\n";
+    }
+    for (const auto* fits : {&m_visccoeffs, &m_condcoeffs, &m_diffcoeffs}) {
+        for (const auto& c : *fits) {
+            for (double a : c) {
+                s << fmt::format("{:.17g} ", a);
+            }
+            s << "\n";
+        }
+    }
+}
+
+bool GasTransport::readFits(std::istream& s, const std::string& key)
+{
+    std::string fileKey;
+    int mode;
+    size_t nsp, npoly;
+    s >> fileKey >> mode >> nsp >> npoly;
+    if (!s || fileKey != key || mode != m_mode || nsp != m_nsp
+        || npoly > m_nsp * (m_nsp + 1) / 2) {
+        return false;
+    }
+
+    size_t ncoll = (m_mode == CK_Mode ? 6 : COLL_INT_POLY_DEGREE) + 1;
+    size_t nprop = (m_mode == CK_Mode ? 3 : 4) + 1;
+    auto readCoeffs = [&](size_t n, size_t len, std::vector<vector_fp>& out) {
+        out.assign(n, vector_fp(len));
+        for (size_t i = 0; i < n; i++) {
+            for (size_t m = 0; m < len; m++) {
+                s >> out[i][m];
+            }
+        }
+        return bool(s);
+    };
+
+    std::vector<vector_fp> om22, astar, bstar, cstar;
+    if (!readCoeffs(npoly, ncoll, om22) || !readCoeffs(npoly, ncoll, astar) ||
+        !readCoeffs(npoly, ncoll, bstar) || !readCoeffs(npoly, ncoll, cstar)) {
+        return false;
+    }
+    std::vector<vector_int> poly(m_nsp, vector_int(m_nsp));
+    for (size_t i = 0; i < m_nsp; i++) {
+        for (size_t j = i; j < m_nsp; j++) {
+            s >> poly[i][j];
+            if (!s || poly[i][j] < 0 ||
+                static_cast<size_t>(poly[i][j]) >= npoly) {
+                return false;
+            }
+            poly[j][i] = poly[i][j];
+        }
+    }
+    std::vector<vector_fp> visc, cond, diff;
+    if (!readCoeffs(m_nsp, nprop, visc) || !readCoeffs(m_nsp, nprop, cond) ||
+        !readCoeffs(m_nsp * (m_nsp + 1) / 2, nprop, diff)) {
+        return false;
+    }
+
+    m_omega22_poly = om22;
+    m_astar_poly = astar;
+    m_bstar_poly = bstar;
+    m_cstar_poly = cstar;
+    m_poly = poly;
+    m_visccoeffs = visc;
+    m_condcoeffs = cond;
+    m_diffcoeffs = diff;
+    return true;
 }
 
 void GasTransport::getTransportData()
@@ -519,6 +802,7 @@ void GasTransport::fitCollisionIntegrals(MMCollisionInt& integrals)
             writelog("*** polynomial coefficients not printed (log_level < 3) ***\n");
         }
     }
+    size_t offset = m_astar_poly.size();
     vector_fp fitlist;
     for (size_t i = 0; i < m_nsp; i++) {
         for (size_t j = i; j < m_nsp; j++) {
@@ -536,50 +820,57 @@ void GasTransport::fitCollisionIntegrals(MMCollisionInt& integrals)
             // 'find' returns a pointer to end() if not found
             auto dptr = find(fitlist.begin(), fitlist.end(), dstar);
             if (dptr == fitlist.end()) {
-                vector_fp ca(degree+1), cb(degree+1), cc(degree+1);
-                vector_fp co22(degree+1);
-                integrals.fit(degree, dstar, ca.data(), cb.data(), cc.data());
-                integrals.fit_omega22(degree, dstar, co22.data());
-                m_omega22_poly.push_back(co22);
-                m_astar_poly.push_back(ca);
-                m_bstar_poly.push_back(cb);
-                m_cstar_poly.push_back(cc);
-                m_poly[i][j] = static_cast<int>(m_astar_poly.size()) - 1;
+                m_poly[i][j] = static_cast<int>(offset + fitlist.size());
                 fitlist.push_back(dstar);
             } else {
                 // delta* found in fitlist, so just point to this polynomial
-                m_poly[i][j] = static_cast<int>((dptr - fitlist.begin()));
+                m_poly[i][j] = static_cast<int>(offset +
+                                                (dptr - fitlist.begin()));
             }
             m_poly[j][i] = m_poly[i][j];
         }
     }
+
+    // generate the fits for each distinct value of delta*. MMCollisionInt
+    // writes warnings about the fits if log_level > 0 and the coefficients if
+    // log_level > 2, so only one thread is used in that case. This keeps the
+    // output in order, and sends it to the logger of the calling thread.
+    size_t nfit = fitlist.size();
+    m_omega22_poly.resize(offset + nfit, vector_fp(degree+1));
+    m_astar_poly.resize(offset + nfit, vector_fp(degree+1));
+    m_bstar_poly.resize(offset + nfit, vector_fp(degree+1));
+    m_cstar_poly.resize(offset + nfit, vector_fp(degree+1));
+    parallel_for(nfit, m_log_level ? 1 : fitThreads(), [&](size_t n) {
+        size_t ic = offset + n;
+        integrals.fit(degree, fitlist[n], m_astar_poly[ic].data(),
+                      m_bstar_poly[ic].data(), m_cstar_poly[ic].data());
+        integrals.fit_omega22(degree, fitlist[n], m_omega22_poly[ic].data());
+    });
 }
 
 void GasTransport::fitProperties(MMCollisionInt& integrals)
 {
-    int ndeg = 0;
     // number of points to use in generating fit data
-    const size_t np = 50;
+    const size_t np = PROPERTY_FIT_POINTS;
     int degree = (m_mode == CK_Mode ? 3 : 4);
     double dt = (m_thermo->maxTemp() - m_thermo->minTemp())/(np-1);
-    vector_fp tlog(np), spvisc(np), spcond(np);
-    vector_fp w(np), w2(np);
+    vector_fp tlog(np);
 
-    // generate array of log(t) values
+    // generate array of log(t) values, and evaluate the heat capacities at
+    // each temperature before starting any threads, since the ThermoPhase
+    // object can only be used by one thread at a time.
+    DenseMatrix cp_R_all(m_nsp, np);
     for (size_t n = 0; n < np; n++) {
         double t = m_thermo->minTemp() + dt*n;
         tlog[n] = log(t);
+        m_thermo->setTemperature(t);
+        m_thermo->getCp_R_ref(cp_R_all.ptrColumn(n));
     }
 
-    // vector of polynomial coefficients
-    vector_fp c(degree + 1), c2(degree + 1);
-
     // fit the pure-species viscosity and thermal conductivity for each species
     if (m_log_level && m_log_level < 2) {
         writelog("*** polynomial coefficients not printed (log_level < 2) ***\n");
     }
-    double sqrt_T, visc, err, relerr,
-               mxerr = 0.0, mxrelerr = 0.0, mxerr_cond = 0.0, mxrelerr_cond = 0.0;
 
     if (m_log_level) {
         writelog("Polynomial fits for viscosity:\n");
@@ -591,17 +882,26 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
         }
     }
 
-    double cp_R, cond, w_RT, f_int, A_factor, B_factor, c1, cv_rot, cv_int,
-           f_rot, f_trans, om11, diffcoeff;
-
     const vector_fp& mw = m_thermo->molecularWeights();
-    for (size_t k = 0; k < m_nsp; k++) {
+    size_t nthreads = fitThreads();
+    std::vector<vector_fp> visccoeffs(m_nsp, vector_fp(degree + 1));
+    std::vector<vector_fp> condcoeffs(m_nsp, vector_fp(degree + 1));
+
+    // maximum absolute and relative errors of the fits for each species, in
+    // the order viscosity, conductivity
+    DenseMatrix sperr(4, m_nsp);
+    parallel_for(m_nsp, nthreads, [&](size_t k) {
+        vector_fp spvisc(np), spcond(np), w(np), w2(np);
+        vector_fp& c = visccoeffs[k];
+        vector_fp& c2 = condcoeffs[k];
+        int ndeg = 0;
+        double sqrt_T, visc, err, relerr, mxerr = 0.0, mxrelerr = 0.0,
+               mxerr_cond = 0.0, mxrelerr_cond = 0.0;
+        double cp_R, cond, w_RT, f_int, A_factor, B_factor, c1, cv_rot, cv_int,
+               f_rot, f_trans, om11, diffcoeff;
         for (size_t n = 0; n < np; n++) {
             double t = m_thermo->minTemp() + dt*n;
-            m_thermo->setTemperature(t);
-            vector_fp cp_R_all(m_thermo->nSpecies());
-            m_thermo->getCp_R_ref(&cp_R_all[0]);
-            cp_R = cp_R_all[k];
+            cp_R = cp_R_all(k,n);
             double tstar = Boltzmann * t/ m_eps[k];
             sqrt_T = sqrt(t);
             double om22 = integrals.omega22(tstar, m_delta(k,k));
@@ -689,11 +989,23 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
             mxerr_cond = std::max(mxerr_cond, fabs(err));
             mxrelerr_cond = std::max(mxrelerr_cond, fabs(relerr));
         }
-        m_visccoeffs.push_back(c);
-        m_condcoeffs.push_back(c2);
+        sperr(0,k) = mxerr;
+        sperr(1,k) = mxrelerr;
+        sperr(2,k) = mxerr_cond;
+        sperr(3,k) = mxrelerr_cond;
+    });
 
+    double mxerr = 0.0, mxrelerr = 0.0, mxerr_cond = 0.0, mxrelerr_cond = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_visccoeffs.push_back(visccoeffs[k]);
+        m_condcoeffs.push_back(condcoeffs[k]);
+        mxerr = std::max(mxerr, sperr(0,k));
+        mxrelerr = std::max(mxrelerr, sperr(1,k));
+        mxerr_cond = std::max(mxerr_cond, sperr(2,k));
+        mxrelerr_cond = std::max(mxrelerr_cond, sperr(3,k));
         if (m_log_level >= 2) {
-            writelog(m_thermo->speciesName(k) + ": [" + vec2str(c) + "]\n");
+            writelog(m_thermo->speciesName(k) + ": [" +
+                     vec2str(visccoeffs[k]) + "]\n");
         }
     }
     if (m_log_level) {
@@ -724,58 +1036,82 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
         }
     }
 
-    mxerr = 0.0, mxrelerr = 0.0;
-    vector_fp diff(np + 1);
-    double eps, sigma;
+    // fit the binary diffusion coefficients for each species pair
+    size_t npair = m_nsp * (m_nsp + 1) / 2;
+    std::vector<std::pair<size_t, size_t>> pairs;
+    pairs.reserve(npair);
     for (size_t k = 0; k < m_nsp; k++) {
         for (size_t j = k; j < m_nsp; j++) {
-            for (size_t n = 0; n < np; n++) {
-                double t = m_thermo->minTemp() + dt*n;
-                eps = m_epsilon(j,k);
-                double tstar = Boltzmann * t/eps;
-                sigma = m_diam(j,k);
-                om11 = integrals.omega11(tstar, m_delta(j,k));
-                diffcoeff = 3.0/16.0 * sqrt(2.0 * Pi/m_reducedMass(k,j)) *
-                            pow(Boltzmann * t, 1.5) /
-                            (Pi * sigma * sigma * om11);
-
-                // 2nd order correction
-                // NOTE: THIS CORRECTION IS NOT APPLIED
-                double fkj, fjk;
-                getBinDiffCorrection(t, integrals, k, j, 1.0, 1.0, fkj, fjk);
-
-                if (m_mode == CK_Mode) {
-                    diff[n] = log(diffcoeff);
-                    w[n] = -1.0;
-                } else {
-                    diff[n] = diffcoeff/pow(t, 1.5);
-                    w[n] = 1.0/(diff[n]*diff[n]);
-                }
-            }
-            polyfit(np, tlog.data(), diff.data(),
-                    w.data(), degree, ndeg, 0.0, c.data());
-
-            for (size_t n = 0; n < np; n++) {
-                double val, fit;
-                if (m_mode == CK_Mode) {
-                    val = exp(diff[n]);
-                    fit = exp(poly3(tlog[n], c.data()));
-                } else {
-                    double t = exp(tlog[n]);
-                    double pre = pow(t, 1.5);
-                    val = pre * diff[n];
-                    fit = pre * poly4(tlog[n], c.data());
-                }
-                err = fit - val;
-                relerr = err/val;
-                mxerr = std::max(mxerr, fabs(err));
-                mxrelerr = std::max(mxrelerr, fabs(relerr));
+            pairs.emplace_back(k, j);
+        }
+    }
+    std::vector<vector_fp> diffcoeffs(npair, vector_fp(degree + 1));
+    DenseMatrix pairerr(2, npair);
+    parallel_for(npair, nthreads, [&](size_t ic) {
+        size_t k = pairs[ic].first;
+        size_t j = pairs[ic].second;
+        vector_fp diff(np + 1), w(np);
+        vector_fp& c = diffcoeffs[ic];
+        int ndeg = 0;
+        double eps, sigma, om11, diffcoeff, err, relerr;
+        double mxerr = 0.0, mxrelerr = 0.0;
+        for (size_t n = 0; n < np; n++) {
+            double t = m_thermo->minTemp() + dt*n;
+            eps = m_epsilon(j,k);
+            double tstar = Boltzmann * t/eps;
+            sigma = m_diam(j,k);
+            om11 = integrals.omega11(tstar, m_delta(j,k));
+            diffcoeff = 3.0/16.0 * sqrt(2.0 * Pi/m_reducedMass(k,j)) *
+                        pow(Boltzmann * t, 1.5) /
+                        (Pi * sigma * sigma * om11);
+
+            // 2nd order correction
+            // NOTE: THIS CORRECTION IS NOT APPLIED
+            double fkj, fjk;
+            getBinDiffCorrection(t, integrals, k, j, 1.0, 1.0, fkj, fjk);
+
+            if (m_mode == CK_Mode) {
+                diff[n] = log(diffcoeff);
+                w[n] = -1.0;
+            } else {
+                diff[n] = diffcoeff/pow(t, 1.5);
+                w[n] = 1.0/(diff[n]*diff[n]);
             }
-            m_diffcoeffs.push_back(c);
-            if (m_log_level >= 2) {
-                writelog(m_thermo->speciesName(k) + "__" +
-                         m_thermo->speciesName(j) + ": [" + vec2str(c) + "]\n");
+        }
+        polyfit(np, tlog.data(), diff.data(),
+                w.data(), degree, ndeg, 0.0, c.data());
+
+        for (size_t n = 0; n < np; n++) {
+            double val, fit;
+            if (m_mode == CK_Mode) {
+                val = exp(diff[n]);
+                fit = exp(poly3(tlog[n], c.data()));
+            } else {
+                double t = exp(tlog[n]);
+                double pre = pow(t, 1.5);
+                val = pre * diff[n];
+                fit = pre * poly4(tlog[n], c.data());
             }
+            err = fit - val;
+            relerr = err/val;
+            mxerr = std::max(mxerr, fabs(err));
+            mxrelerr = std::max(mxrelerr, fabs(relerr));
+        }
+        pairerr(0,ic) = mxerr;
+        pairerr(1,ic) = mxrelerr;
+    });
+
+    mxerr = 0.0, mxrelerr = 0.0;
+    for (size_t ic = 0; ic < npair; ic++) {
+        m_diffcoeffs.push_back(diffcoeffs[ic]);
+        mxerr = std::max(mxerr, pairerr(0,ic));
+        mxrelerr = std::max(mxrelerr, pairerr(1,ic));
+        if (m_log_level >= 2) {
+            size_t k = pairs[ic].first;
+            size_t j = pairs[ic].second;
+            writelog(m_thermo->speciesName(k) + "__" +
+                     m_thermo->speciesName(j) + ": [" +
+                     vec2str(diffcoeffs[ic]) + "]\n");
         }
     }
     if (m_log_level) {
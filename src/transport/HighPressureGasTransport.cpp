@@ -25,9 +25,67 @@ namespace Cantera
 
 HighPressureGasTransport::HighPressureGasTransport(thermo_t* thermo)
 : MultiTransport(thermo)
+, m_Tc_mix(0.0)
+, m_Pc_mix(0.0)
+, m_lucas_Afac(1.0)
+, m_ksi(0.0)
+, m_lucas_state(-1)
+, m_Pcorr_T(-1.0)
+, m_Pcorr_P(-1.0)
+, m_Pcorr_state(-1)
 {
 }
 
+void HighPressureGasTransport::init(thermo_t* thermo, int mode, int log_level)
+{
+    MultiTransport::init(thermo, mode, log_level);
+    m_hp_molefracs.resize(m_nsp);
+    m_Pcorr.resize(m_nsp * m_nsp);
+    updateSpeciesCriticalProperties();
+}
+
+void HighPressureGasTransport::updateSpeciesCriticalProperties()
+{
+    m_Tcrit.resize(m_nsp);
+    m_Pcrit.resize(m_nsp);
+    m_Vcrit.resize(m_nsp);
+    m_Zcrit.resize(m_nsp);
+    m_FP_polar.assign(m_nsp, 0.0);
+    m_FP_Tdep.assign(m_nsp, false);
+    m_FQ_Q.assign(m_nsp, 0.0);
+    for (size_t i = 0; i < m_nsp; i++) {
+        m_Tcrit[i] = Tcrit_i(i);
+        m_Pcrit[i] = Pcrit_i(i);
+        m_Vcrit[i] = Vcrit_i(i);
+        m_Zcrit[i] = Zcrit_i(i);
+
+        // Reduced dipole moment for the polar correction term of the Lucas
+        // viscosity model:
+        doublereal mu_ri = 52.46*100000*m_dipole(i,i)*m_dipole(i,i)
+            *m_Pcrit[i]/(m_Tcrit[i]*m_Tcrit[i]);
+        if (mu_ri >= 0.022) {
+            m_FP_polar[i] = 30.55*pow(0.292 - m_Zcrit[i], 1.72);
+            m_FP_Tdep[i] = (mu_ri >= 0.075);
+        }
+
+        // Quantum correction term.
+        // SCD Note:  This assumes the species of interest (He, H2, and D2) have
+        //   been named in this specific way.  They are perhaps the most obvious
+        //   names, butit would of course be preferred to have a more general
+        //   approach, here.
+        std::string name = m_thermo->speciesName(i);
+        if (name == "He") {
+            m_FQ_Q[i] = 1.38;
+        } else if (name == "H2") {
+            m_FQ_Q[i] = 0.76;
+        } else if (name == "D2") {
+            m_FQ_Q[i] = 0.52;
+        }
+    }
+    m_lucas_state = -1;
+    m_Pcorr_state = -1;
+}
+
 double HighPressureGasTransport::thermalConductivity()
 {
     //  Method of Ely and Hanley:
@@ -43,14 +101,15 @@ double HighPressureGasTransport::thermalConductivity()
     vector_fp L_i(nsp);
     vector_fp f_i(nsp);
     vector_fp h_i(nsp);
+    vector_fp h13_i(nsp);
     vector_fp V_k(nsp);
 
     m_thermo -> getPartialMolarVolumes(&V_k[0]);
     doublereal L_i_min = BigNumber;
 
     for (size_t i = 0; i < m_nsp; i++) {
-        doublereal Tc_i = Tcrit_i(i);
-        doublereal Vc_i = Vcrit_i(i);
+        doublereal Tc_i = m_Tcrit[i];
+        doublereal Vc_i = m_Vcrit[i];
         doublereal T_r = m_thermo->temperature()/Tc_i;
         doublereal V_r = V_k[i]/Vc_i;
         doublereal T_p = std::min(T_r,2.0);
@@ -60,7 +119,7 @@ double HighPressureGasTransport::thermalConductivity()
         doublereal theta_p = 1.0 + (m_w_ac[i] - 0.011)*(0.56553
             - 0.86276*log(T_p) - 0.69852/T_p);
         doublereal phi_p = (1.0 + (m_w_ac[i] - 0.011)*(0.38560
-            - 1.1617*log(T_p)))*0.288/Zcrit_i(i);
+            - 1.1617*log(T_p)))*0.288/m_Zcrit[i];
         doublereal f_fac = Tc_i*theta_p/190.4;
         doublereal h_fac = 1000*Vc_i*phi_p/99.2;
         doublereal T_0 = m_temp/f_fac;
@@ -76,9 +135,10 @@ double HighPressureGasTransport::thermalConductivity()
         doublereal theta_s = 1 + (m_w_ac[i] - 0.011)*(0.09057 - 0.86276*log(T_p)
             + (0.31664 - 0.46568/T_p)*(V_p - 0.5));
         doublereal phi_s = (1 + (m_w_ac[i] - 0.011)*(0.39490*(V_p - 1.02355)
-            - 0.93281*(V_p - 0.75464)*log(T_p)))*0.288/Zcrit_i(i);
+            - 0.93281*(V_p - 0.75464)*log(T_p)))*0.288/m_Zcrit[i];
         f_i[i] = Tc_i*theta_s/190.4;
         h_i[i] = 1000*Vc_i*phi_s/99.2;
+        h13_i[i] = pow(h_i[i], 1./3.);
     }
 
     doublereal h_m = 0;
@@ -91,7 +151,7 @@ double HighPressureGasTransport::thermalConductivity()
             Lprime_m += molefracs[i]*molefracs[j]*L_ij;
             // Additional variables for density-dependent component:
             doublereal f_ij = sqrt(f_i[i]*f_i[j]);
-            doublereal h_ij = 0.125*pow(pow(h_i[i],1./3.) + pow(h_i[j],1./3.),3.);
+            doublereal h_ij = 0.125*pow(h13_i[i] + h13_i[j], 3.);
             doublereal mw_ij_inv = (m_mw[i] + m_mw[j])/(2*m_mw[i]*m_mw[j]);
             f_m += molefracs[i]*molefracs[j]*f_ij*h_ij;
             h_m += molefracs[i]*molefracs[j]*h_ij;
@@ -132,37 +192,56 @@ void HighPressureGasTransport::getThermalDiffCoeffs(doublereal* const dt)
 
 void HighPressureGasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal* const d)
 {
-    doublereal P_corr_ij, Tr_ij, Pr_ij;
-    vector_fp PcP(5);
-    size_t nsp = m_thermo->nSpecies();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
-
+    if (ld < m_nsp) {
+        throw CanteraError("HighPressureTransport::getBinaryDiffCoeffs()", "ld is too small");
+    }
     update_T();
     // Evaluate the binary diffusion coefficients from the polynomial fits.
-    // This should perhaps be preceded by a check to see whether any of T, P, or
-    //   C have changed.
-    //if (!m_bindiff_ok) {
-    updateDiff_T();
-    //}
-    if (ld < nsp) {
-        throw CanteraError("HighPressureTransport::getBinaryDiffCoeffs()", "ld is too small");
+    if (!m_bindiff_ok) {
+        updateDiff_T();
+    }
+
+    // The Takahashi corrections depend on the temperature, pressure and
+    // composition
+    doublereal P = m_thermo->pressure();
+    int state = m_thermo->stateMFNumber();
+    if (state != m_Pcorr_state || m_temp != m_Pcorr_T || P != m_Pcorr_P) {
+        m_thermo->getMoleFractions(m_hp_molefracs.data());
+        evalTakahashiCorrections(m_temp, P, m_hp_molefracs.data(),
+                                 m_Pcorr.data());
+        m_Pcorr_state = state;
+        m_Pcorr_T = m_temp;
+        m_Pcorr_P = P;
+    }
+
+    // Multiply the standard low-pressure binary diffusion coefficient
+    // (m_bdiff) by the Takahashi correction factor P_corr_ij:
+    doublereal rp = 1.0/P;
+    for (size_t j = 0; j < m_nsp; j++) {
+        for (size_t i = 0; i < m_nsp; i++) {
+            d[ld*j + i] = m_Pcorr[m_nsp*j + i]*rp * m_bdiff(i,j);
+        }
     }
-    doublereal rp = 1.0/m_thermo->pressure();
-    for (size_t i = 0; i < nsp; i++) {
-        for (size_t j = 0; j < nsp; j++) {
+}
+
+void HighPressureGasTransport::evalTakahashiCorrections(doublereal T,
+        doublereal P, const doublereal* x, doublereal* Pcorr)
+{
+    doublereal P_corr_ij, Tr_ij, Pr_ij;
+    for (size_t i = 0; i < m_nsp; i++) {
+        for (size_t j = 0; j < m_nsp; j++) {
             // Add an offset to avoid a condition where x_i and x_j both equal
             // zero (this would lead to Pr_ij = Inf):
-            doublereal x_i = std::max(Tiny, molefracs[i]);
-            doublereal x_j = std::max(Tiny, molefracs[j]);
+            doublereal x_i = std::max(Tiny, x[i]);
+            doublereal x_j = std::max(Tiny, x[j]);
 
             // Weight mole fractions of i and j so that X_i + X_j = 1.0:
             x_i = x_i/(x_i + x_j);
             x_j = x_j/(x_i + x_j);
 
             //Calculate Tr and Pr based on mole-fraction-weighted crit constants:
-            Tr_ij = m_temp/(x_i*Tcrit_i(i) + x_j*Tcrit_i(j));
-            Pr_ij = m_thermo->pressure()/(x_i*Pcrit_i(i) + x_j*Pcrit_i(j));
+            Tr_ij = T/(x_i*m_Tcrit[i] + x_j*m_Tcrit[j]);
+            Pr_ij = P/(x_i*m_Pcrit[i] + x_j*m_Pcrit[j]);
 
             if (Pr_ij < 0.1) {
                 // If pressure is low enough, no correction is needed:
@@ -178,10 +257,7 @@ void HighPressureGasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal*
                     P_corr_ij = Tiny;
                 }
             }
-
-            // Multiply the standard low-pressure binary diffusion coefficient
-            // (m_bdiff) by the Takahashi correction factor P_corr_ij:
-            d[ld*j + i] = P_corr_ij*rp * m_bdiff(i,j);
+            Pcorr[m_nsp*j + i] = P_corr_ij;
         }
     }
 }
@@ -276,80 +352,153 @@ void HighPressureGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* c
 doublereal HighPressureGasTransport::viscosity()
 {
     // Calculate the high-pressure mixture viscosity, based on the Lucas method.
+    // The mixing rules for the critical properties depend only on the
+    // composition.
+    int state = m_thermo->stateMFNumber();
+    if (state != m_lucas_state) {
+        m_thermo->getMoleFractions(m_hp_molefracs.data());
+        updateLucasMixing(m_hp_molefracs.data(),
+                          m_thermo->meanMolecularWeight());
+        m_lucas_state = state;
+    }
+    doublereal tKelvin = m_thermo->temperature();
+    doublereal Pvp_mix = 0.0;
+    if (tKelvin/m_Tc_mix <= 1.0) {
+        Pvp_mix = m_thermo->satPressure(tKelvin);
+    }
+    return lucasViscosity(tKelvin, m_thermo->pressure(),
+                          m_hp_molefracs.data(), Pvp_mix);
+}
+
+void HighPressureGasTransport::getHighPressureProperties(size_t npts,
+        const double* T, const double* P, const double* X, size_t ldx,
+        double* visc, double* d, size_t ldd)
+{
+    if (ldx < m_nsp || (d && ldd < m_nsp)) {
+        throw CanteraError("HighPressureGasTransport::getHighPressureProperties",
+                           "leading dimension is too small");
+    }
+    vector_fp b(m_bdiff_inv.size()), Pcorr(m_nsp * m_nsp), x0;
+    double T0 = 0.0, P0 = 0.0;
+    for (size_t n = 0; n < npts; n++) {
+        if (T[n] <= 0.0) {
+            throw CanteraError("HighPressureGasTransport::getHighPressureProperties",
+                               "non-positive temperature {} at point {}",
+                               T[n], n);
+        }
+        const double* xn = X + n*ldx;
+        if (visc) {
+            double mmw = 0.0;
+            for (size_t k = 0; k < m_nsp; k++) {
+                mmw += xn[k] * m_mw[k];
+            }
+            updateLucasMixing(xn, mmw);
+            double Pvp_mix = 0.0;
+            if (T[n]/m_Tc_mix <= 1.0) {
+                // The saturation pressure of the mixture is needed, which
+                // requires setting the state of the phase. The original state
+                // is restored by setting (T, P, X) rather than with
+                // restoreState(), so that phases with a non-ideal equation of
+                // state remain consistent.
+                if (x0.empty()) {
+                    T0 = m_thermo->temperature();
+                    P0 = m_thermo->pressure();
+                    x0.resize(m_nsp);
+                    m_thermo->getMoleFractions(x0.data());
+                }
+                m_thermo->setState_TPX(T[n], P[n], xn);
+                Pvp_mix = m_thermo->satPressure(T[n]);
+            }
+            visc[n] = lucasViscosity(T[n], P[n], xn, Pvp_mix);
+        }
+        if (d) {
+            evalBinaryDiffFits(log(T[n]), T[n] * sqrt(T[n]), b.data());
+            evalTakahashiCorrections(T[n], P[n], xn, Pcorr.data());
+            double rp = 1.0/P[n];
+            double* dn = d + n*ldd*m_nsp;
+            size_t ic = 0;
+            for (size_t i = 0; i < m_nsp; i++) {
+                for (size_t j = i; j < m_nsp; j++) {
+                    dn[ldd*j + i] = Pcorr[m_nsp*j + i]*rp * b[ic];
+                    dn[ldd*i + j] = Pcorr[m_nsp*i + j]*rp * b[ic];
+                    ic++;
+                }
+            }
+        }
+    }
+    if (!x0.empty()) {
+        m_thermo->setState_TPX(T0, P0, x0.data());
+    }
+    // The mixing terms no longer correspond to the composition of the phase
+    m_lucas_state = -1;
+}
+
+void HighPressureGasTransport::updateLucasMixing(const doublereal* x,
+                                                 doublereal mmw)
+{
     double Tc_mix = 0.;
     double Pc_mix_n = 0.;
     double Pc_mix_d = 0.;
-    double MW_mix = m_thermo->meanMolecularWeight();
-    doublereal x_H, Tc, Zc, Tr, Afac, Z1m, Z2m;
     double MW_H = m_mw[0];
     double MW_L = m_mw[0];
-    doublereal FP_mix_o = 0;
-    doublereal FQ_mix_o = 0;
-    doublereal tKelvin = m_thermo->temperature();
-    double Pvp_mix = m_thermo->satPressure(tKelvin);
-    size_t nsp = m_thermo->nSpecies();
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
-
-    x_H = molefracs[0];
+    doublereal x_H = x[0];
     for (size_t i = 0; i < m_nsp; i++) {
-        // Calculate pure-species critical constants and add their contribution
-        // to the mole-fraction-weighted mixture averages:
-        Tc = Tcrit_i(i);
-        Tr = tKelvin/Tc;
-        Zc = Zcrit_i(i);
-        Tc_mix += Tc*molefracs[i];
-        Pc_mix_n += molefracs[i]*Zc; //numerator
-        Pc_mix_d += molefracs[i]*Vcrit_i(i); //denominator
+        // Add the contributions of the pure-species critical constants to
+        // the mole-fraction-weighted mixture averages:
+        Tc_mix += m_Tcrit[i]*x[i];
+        Pc_mix_n += x[i]*m_Zcrit[i]; //numerator
+        Pc_mix_d += x[i]*m_Vcrit[i]; //denominator
 
         // Need to calculate ratio of heaviest to lightest species:
         if (m_mw[i] > MW_H) {
             MW_H = m_mw[i];
-            x_H = molefracs[i];
+            x_H = x[i];
         } else if (m_mw[i] < MW_L) {
-            MW_L = m_mw[i];        }
-
-        // Calculate reduced dipole moment for polar correction term:
-        doublereal mu_ri = 52.46*100000*m_dipole(i,i)*m_dipole(i,i)
-            *Pcrit_i(i)/(Tc*Tc);
-        if (mu_ri < 0.022) {
-            FP_mix_o += molefracs[i];
-        } else if (mu_ri < 0.075) {
-            FP_mix_o += molefracs[i]*(1. + 30.55*pow(0.292 - Zc, 1.72));
-        } else { FP_mix_o += molefracs[i]*(1. + 30.55*pow(0.292 - Zc, 1.72)
-                                    *fabs(0.96 + 0.1*(Tr - 0.7)));
-        }
-
-        // Calculate contribution to quantum correction term.
-        // SCD Note:  This assumes the species of interest (He, H2, and D2) have
-        //   been named in this specific way.  They are perhaps the most obvious
-        //   names, butit would of course be preferred to have a more general
-        //   approach, here.
-        std::vector<std::string> spnames = m_thermo->speciesNames();
-        if (spnames[i] == "He") {
-            FQ_mix_o += molefracs[i]*FQ_i(1.38,Tr,m_mw[i]);
-        } else if (spnames[i] == "H2") {
-            FQ_mix_o += molefracs[i]*(FQ_i(0.76,Tr,m_mw[i]));
-        } else if (spnames[i] == "D2") {
-            FQ_mix_o += molefracs[i]*(FQ_i(0.52,Tr,m_mw[i]));
-        } else {
-            FQ_mix_o += molefracs[i];
+            MW_L = m_mw[i];
         }
     }
 
-    double Tr_mix = tKelvin/Tc_mix;
-    double Pc_mix = GasConstant*Tc_mix*Pc_mix_n/Pc_mix_d;
-    double Pr_mix = m_thermo->pressure()/Pc_mix;
+    m_Tc_mix = Tc_mix;
+    m_Pc_mix = GasConstant*Tc_mix*Pc_mix_n/Pc_mix_d;
     double ratio = MW_H/MW_L;
-    double ksi = pow(GasConstant*Tc_mix*3.6277*pow(10.0,53.0)/(pow(MW_mix,3)
-                        *pow(Pc_mix,4)),1.0/6.0);
+    m_ksi = pow(GasConstant*Tc_mix*3.6277*pow(10.0,53.0)/(pow(mmw,3)
+                        *pow(m_Pc_mix,4)),1.0/6.0);
 
     if (ratio > 9 && x_H > 0.05 && x_H < 0.7) {
-        Afac = 1 - 0.01*pow(ratio,0.87);
+        m_lucas_Afac = 1 - 0.01*pow(ratio,0.87);
     } else {
-        Afac = 1;
+        m_lucas_Afac = 1;
     }
-    FQ_mix_o *= Afac;
+}
+
+doublereal HighPressureGasTransport::lucasViscosity(doublereal tKelvin,
+        doublereal pres, const doublereal* x, doublereal Pvp_mix)
+{
+    doublereal Z1m, Z2m;
+    doublereal FP_mix_o = 0;
+    doublereal FQ_mix_o = 0;
+    for (size_t i = 0; i < m_nsp; i++) {
+        doublereal Tr = tKelvin/m_Tcrit[i];
+
+        // Polar correction term:
+        if (m_FP_Tdep[i]) {
+            FP_mix_o += x[i]*(1. + m_FP_polar[i]*fabs(0.96 + 0.1*(Tr - 0.7)));
+        } else {
+            FP_mix_o += x[i]*(1. + m_FP_polar[i]);
+        }
+
+        // Contribution to the quantum correction term:
+        if (m_FQ_Q[i] != 0.0) {
+            FQ_mix_o += x[i]*FQ_i(m_FQ_Q[i], Tr, m_mw[i]);
+        } else {
+            FQ_mix_o += x[i];
+        }
+    }
+
+    double Tr_mix = tKelvin/m_Tc_mix;
+    double Pc_mix = m_Pc_mix;
+    double Pr_mix = pres/Pc_mix;
+    FQ_mix_o *= m_lucas_Afac;
 
     // Calculate Z1m
     Z1m = (0.807*pow(Tr_mix,0.618) - 0.357*exp(-0.449*Tr_mix)
@@ -390,7 +539,7 @@ doublereal HighPressureGasTransport::viscosity()
 
     // Return the viscosity:
     return Z2m*(1 + (FP_mix_o - 1)*pow(Y,-3))*(1 + (FQ_mix_o - 1)
-            *(1/Y - 0.007*pow(log(Y),4)))/(ksi*FP_mix_o*FQ_mix_o);
+            *(1/Y - 0.007*pow(log(Y),4)))/(m_ksi*FP_mix_o*FQ_mix_o);
 }
 
 // Pure species critical properties - Tc, Pc, Vc, Zc:
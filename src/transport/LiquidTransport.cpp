@@ -17,6 +17,11 @@ LiquidTransport::LiquidTransport(thermo_t* thermo, int ndim) :
     m_lambdaMixModel(0),
     m_diffMixModel(0),
     m_radiusMixModel(0),
+    m_Ttable_n(0),
+    m_Ttable_Tmin(0.0),
+    m_Ttable_dT(0.0),
+    m_Ttable_stride(0),
+    m_Ttable_diff(false),
     m_iStateMF(-1),
     concTot_(0.0),
     concTot_tran_(0.0),
@@ -58,6 +63,11 @@ LiquidTransport::LiquidTransport(const LiquidTransport& right) :
     m_lambdaMixModel(0),
     m_diffMixModel(0),
     m_radiusMixModel(0),
+    m_Ttable_n(0),
+    m_Ttable_Tmin(0.0),
+    m_Ttable_dT(0.0),
+    m_Ttable_stride(0),
+    m_Ttable_diff(false),
     m_iStateMF(-1),
     concTot_(0.0),
     concTot_tran_(0.0),
@@ -123,6 +133,15 @@ LiquidTransport& LiquidTransport::operator=(const LiquidTransport& right)
     m_selfDiffSpecies = right.m_selfDiffSpecies;
     m_hydrodynamic_radius = right.m_hydrodynamic_radius;
     m_lambdaSpecies = right.m_lambdaSpecies;
+    m_viscWeight = right.m_viscWeight;
+    m_ionCondWeight = right.m_ionCondWeight;
+    m_lambdaWeight = right.m_lambdaWeight;
+    m_Ttable_n = right.m_Ttable_n;
+    m_Ttable_Tmin = right.m_Ttable_Tmin;
+    m_Ttable_dT = right.m_Ttable_dT;
+    m_Ttable_stride = right.m_Ttable_stride;
+    m_Ttable_diff = right.m_Ttable_diff;
+    m_Ttable = right.m_Ttable;
     m_viscMixModel = right.m_viscMixModel;
     m_ionCondMixModel = right.m_ionCondMixModel;
     m_mobRatMixModel = right.m_mobRatMixModel;
@@ -242,6 +261,9 @@ bool LiquidTransport::initLiquid(LiquidTransportParams& tr)
     m_lambdaTempDep_Ns.resize(m_nsp, 0);
     m_hydrodynamic_radius.resize(m_nsp, 0.0);
     m_radiusTempDep_Ns.resize(m_nsp, 0);
+    m_viscWeight.resize(m_nsp, 1.0);
+    m_ionCondWeight.resize(m_nsp, 1.0);
+    m_lambdaWeight.resize(m_nsp, 1.0);
 
     //  Make a local copy of the molecular weights
     m_mw = m_thermo->molecularWeights();
@@ -277,6 +299,16 @@ bool LiquidTransport::initLiquid(LiquidTransportParams& tr)
         ltd.thermalCond = 0;
         m_radiusTempDep_Ns[k] = ltd.hydroRadius;
         ltd.hydroRadius = 0;
+
+        if (m_viscTempDep_Ns[k]) {
+            m_viscWeight[k] = m_viscTempDep_Ns[k]->getMixWeight();
+        }
+        if (m_ionCondTempDep_Ns[k]) {
+            m_ionCondWeight[k] = m_ionCondTempDep_Ns[k]->getMixWeight();
+        }
+        if (m_lambdaTempDep_Ns[k]) {
+            m_lambdaWeight[k] = m_lambdaTempDep_Ns[k]->getMixWeight();
+        }
     }
 
     // Get the input Species Diffusivities. Note that species diffusivities are
@@ -378,8 +410,13 @@ doublereal LiquidTransport::viscosity()
     if (m_visc_mix_ok) {
         return m_viscmix;
     }
+    if (!m_visc_temp_ok) {
+        updateViscosity_T();
+    }
     ////// LiquidTranInteraction method
-    m_viscmix = m_viscMixModel->getMixTransProp(m_viscTempDep_Ns);
+    m_viscmix = m_viscMixModel->getMixTransProp(m_viscSpecies.data(),
+                                                m_viscWeight.data());
+    m_visc_mix_ok = true;
     return m_viscmix;
 }
 
@@ -399,8 +436,13 @@ doublereal LiquidTransport::ionConductivity()
     if (m_ionCond_mix_ok) {
         return m_ionCondmix;
     }
+    if (!m_ionCond_temp_ok) {
+        updateIonConductivity_T();
+    }
     ////// LiquidTranInteraction method
-    m_ionCondmix = m_ionCondMixModel->getMixTransProp(m_ionCondTempDep_Ns);
+    m_ionCondmix = m_ionCondMixModel->getMixTransProp(m_ionCondSpecies.data(),
+                                                      m_ionCondWeight.data());
+    m_ionCond_mix_ok = true;
     return m_ionCondmix;
 }
 
@@ -427,6 +469,7 @@ void LiquidTransport::mobilityRatio(doublereal* mobRat)
                 }
             }
         }
+        m_mobRat_mix_ok = true;
     }
     for (size_t k = 0; k < m_nsp2; k++) {
         mobRat[k] = m_mobRatMix[k];
@@ -454,6 +497,7 @@ void LiquidTransport::selfDiffusion(doublereal* const selfDiff)
         for (size_t k = 0; k < m_nsp; k++) {
             m_selfDiffMix[k] = m_selfDiffMixModel[k]->getMixTransProp(m_selfDiffTempDep_Ns[k]);
         }
+        m_selfDiff_mix_ok = true;
     }
     for (size_t k = 0; k < m_nsp; k++) {
         selfDiff[k] = m_selfDiffMix[k];
@@ -487,8 +531,12 @@ doublereal LiquidTransport::thermalConductivity()
     update_T();
     update_C();
     if (!m_lambda_mix_ok) {
-        m_lambda = m_lambdaMixModel->getMixTransProp(m_lambdaTempDep_Ns);
-        m_cond_mix_ok = true;
+        if (!m_lambda_temp_ok) {
+            updateCond_T();
+        }
+        m_lambda = m_lambdaMixModel->getMixTransProp(m_lambdaSpecies.data(),
+                                                     m_lambdaWeight.data());
+        m_lambda_mix_ok = true;
     }
     return m_lambda;
 }
@@ -797,6 +845,11 @@ bool LiquidTransport::update_C()
 
 void LiquidTransport::updateCond_T()
 {
+    if (interpTemperatureTable(2*m_nsp, m_nsp, m_lambdaSpecies.data())) {
+        m_lambda_temp_ok = true;
+        m_lambda_mix_ok = false;
+        return;
+    }
     for (size_t k = 0; k < m_nsp; k++) {
         m_lambdaSpecies[k] = m_lambdaTempDep_Ns[k]->getSpeciesTransProp();
     }
@@ -806,7 +859,10 @@ void LiquidTransport::updateCond_T()
 
 void LiquidTransport::updateDiff_T()
 {
-    m_diffMixModel->getMatrixTransProp(m_bdiff);
+    if (!m_Ttable_diff || !interpTemperatureTable(
+            4*m_nsp + m_nsp2*m_nsp + m_nsp2, m_nsp2, m_bdiff.ptrColumn(0))) {
+        m_diffMixModel->getMatrixTransProp(m_bdiff);
+    }
     m_diff_temp_ok = true;
     m_diff_mix_ok = false;
 }
@@ -818,6 +874,11 @@ void LiquidTransport::updateViscosities_C()
 
 void LiquidTransport::updateViscosity_T()
 {
+    if (interpTemperatureTable(0, m_nsp, m_viscSpecies.data())) {
+        m_visc_temp_ok = true;
+        m_visc_mix_ok = false;
+        return;
+    }
     for (size_t k = 0; k < m_nsp; k++) {
         m_viscSpecies[k] = m_viscTempDep_Ns[k]->getSpeciesTransProp();
     }
@@ -832,6 +893,11 @@ void LiquidTransport::updateIonConductivity_C()
 
 void LiquidTransport::updateIonConductivity_T()
 {
+    if (interpTemperatureTable(m_nsp, m_nsp, m_ionCondSpecies.data())) {
+        m_ionCond_temp_ok = true;
+        m_ionCond_mix_ok = false;
+        return;
+    }
     for (size_t k = 0; k < m_nsp; k++) {
         m_ionCondSpecies[k] = m_ionCondTempDep_Ns[k]->getSpeciesTransProp();
     }
@@ -846,6 +912,12 @@ void LiquidTransport::updateMobilityRatio_C()
 
 void LiquidTransport::updateMobilityRatio_T()
 {
+    if (interpTemperatureTable(4*m_nsp, m_nsp2*m_nsp,
+                               m_mobRatSpecies.ptrColumn(0))) {
+        m_mobRat_temp_ok = true;
+        m_mobRat_mix_ok = false;
+        return;
+    }
     for (size_t k = 0; k < m_nsp2; k++) {
         for (size_t j = 0; j < m_nsp; j++) {
             m_mobRatSpecies(k,j) = m_mobRatTempDep_Ns[k][j]->getSpeciesTransProp();
@@ -862,6 +934,12 @@ void LiquidTransport::updateSelfDiffusion_C()
 
 void LiquidTransport::updateSelfDiffusion_T()
 {
+    if (interpTemperatureTable(4*m_nsp + m_nsp2*m_nsp, m_nsp2,
+                               m_selfDiffSpecies.ptrColumn(0))) {
+        m_selfDiff_temp_ok = true;
+        m_selfDiff_mix_ok = false;
+        return;
+    }
     for (size_t k = 0; k < m_nsp2; k++) {
         for (size_t j = 0; j < m_nsp; j++) {
             m_selfDiffSpecies(k,j) = m_selfDiffTempDep_Ns[k][j]->getSpeciesTransProp();
@@ -878,6 +956,11 @@ void LiquidTransport::updateHydrodynamicRadius_C()
 
 void LiquidTransport::updateHydrodynamicRadius_T()
 {
+    if (interpTemperatureTable(3*m_nsp, m_nsp, m_hydrodynamic_radius.data())) {
+        m_radi_temp_ok = true;
+        m_radi_mix_ok = false;
+        return;
+    }
     for (size_t k = 0; k < m_nsp; k++) {
         m_hydrodynamic_radius[k] = m_radiusTempDep_Ns[k]->getSpeciesTransProp();
     }
@@ -885,6 +968,112 @@ void LiquidTransport::updateHydrodynamicRadius_T()
     m_radi_mix_ok = false;
 }
 
+void LiquidTransport::setTemperatureTable(doublereal Tmin, doublereal Tmax,
+                                          size_t nT)
+{
+    m_Ttable.clear();
+    m_Ttable_n = 0;
+    m_Ttable_diff = false;
+    m_temp = -1.0; // force reevaluation of temperature-dependent properties
+    if (nT == 0) {
+        return;
+    } else if (nT < 4 || Tmax <= Tmin) {
+        throw CanteraError("LiquidTransport::setTemperatureTable",
+            "Invalid table specification: Tmin = {}, Tmax = {}, nT = {}",
+            Tmin, Tmax, nT);
+    }
+
+    // The Stefan-Maxwell interaction parameters can only be tabulated if
+    // they don't depend on the composition
+    bool tabulateDiff = dynamic_cast<LTI_Pairwise_Interaction*>(m_diffMixModel)
+                        || dynamic_cast<LTI_StokesEinstein*>(m_diffMixModel);
+    size_t stride = 4*m_nsp + m_nsp2*m_nsp + m_nsp2;
+    if (tabulateDiff) {
+        stride += m_nsp2;
+    }
+    vector_fp table(nT*stride, 0.0);
+    DenseMatrix bdiff(m_nsp, m_nsp);
+
+    // Evaluate the species models at each temperature in the table, and then
+    // return the phase to its original temperature. Only the temperature is
+    // restored, since the density is not an independent variable for some
+    // liquid and solid phases.
+    doublereal T0 = m_thermo->temperature();
+    for (size_t i = 0; i < nT; i++) {
+        m_thermo->setTemperature(Tmin + (Tmax - Tmin) * i / (nT - 1));
+        doublereal* row = &table[i*stride];
+        for (size_t k = 0; k < m_nsp; k++) {
+            if (m_viscTempDep_Ns[k]) {
+                row[k] = m_viscTempDep_Ns[k]->getSpeciesTransProp();
+            }
+            if (m_ionCondTempDep_Ns[k]) {
+                row[m_nsp + k] = m_ionCondTempDep_Ns[k]->getSpeciesTransProp();
+            }
+            if (m_lambdaTempDep_Ns[k]) {
+                row[2*m_nsp + k] = m_lambdaTempDep_Ns[k]->getSpeciesTransProp();
+            }
+            if (m_radiusTempDep_Ns[k]) {
+                row[3*m_nsp + k] = m_radiusTempDep_Ns[k]->getSpeciesTransProp();
+            }
+        }
+        doublereal* mobRat = row + 4*m_nsp;
+        doublereal* selfDiff = mobRat + m_nsp2*m_nsp;
+        for (size_t j = 0; j < m_nsp; j++) {
+            for (size_t k = 0; k < m_nsp2; k++) {
+                if (m_mobRatTempDep_Ns[k][j]) {
+                    mobRat[k + m_nsp2*j] = m_mobRatTempDep_Ns[k][j]->getSpeciesTransProp();
+                }
+            }
+            for (size_t k = 0; k < m_nsp; k++) {
+                if (m_selfDiffTempDep_Ns[k][j]) {
+                    selfDiff[k + m_nsp*j] = m_selfDiffTempDep_Ns[k][j]->getSpeciesTransProp();
+                }
+            }
+        }
+        if (tabulateDiff) {
+            m_diffMixModel->getMatrixTransProp(bdiff);
+            copy(bdiff.begin(), bdiff.end(), selfDiff + m_nsp2);
+        }
+    }
+    m_thermo->setTemperature(T0);
+
+    m_Ttable.swap(table);
+    m_Ttable_n = nT;
+    m_Ttable_Tmin = Tmin;
+    m_Ttable_dT = (Tmax - Tmin) / (nT - 1);
+    m_Ttable_stride = stride;
+    m_Ttable_diff = tabulateDiff;
+}
+
+bool LiquidTransport::interpTemperatureTable(size_t offset, size_t n,
+                                             doublereal* out) const
+{
+    if (m_Ttable_n == 0) {
+        return false;
+    }
+    doublereal s = (m_temp - m_Ttable_Tmin) / m_Ttable_dT;
+    if (s < 0.0 || s > m_Ttable_n - 1) {
+        return false;
+    }
+
+    // Cubic Lagrange interpolation using the four nearest nodes
+    size_t i0 = std::min(static_cast<size_t>(std::max(s - 1.0, 0.0)),
+                         m_Ttable_n - 4);
+    doublereal t = s - i0;
+    doublereal w0 = -(t - 1.0) * (t - 2.0) * (t - 3.0) / 6.0;
+    doublereal w1 = 0.5 * t * (t - 2.0) * (t - 3.0);
+    doublereal w2 = -0.5 * t * (t - 1.0) * (t - 3.0);
+    doublereal w3 = t * (t - 1.0) * (t - 2.0) / 6.0;
+    const doublereal* r0 = &m_Ttable[i0*m_Ttable_stride + offset];
+    const doublereal* r1 = r0 + m_Ttable_stride;
+    const doublereal* r2 = r1 + m_Ttable_stride;
+    const doublereal* r3 = r2 + m_Ttable_stride;
+    for (size_t j = 0; j < n; j++) {
+        out[j] = w0*r0[j] + w1*r1[j] + w2*r2[j] + w3*r3[j];
+    }
+    return true;
+}
+
 void LiquidTransport::update_Grad_lnAC()
 {
     doublereal grad_T;
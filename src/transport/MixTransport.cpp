@@ -120,6 +120,147 @@ void MixTransport::getSpeciesFluxes(size_t ndim, const doublereal* const grad_T,
     }
 }
 
+//! Evaluate a polynomial in ln(T) at each of a set of points
+/*!
+ * @param c       Polynomial coefficients, lowest order first
+ * @param ncoeffs Number of coefficients to use
+ * @param logt    Logarithm of the temperature at each point
+ * @param npts    Number of points
+ * @param out     Value of the polynomial at each point
+ */
+static void evalLogTPoly(const vector_fp& c, size_t ncoeffs,
+                         const double* logt, size_t npts, double* out)
+{
+    std::fill(out, out + npts, c[ncoeffs-1]);
+    for (size_t n = ncoeffs - 1; n > 0; n--) {
+        for (size_t j = 0; j < npts; j++) {
+            out[j] = out[j] * logt[j] + c[n-1];
+        }
+    }
+}
+
+void MixTransport::getMixTransportProperties(size_t npts, const double* T,
+        const double* P, const double* X, size_t ldx, double* visc,
+        double* cond, double* d, size_t ldd)
+{
+    if (ldx < m_nsp || (d && ldd < m_nsp)) {
+        throw CanteraError("MixTransport::getMixTransportProperties",
+                           "leading dimension is too small");
+    }
+    vector_fp logt(npts), sqrt_t(npts), t14(npts), t32(npts);
+    for (size_t j = 0; j < npts; j++) {
+        if (T[j] <= 0.0) {
+            throw CanteraError("MixTransport::getMixTransportProperties",
+                               "non-positive temperature {} at point {}",
+                               T[j], j);
+        }
+        logt[j] = log(T[j]);
+        sqrt_t[j] = sqrt(T[j]);
+        t14[j] = sqrt(sqrt_t[j]);
+        t32[j] = T[j] * sqrt_t[j];
+    }
+
+    // Evaluate the fits for the pure species properties at all of the points
+    // together. The value for species k at point j is stored at k*npts + j.
+    size_t ncoeffs = (m_mode == CK_Mode) ? 4 : 5;
+    vector_fp spvisc, spa, spcond;
+    if (visc) {
+        spvisc.resize(m_nsp * npts);
+        spa.resize(m_nsp * npts);
+        for (size_t k = 0; k < m_nsp; k++) {
+            double* v = &spvisc[k*npts];
+            double* a = &spa[k*npts];
+            evalLogTPoly(m_visccoeffs[k], ncoeffs, logt.data(), npts, v);
+            if (m_mode == CK_Mode) {
+                for (size_t j = 0; j < npts; j++) {
+                    v[j] = exp(v[j]);
+                    a[j] = sqrt(v[j]) * m_mw_m14[k];
+                }
+            } else {
+                // the polynomial fit is done for sqrt(visc/sqrt(T))
+                for (size_t j = 0; j < npts; j++) {
+                    double sv = t14[j] * v[j];
+                    v[j] = sv * sv;
+                    a[j] = sv * m_mw_m14[k];
+                }
+            }
+        }
+    }
+    if (cond) {
+        spcond.resize(m_nsp * npts);
+        for (size_t k = 0; k < m_nsp; k++) {
+            double* c = &spcond[k*npts];
+            evalLogTPoly(m_condcoeffs[k], ncoeffs, logt.data(), npts, c);
+            if (m_mode == CK_Mode) {
+                for (size_t j = 0; j < npts; j++) {
+                    c[j] = exp(c[j]);
+                }
+            } else {
+                for (size_t j = 0; j < npts; j++) {
+                    c[j] *= sqrt_t[j];
+                }
+            }
+        }
+    }
+
+    // Apply the mixture rules at each point
+    vector_fp x(m_nsp), sums(m_nsp), binv(m_bdiff_inv.size());
+    vector_fp vj(m_nsp), aj(m_nsp);
+    for (size_t j = 0; j < npts; j++) {
+        const double* xj = X + j*ldx;
+        double mmw = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            mmw += xj[k] * m_mw[k];
+            // add an offset to avoid a pure species condition
+            x[k] = std::max(Tiny, xj[k]);
+        }
+
+        if (visc) {
+            for (size_t k = 0; k < m_nsp; k++) {
+                vj[k] = spvisc[k*npts + j];
+                aj[k] = spa[k*npts + j];
+            }
+            visc[j] = wilkeViscosity(vj.data(), aj.data(), x.data(),
+                                     sums.data());
+        }
+
+        if (cond) {
+            double sum1 = 0.0, sum2 = 0.0;
+            for (size_t k = 0; k < m_nsp; k++) {
+                sum1 += x[k] * spcond[k*npts + j];
+                sum2 += x[k] / spcond[k*npts + j];
+            }
+            cond[j] = 0.5*(sum1 + 1.0/sum2);
+        }
+
+        if (d) {
+            double* dj = d + j*ldd;
+            evalBinaryDiffFits(logt[j], t32[j], binv.data());
+            if (m_nsp == 1) {
+                dj[0] = binv[0] / P[j];
+                continue;
+            }
+            for (size_t ic = 0; ic < binv.size(); ic++) {
+                binv[ic] = 1.0 / binv[ic];
+            }
+            double sumxw = 0.0;
+            for (size_t k = 0; k < m_nsp; k++) {
+                sumxw += x[k] * m_mw[k];
+            }
+            sumInvBinaryDiff(binv.data(), x.data(), sums.data());
+            for (size_t k = 0; k < m_nsp; k++) {
+                if (sums[k] <= 0.0) {
+                    // self-diffusion coefficient, stored at the start of row k
+                    size_t kk = k*m_nsp - (k*(k-1))/2;
+                    dj[k] = 1.0 / (binv[kk] * P[j]);
+                } else {
+                    dj[k] = (sumxw - x[k] * m_mw[k]) / (P[j] * mmw * sums[k]);
+                }
+            }
+        }
+    }
+}
+
 void MixTransport::update_T()
 {
     doublereal t = m_thermo->temperature();
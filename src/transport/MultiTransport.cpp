@@ -35,7 +35,13 @@ doublereal Frot(doublereal tr, doublereal sqtr)
 //////////////////// class MultiTransport methods //////////////
 
 MultiTransport::MultiTransport(thermo_t* thermo)
-    : GasTransport(thermo)
+    : GasTransport(thermo),
+      m_Lprec_ok(false),
+      m_Lsoln_rtol(1.0e-14),
+      m_Lsoln_maxiter(100),
+      m_sm_iterative(false),
+      m_sm_rtol(1.0e-8),
+      m_sm_maxiter(100)
 {
 }
 
@@ -56,17 +62,30 @@ void MultiTransport::init(ThermoPhase* thermo, int mode, int log_level)
     m_astar.resize(m_nsp, m_nsp);
     m_bstar.resize(m_nsp, m_nsp);
     m_cstar.resize(m_nsp, m_nsp);
+    m_L0010_T.resize(m_nsp, m_nsp);
+    m_L1010_T.resize(m_nsp, m_nsp);
+    m_L1010_Tsum.resize(m_nsp, m_nsp);
+    m_L1001_T.resize(m_nsp, m_nsp);
+    m_L0101_T.resize(m_nsp, m_nsp);
+    m_L0101_Tdiag.resize(m_nsp);
+    m_Lred.resize(2*m_nsp, 2*m_nsp);
+    m_Lprec0.resize(m_nsp, m_nsp);
+    m_Lprec1.resize(m_nsp, m_nsp);
+    m_Lprec0.m_useReturnErrorCode = 1;
+    m_Lprec1.m_useReturnErrorCode = 1;
 
     // set flags all false
     m_abc_ok = false;
     m_l0000_ok = false;
     m_lmatrix_soln_ok = false;
+    m_Lprec_ok = false;
     m_thermal_tlast = 0.0;
 
     // some work space
     m_spwork1.resize(m_nsp);
     m_spwork2.resize(m_nsp);
     m_spwork3.resize(m_nsp);
+    m_sm_work.resize(5*m_nsp);
 
     // precompute and store log(epsilon_ij/k_B)
     m_log_eps_k.resize(m_nsp, m_nsp);
@@ -140,30 +159,222 @@ void MultiTransport::solveLMatrixEquation()
         }
     }
 
-    // evaluate the submatrices of the L matrix
+    // evaluate the submatrices of the L matrix. The L00,01 and L01,00 blocks
+    // are zero, and the L01,01 block is diagonal.
     m_Lmatrix.resize(3*m_nsp, 3*m_nsp, 0.0);
-
-    //! Evaluate the upper-left block of the L matrix.
     eval_L0000(m_molefracs.data());
     eval_L0010(m_molefracs.data());
-    eval_L0001();
     eval_L1000();
     eval_L1010(m_molefracs.data());
     eval_L1001(m_molefracs.data());
-    eval_L0100();
-    eval_L0110();
     eval_L0101(m_molefracs.data());
 
-    // Solve it using GMRES or LU decomposition. The last solution in m_a should
-    // provide a good starting guess, so convergence should be fast.
-    m_a = m_b;
-    solve(m_Lmatrix, m_a.data());
+    // Eliminate the unknowns for the internal energy modes. Since L01,01 is
+    // diagonal and L01,10 is the transpose of L10,01, the third block of
+    // equations gives
+    //     a2[i] = (b2[i] - sum_j L10,01(j,i) a1[j]) / L01,01(i,i)
+    // which leaves a system of size 2*m_nsp for a0 and a1. Species without
+    // internal modes have a2[i] = 0, and don't contribute.
+    size_t n1 = m_nsp;
+    size_t n2 = 2*m_nsp;
+    for (size_t j = 0; j < n2; j++) {
+        const double* col = m_Lmatrix.ptrColumn(j);
+        std::copy(col, col + n2, m_Lred.ptrColumn(j));
+    }
+    vector_fp bred(m_b.begin(), m_b.begin() + n2);
+    for (size_t i = 0; i < m_nsp; i++) {
+        if (!hasInternalModes(i)) {
+            continue;
+        }
+        const double* c = m_Lmatrix.ptrColumn(i + n2) + n1;
+        double dinv = 1.0 / m_Lmatrix(i + n2, i + n2);
+        for (size_t l = 0; l < m_nsp; l++) {
+            double f = c[l] * dinv;
+            double* col = m_Lred.ptrColumn(l + n1) + n1;
+            for (size_t j = 0; j < m_nsp; j++) {
+                col[j] -= c[j] * f;
+            }
+        }
+        double f = m_b[i + n2] * dinv;
+        for (size_t j = 0; j < m_nsp; j++) {
+            bred[j + n1] -= c[j] * f;
+        }
+    }
+
+    // Solve the reduced system iteratively. The last solution in m_a should
+    // provide a good starting guess, so convergence should be fast, and the
+    // preconditioner can be reused until the convergence rate degrades. If
+    // the iterations fail even with a new preconditioner, fall back to a
+    // direct solution.
+    int its = -1;
+    if (m_Lprec_ok) {
+        its = solveLMatrixGMRES(m_a.data(), bred.data());
+    }
+    if (its < 0) {
+        for (size_t j = 0; j < m_nsp; j++) {
+            const double* col0 = m_Lred.ptrColumn(j);
+            std::copy(col0, col0 + m_nsp, m_Lprec0.ptrColumn(j));
+            const double* col1 = m_Lred.ptrColumn(j + n1) + n1;
+            std::copy(col1, col1 + m_nsp, m_Lprec1.ptrColumn(j));
+        }
+        m_Lprec_ok = (m_Lprec0.factor() == 0 && m_Lprec1.factor() == 0);
+        if (m_Lprec_ok) {
+            for (size_t k = 0; k < n2; k++) {
+                if (!std::isfinite(m_a[k])) {
+                    std::fill(m_a.begin(), m_a.end(), 0.0);
+                    break;
+                }
+            }
+            its = solveLMatrixGMRES(m_a.data(), bred.data());
+        }
+    }
+    if (its < 0) {
+        std::copy(bred.begin(), bred.end(), m_a.begin());
+        solve(m_Lred, m_a.data());
+    } else if (its > 20) {
+        // Get a new preconditioner for the next solution
+        m_Lprec_ok = false;
+    }
+
+    // Recover the solution for the internal energy modes
+    for (size_t i = 0; i < m_nsp; i++) {
+        if (hasInternalModes(i)) {
+            const double* c = m_Lmatrix.ptrColumn(i + n2) + n1;
+            double sum = m_b[i + n2];
+            for (size_t j = 0; j < m_nsp; j++) {
+                sum -= c[j] * m_a[j + n1];
+            }
+            m_a[i + n2] = sum / m_Lmatrix(i + n2, i + n2);
+        } else {
+            m_a[i + n2] = 0.0;
+        }
+    }
     m_lmatrix_soln_ok = true;
     m_molefracs_last = m_molefracs;
-    // L matrix is overwritten with LU decomposition
     m_l0000_ok = false;
 }
 
+void MultiTransport::applyLPreconditioner(doublereal* v)
+{
+    m_Lprec0.solve(v);
+    m_Lprec1.solve(v + m_nsp);
+}
+
+int MultiTransport::solveLMatrixGMRES(doublereal* a, const doublereal* b)
+{
+    // Restarted GMRES with right preconditioning, so that the residual which
+    // is monitored is the residual of the unpreconditioned system.
+    size_t n = 2*m_nsp;
+    size_t m = std::min<size_t>(n, 30);
+    vector_fp V((m+1)*n), H((m+1)*m), cs(m), sn(m), g(m+1), r(n), z(n);
+    double bnorm = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        bnorm += b[i] * b[i];
+    }
+    bnorm = sqrt(bnorm);
+    double tol = m_Lsoln_rtol * bnorm;
+
+    size_t its = 0;
+    double beta_last = 0.0;
+    while (true) {
+        // residual of the current solution
+        m_Lred.mult(a, r.data());
+        double beta = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            r[i] = b[i] - r[i];
+            beta += r[i] * r[i];
+        }
+        beta = sqrt(beta);
+        if (beta <= tol) {
+            return static_cast<int>(its);
+        } else if (its >= m_Lsoln_maxiter || !std::isfinite(beta) ||
+                   (its && beta > 0.5 * beta_last)) {
+            // Out of iterations, or stagnating
+            return -1;
+        }
+        beta_last = beta;
+
+        for (size_t i = 0; i < n; i++) {
+            V[i] = r[i] / beta;
+        }
+        std::fill(g.begin(), g.end(), 0.0);
+        g[0] = beta;
+        size_t k = 0;
+        while (k < m && its < m_Lsoln_maxiter) {
+            its++;
+            // w = L * M^-1 * v_k, orthogonalized against v_0 ... v_k
+            std::copy(&V[k*n], &V[k*n] + n, z.begin());
+            applyLPreconditioner(z.data());
+            double* w = &V[(k+1)*n];
+            m_Lred.mult(z.data(), w);
+            double* h = &H[k*(m+1)];
+            for (size_t i = 0; i <= k; i++) {
+                double dot = 0.0;
+                for (size_t j = 0; j < n; j++) {
+                    dot += w[j] * V[i*n + j];
+                }
+                h[i] = dot;
+                for (size_t j = 0; j < n; j++) {
+                    w[j] -= dot * V[i*n + j];
+                }
+            }
+            double wnorm = 0.0;
+            for (size_t j = 0; j < n; j++) {
+                wnorm += w[j] * w[j];
+            }
+            wnorm = sqrt(wnorm);
+            h[k+1] = wnorm;
+            if (wnorm != 0.0) {
+                for (size_t j = 0; j < n; j++) {
+                    w[j] /= wnorm;
+                }
+            }
+
+            // Apply the previous Givens rotations to the new column of H, and
+            // find the rotation that eliminates h[k+1]
+            for (size_t i = 0; i < k; i++) {
+                double tmp = cs[i] * h[i] + sn[i] * h[i+1];
+                h[i+1] = -sn[i] * h[i] + cs[i] * h[i+1];
+                h[i] = tmp;
+            }
+            double rho = hypot(h[k], h[k+1]);
+            if (rho == 0.0) {
+                return -1;
+            }
+            cs[k] = h[k] / rho;
+            sn[k] = h[k+1] / rho;
+            h[k] = rho;
+            h[k+1] = 0.0;
+            g[k+1] = -sn[k] * g[k];
+            g[k] *= cs[k];
+            k++;
+            if (fabs(g[k]) <= tol || wnorm == 0.0) {
+                break;
+            }
+        }
+
+        // Solve the triangular system H*y = g, and update the solution with
+        // a += M^-1 * V * y
+        for (size_t i = k; i-- > 0;) {
+            double sum = g[i];
+            for (size_t j = i + 1; j < k; j++) {
+                sum -= H[j*(m+1) + i] * g[j];
+            }
+            g[i] = sum / H[i*(m+1) + i];
+        }
+        std::fill(z.begin(), z.end(), 0.0);
+        for (size_t i = 0; i < k; i++) {
+            for (size_t j = 0; j < n; j++) {
+                z[j] += g[i] * V[i*n + j];
+            }
+        }
+        applyLPreconditioner(z.data());
+        for (size_t j = 0; j < n; j++) {
+            a[j] += z[j];
+        }
+    }
+}
+
 void MultiTransport::getSpeciesFluxes(size_t ndim, const doublereal* const grad_T,
                                       size_t ldx, const doublereal* const grad_X,
                                       size_t ldf, doublereal* const fluxes)
@@ -196,46 +407,56 @@ void MultiTransport::getSpeciesFluxes(size_t ndim, const doublereal* const grad_
         m_aa(i,i) -= sum;
     }
 
-    // enforce the condition \sum Y_k V_k = 0. This is done by replacing
-    // the flux equation with the largest gradx component in the first
-    // coordinate direction with the flux balance condition.
-    size_t jmax = 0;
-    doublereal gradmax = -1.0;
-    for (size_t j = 0; j < m_nsp; j++) {
-        if (fabs(grad_X[j]) > gradmax) {
-            gradmax = fabs(grad_X[j]);
-            jmax = j;
+    bool solved = false;
+    if (m_sm_iterative) {
+        solved = true;
+        for (size_t n = 0; n < ndim && solved; n++) {
+            solved = solveStefanMaxwellCG(y, grad_X + ldx*n, fluxes + ldf*n);
         }
     }
 
-    // set the matrix elements in this row to the mass fractions,
-    // and set the entry in gradx to zero
-    for (size_t j = 0; j < m_nsp; j++) {
-        m_aa(jmax,j) = y[j];
-    }
-    vector_fp gsave(ndim), grx(ldx*m_nsp);
-    for (size_t n = 0; n < ldx*ndim; n++) {
-        grx[n] = grad_X[n];
-    }
+    if (!solved) {
+        // enforce the condition \sum Y_k V_k = 0. This is done by replacing
+        // the flux equation with the largest gradx component in the first
+        // coordinate direction with the flux balance condition.
+        size_t jmax = 0;
+        doublereal gradmax = -1.0;
+        for (size_t j = 0; j < m_nsp; j++) {
+            if (fabs(grad_X[j]) > gradmax) {
+                gradmax = fabs(grad_X[j]);
+                jmax = j;
+            }
+        }
 
-    // copy grad_X to fluxes
-    const doublereal* gx;
-    for (size_t n = 0; n < ndim; n++) {
-        gx = grad_X + ldx*n;
-        copy(gx, gx + m_nsp, fluxes + ldf*n);
-        fluxes[jmax + n*ldf] = 0.0;
-    }
+        // set the matrix elements in this row to the mass fractions,
+        // and set the entry in gradx to zero
+        for (size_t j = 0; j < m_nsp; j++) {
+            m_aa(jmax,j) = y[j];
+        }
+        vector_fp gsave(ndim), grx(ldx*m_nsp);
+        for (size_t n = 0; n < ldx*ndim; n++) {
+            grx[n] = grad_X[n];
+        }
 
-    // use LAPACK to solve the equations
-    int info = m_aa.factor();
-    if (info) {
-        throw CanteraError("MultiTransport::getSpeciesFluxes",
-                           "Error factorizing matrix.");
-    }
-    info = m_aa.solve(fluxes, ndim, ldf);
-    if (info) {
-        throw CanteraError("MultiTransport::getSpeciesFluxes",
-                           "Error solving linear system.");
+        // copy grad_X to fluxes
+        const doublereal* gx;
+        for (size_t n = 0; n < ndim; n++) {
+            gx = grad_X + ldx*n;
+            copy(gx, gx + m_nsp, fluxes + ldf*n);
+            fluxes[jmax + n*ldf] = 0.0;
+        }
+
+        // use LAPACK to solve the equations
+        int info = m_aa.factor();
+        if (info) {
+            throw CanteraError("MultiTransport::getSpeciesFluxes",
+                               "Error factorizing matrix.");
+        }
+        info = m_aa.solve(fluxes, ndim, ldf);
+        if (info) {
+            throw CanteraError("MultiTransport::getSpeciesFluxes",
+                               "Error solving linear system.");
+        }
     }
 
     size_t offset;
@@ -311,36 +532,46 @@ void MultiTransport::getMassFluxes(const doublereal* state1, const doublereal* s
         m_aa(i,i) -= sum;
     }
 
-    // enforce the condition \sum Y_k V_k = 0. This is done by replacing the
-    // flux equation with the largest gradx component with the flux balance
-    // condition.
-    size_t jmax = 0;
-    doublereal gradmax = -1.0;
-    for (size_t j = 0; j < m_nsp; j++) {
-        if (fabs(x2[j] - x1[j]) > gradmax) {
-            gradmax = fabs(x1[j] - x2[j]);
-            jmax = j;
+    bool solved = false;
+    if (m_sm_iterative) {
+        for (size_t k = 0; k < m_nsp; k++) {
+            x3[k] = x2[k] - x1[k];
         }
+        solved = solveStefanMaxwellCG(y, x3, fluxes);
     }
 
-    // set the matrix elements in this row to the mass fractions,
-    // and set the entry in gradx to zero
-    for (size_t j = 0; j < m_nsp; j++) {
-        m_aa(jmax,j) = y[j];
-        fluxes[j] = x2[j] - x1[j];
-    }
-    fluxes[jmax] = 0.0;
+    if (!solved) {
+        // enforce the condition \sum Y_k V_k = 0. This is done by replacing the
+        // flux equation with the largest gradx component with the flux balance
+        // condition.
+        size_t jmax = 0;
+        doublereal gradmax = -1.0;
+        for (size_t j = 0; j < m_nsp; j++) {
+            if (fabs(x2[j] - x1[j]) > gradmax) {
+                gradmax = fabs(x1[j] - x2[j]);
+                jmax = j;
+            }
+        }
 
-    // Solve the equations
-    int info = m_aa.factor();
-    if (info) {
-        throw CanteraError("MultiTransport::getMassFluxes",
-                           "Error in factorization.  Info = {}", info);
-    }
-    info = m_aa.solve(fluxes);
-    if (info) {
-        throw CanteraError("MultiTransport::getMassFluxes",
-                           "Error in linear solve. Info = {}", info);
+        // set the matrix elements in this row to the mass fractions,
+        // and set the entry in gradx to zero
+        for (size_t j = 0; j < m_nsp; j++) {
+            m_aa(jmax,j) = y[j];
+            fluxes[j] = x2[j] - x1[j];
+        }
+        fluxes[jmax] = 0.0;
+
+        // Solve the equations
+        int info = m_aa.factor();
+        if (info) {
+            throw CanteraError("MultiTransport::getMassFluxes",
+                               "Error in factorization.  Info = {}", info);
+        }
+        info = m_aa.solve(fluxes);
+        if (info) {
+            throw CanteraError("MultiTransport::getMassFluxes",
+                               "Error in linear solve. Info = {}", info);
+        }
     }
 
     doublereal pp = pressure_ig();
@@ -359,6 +590,100 @@ void MultiTransport::getMassFluxes(const doublereal* state1, const doublereal* s
     }
 }
 
+void MultiTransport::setIterativeFluxSolver(bool iterative, doublereal rtol,
+                                            size_t maxiter)
+{
+    m_sm_iterative = iterative;
+    m_sm_rtol = rtol;
+    m_sm_maxiter = maxiter;
+}
+
+bool MultiTransport::solveStefanMaxwellCG(const doublereal* y,
+                                          const doublereal* d, doublereal* v)
+{
+    doublereal* r = &m_sm_work[0];
+    doublereal* z = r + m_nsp;
+    doublereal* p = z + m_nsp;
+    doublereal* q = p + m_nsp;
+    doublereal* dinv = q + m_nsp;
+
+    // Weight of the rank-one term enforcing mass conservation. Any positive
+    // value gives the same solution; this one keeps the added term on the
+    // same scale as the Stefan-Maxwell matrix.
+    doublereal alpha = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        alpha = std::max(alpha, -m_aa(k,k));
+    }
+
+    // Jacobi preconditioner, and initial residual for v = 0
+    doublereal rz = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        dinv[k] = 1.0 / (alpha*y[k]*y[k] - m_aa(k,k));
+        v[k] = 0.0;
+        r[k] = -d[k];
+        z[k] = dinv[k] * r[k];
+        p[k] = z[k];
+        rz += r[k] * z[k];
+    }
+    if (rz == 0.0) {
+        return true;
+    }
+    doublereal tol = m_sm_rtol * m_sm_rtol * rz;
+
+    for (size_t iter = 0; iter < m_sm_maxiter; iter++) {
+        // q = (S + alpha y y^T) p, with S = -m_aa
+        doublereal yp = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            q[k] = 0.0;
+            yp += y[k] * p[k];
+        }
+        for (size_t j = 0; j < m_nsp; j++) {
+            const doublereal* col = m_aa.ptrColumn(j);
+            doublereal pj = p[j];
+            for (size_t i = 0; i < m_nsp; i++) {
+                q[i] -= col[i] * pj;
+            }
+        }
+        doublereal pq = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            q[k] += alpha * yp * y[k];
+            pq += p[k] * q[k];
+        }
+        if (!(pq > 0.0)) {
+            return false;
+        }
+
+        doublereal a = rz / pq;
+        doublereal rz_new = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            v[k] += a * p[k];
+            r[k] -= a * q[k];
+            z[k] = dinv[k] * r[k];
+            rz_new += r[k] * z[k];
+        }
+        if (rz_new <= tol) {
+            // Remove the remaining mass flux, which is within the tolerance,
+            // by shifting all of the velocities equally. This leaves the
+            // Stefan-Maxwell residual unchanged.
+            doublereal yv = 0.0, ysum = 0.0;
+            for (size_t k = 0; k < m_nsp; k++) {
+                yv += y[k] * v[k];
+                ysum += y[k];
+            }
+            for (size_t k = 0; k < m_nsp; k++) {
+                v[k] -= yv / ysum;
+            }
+            return true;
+        }
+        doublereal beta = rz_new / rz;
+        rz = rz_new;
+        for (size_t k = 0; k < m_nsp; k++) {
+            p[k] = z[k] + beta * p[k];
+        }
+    }
+    return false;
+}
+
 void MultiTransport::getMolarFluxes(const doublereal* const state1,
                                     const doublereal* const state2,
                                     const doublereal delta,
@@ -502,6 +827,7 @@ void MultiTransport::updateThermal_T()
     for (size_t k = 0; k < m_nsp; k++) {
         m_cinternal[k] = cp[k] - 2.5;
     }
+    updateLMatrixFactors_T();
     m_thermal_tlast = m_thermo->temperature();
 }
 
@@ -537,22 +863,16 @@ void MultiTransport::eval_L0000(const doublereal* const x)
 
 void MultiTransport::eval_L0010(const doublereal* const x)
 {
-    doublereal prefactor = 1.6*m_temp;
-    doublereal sum, wj, xj;
     for (size_t j = 0; j < m_nsp; j++) {
-        xj = x[j];
-        wj = m_mw[j];
-        sum = 0.0;
+        doublereal sum = 0.0;
         for (size_t i = 0; i < m_nsp; i++) {
-            m_Lmatrix(i,j + m_nsp) = - prefactor * x[i] * xj * m_mw[i] *
-                                     (1.2 * m_cstar(j,i) - 1.0) /
-                                     ((wj + m_mw[i]) * m_bdiff(j,i));
-
-            // the next term is independent of "j";
-            // need to do it for the "j,j" term
-            sum -= m_Lmatrix(i,j+m_nsp);
+            m_Lmatrix(i,j + m_nsp) = x[i] * x[j] * m_L0010_T(i,j);
+            // the diagonal term collects the terms for the other species
+            if (i != j) {
+                sum -= m_Lmatrix(i,j + m_nsp);
+            }
         }
-        m_Lmatrix(j,j+m_nsp) += sum;
+        m_Lmatrix(j,j + m_nsp) = sum;
     }
 }
 
@@ -567,60 +887,27 @@ void MultiTransport::eval_L1000()
 
 void MultiTransport::eval_L1010(const doublereal* x)
 {
-    const doublereal fiveover3pi = 5.0/(3.0*Pi);
-    doublereal prefactor = (16.0*m_temp)/25.0;
-    doublereal constant1, wjsq, constant2, constant3, constant4,
-               fourmj, threemjsq, sum, sumwij;;
-    doublereal term1, term2;
-
     for (size_t j = 0; j < m_nsp; j++) {
-        // get constant terms that depend on just species "j"
-        constant1 = prefactor*x[j];
-        wjsq = m_mw[j]*m_mw[j];
-        constant2 = 13.75*wjsq;
-        constant3 = m_crot[j]/m_rotrelax[j];
-        constant4 = 7.5*wjsq;
-        fourmj = 4.0*m_mw[j];
-        threemjsq = 3.0*m_mw[j]*m_mw[j];
-        sum = 0.0;
+        doublereal sum = 0.0;
         for (size_t i = 0; i < m_nsp; i++) {
-            sumwij = m_mw[i] + m_mw[j];
-            term1 = m_bdiff(i,j) * sumwij*sumwij;
-            term2 = fourmj*m_astar(i,j)*(1.0 + fiveover3pi*
-                                         (constant3 +
-                                          (m_crot[i]/m_rotrelax[i]))); //  see Eq. (12.125)
-
-            m_Lmatrix(i+m_nsp,j+m_nsp) = constant1*x[i]*m_mw[i] /(m_mw[j]*term1) *
-                                         (constant2 - threemjsq*m_bstar(i,j)
-                                          - term2*m_mw[j]);
-
-            sum += x[i] /(term1) *
-                   (constant4 + m_mw[i]*m_mw[i]*
-                    (6.25 - 3.0*m_bstar(i,j)) + term2*m_mw[i]);
+            m_Lmatrix(i+m_nsp,j+m_nsp) = x[j] * x[i] * m_L1010_T(i,j);
+            sum += x[i] * m_L1010_Tsum(i,j);
         }
-
-        m_Lmatrix(j+m_nsp,j+m_nsp) -= sum*constant1;
+        m_Lmatrix(j+m_nsp,j+m_nsp) -= x[j] * sum;
     }
 }
 
 void MultiTransport::eval_L1001(const doublereal* x)
 {
-    doublereal prefactor = 32.00*m_temp/(5.00*Pi);
-    doublereal constant, sum;
     size_t n2 = 2*m_nsp;
-    int npoly = 0;
     for (size_t j = 0; j < m_nsp; j++) {
-        // collect terms that depend only on "j"
         if (hasInternalModes(j)) {
-            constant = prefactor*m_mw[j]*x[j]*m_crot[j]/(m_cinternal[j]*m_rotrelax[j]);
-            sum = 0.0;
+            doublereal sum = 0.0;
             for (size_t i = 0; i < m_nsp; i++) {
                 // see Eq. (12.127)
-                m_Lmatrix(i+m_nsp,j+n2) = constant * m_astar(j,i) * x[i] /
-                                          ((m_mw[j] + m_mw[i]) * m_bdiff(j,i));
+                m_Lmatrix(i+m_nsp,j+n2) = x[j] * x[i] * m_L1001_T(i,j);
                 sum += m_Lmatrix(i+m_nsp,j+n2);
             }
-            npoly++;
             m_Lmatrix(j+m_nsp,j+n2) += sum;
         } else {
             for (size_t i = 0; i < m_nsp; i++) {
@@ -630,68 +917,105 @@ void MultiTransport::eval_L1001(const doublereal* x)
     }
 }
 
-void MultiTransport::eval_L0001()
+void MultiTransport::eval_L0101(const doublereal* x)
 {
+    // Only the diagonal of this block is nonzero, and only the diagonal is
+    // used by solveLMatrixEquation().
     size_t n2 = 2*m_nsp;
-    for (size_t j = 0; j < m_nsp; j++) {
-        for (size_t i = 0; i < m_nsp; i++) {
-            m_Lmatrix(i,j+n2) = 0.0;
+    for (size_t i = 0; i < m_nsp; i++) {
+        if (hasInternalModes(i)) {
+            // see Eqs. (12.130) and (12.131)
+            const double* f = m_L0101_T.ptrColumn(i);
+            doublereal sum = 0.0;
+            for (size_t k = 0; k < m_nsp; k++) {
+                sum += x[k] * f[k];
+            }
+            m_Lmatrix(i+n2,i+n2) = - x[i] * (x[i] * m_L0101_Tdiag[i] + sum);
+        } else {
+            m_Lmatrix(i+n2,i+n2) = 1.0;
         }
     }
 }
 
-void MultiTransport::eval_L0100()
+void MultiTransport::updateLMatrixFactors_T()
 {
-    size_t n2 = 2*m_nsp;
+    // L00,10 block; see Eq. (12.122)
+    doublereal prefactor = 1.6*m_temp;
     for (size_t j = 0; j < m_nsp; j++) {
         for (size_t i = 0; i < m_nsp; i++) {
-            m_Lmatrix(i+n2,j) = 0.0; // see Eq. (12.123)
+            m_L0010_T(i,j) = - prefactor * m_mw[i] *
+                             (1.2 * m_cstar(j,i) - 1.0) /
+                             ((m_mw[j] + m_mw[i]) * m_bdiff(j,i));
         }
     }
-}
 
-void MultiTransport::eval_L0110()
-{
-    size_t n2 = 2*m_nsp;
+    // L10,10 block; see Eqs. (12.124) and (12.125)
+    const doublereal fiveover3pi = 5.0/(3.0*Pi);
+    prefactor = (16.0*m_temp)/25.0;
     for (size_t j = 0; j < m_nsp; j++) {
+        // get constant terms that depend on just species "j"
+        doublereal wjsq = m_mw[j]*m_mw[j];
+        doublereal constant2 = 13.75*wjsq;
+        doublereal constant3 = m_crot[j]/m_rotrelax[j];
+        doublereal constant4 = 7.5*wjsq;
+        doublereal fourmj = 4.0*m_mw[j];
+        doublereal threemjsq = 3.0*wjsq;
         for (size_t i = 0; i < m_nsp; i++) {
-            m_Lmatrix(i+n2,j+m_nsp) = m_Lmatrix(j+m_nsp,i+n2); // see Eq. (12.123)
+            doublereal sumwij = m_mw[i] + m_mw[j];
+            doublereal term1 = m_bdiff(i,j) * sumwij*sumwij;
+            doublereal term2 = fourmj*m_astar(i,j)*(1.0 + fiveover3pi*
+                               (constant3 + (m_crot[i]/m_rotrelax[i])));
+            m_L1010_T(i,j) = prefactor * m_mw[i] / (m_mw[j]*term1) *
+                             (constant2 - threemjsq*m_bstar(i,j)
+                              - term2*m_mw[j]);
+            m_L1010_Tsum(i,j) = prefactor / term1 *
+                                (constant4 + m_mw[i]*m_mw[i]*
+                                 (6.25 - 3.0*m_bstar(i,j)) + term2*m_mw[i]);
         }
     }
-}
 
-void MultiTransport::eval_L0101(const doublereal* x)
-{
+    // L10,01 block; see Eq. (12.127)
+    prefactor = 32.00*m_temp/(5.00*Pi);
+    for (size_t j = 0; j < m_nsp; j++) {
+        if (!hasInternalModes(j)) {
+            for (size_t i = 0; i < m_nsp; i++) {
+                m_L1001_T(i,j) = 0.0;
+            }
+            continue;
+        }
+        doublereal constant = prefactor*m_mw[j]*m_crot[j] /
+                              (m_cinternal[j]*m_rotrelax[j]);
+        for (size_t i = 0; i < m_nsp; i++) {
+            m_L1001_T(i,j) = constant * m_astar(j,i) /
+                             ((m_mw[j] + m_mw[i]) * m_bdiff(j,i));
+        }
+    }
+
+    // L01,01 block; see Eqs. (12.130) and (12.131)
     const doublereal fivepi = 5.00*Pi;
     const doublereal eightoverpi = 8.0 / Pi;
-    doublereal prefactor = 4.00*m_temp;
-    size_t n2 = 2*m_nsp;
-    doublereal constant1, constant2, diff_int, sum;
+    prefactor = 4.00*m_temp;
     for (size_t i = 0; i < m_nsp; i++) {
-        if (hasInternalModes(i)) {
-            // collect terms that depend only on "i"
-            constant1 = prefactor*x[i]/m_cinternal[i];
-            constant2 = 12.00*m_mw[i]*m_crot[i] /
-                        (fivepi*m_cinternal[i]*m_rotrelax[i]);
-            sum = 0.0;
+        if (!hasInternalModes(i)) {
+            m_L0101_Tdiag[i] = 0.0;
             for (size_t k = 0; k < m_nsp; k++) {
-                // see Eq. (12.131)
-                diff_int = m_bdiff(i,k);
-                m_Lmatrix(k+n2,i+n2) = 0.0;
-                sum += x[k]/diff_int;
-                if (k != i) sum += x[k]*m_astar(i,k)*constant2 /
-                                       (m_mw[k]*diff_int);
+                m_L0101_T(k,i) = 0.0;
             }
-            // see Eq. (12.130)
-            m_Lmatrix(i+n2,i+n2) =
-                - eightoverpi*m_mw[i]*x[i]*x[i]*m_crot[i] /
-                (m_cinternal[i]*m_cinternal[i]*GasConstant*m_visc[i]*m_rotrelax[i])
-                - constant1*sum;
-        } else {
-            for (size_t k = 0; k < m_nsp; k++) {
-                m_Lmatrix(i+n2,i+n2) = 1.0;
+            continue;
+        }
+        doublereal constant1 = prefactor/m_cinternal[i];
+        doublereal constant2 = 12.00*m_mw[i]*m_crot[i] /
+                               (fivepi*m_cinternal[i]*m_rotrelax[i]);
+        for (size_t k = 0; k < m_nsp; k++) {
+            doublereal diff_int = m_bdiff(i,k);
+            doublereal f = 1.0 / diff_int;
+            if (k != i) {
+                f += m_astar(i,k)*constant2 / (m_mw[k]*diff_int);
             }
+            m_L0101_T(k,i) = constant1 * f;
         }
+        m_L0101_Tdiag[i] = eightoverpi*m_mw[i]*m_crot[i] /
+            (m_cinternal[i]*m_cinternal[i]*GasConstant*m_visc[i]*m_rotrelax[i]);
     }
 }
 
@@ -0,0 +1,66 @@
+#include "gtest/gtest.h"
+#include "hydrogen_flame.h"
+
+namespace Cantera
+{
+
+class CoarseGridTest : public testing::Test, public HydrogenFlame
+{
+public:
+    CoarseGridTest() : HydrogenFlame(33) {
+        sim->setFixedTemperature(700.0);
+        x0.assign(sim->solution(), sim->solution() + sim->size());
+        z0 = flow.grid();
+    }
+
+    //! Restore the initial grid and initial estimate
+    void reset() {
+        flow.setupGrid(z0.size(), z0.data());
+        sim->resize();
+        sim->setSolution(x0.data());
+    }
+
+    vector_fp x0, z0;
+};
+
+TEST_F(CoarseGridTest, coarseGrids)
+{
+    sim->solve(1, false);
+    double speed = flameSpeed();
+    EXPECT_EQ(std::string::npos, logger.text().find("[11] point"));
+
+    reset();
+    logger.clear();
+    sim->setCoarseGridSolve(2);
+    sim->solve(1, false);
+
+    // The coarse grids keep the fixed temperature point
+    EXPECT_NE(std::string::npos, logger.text().find("[11] point"));
+    EXPECT_NE(std::string::npos, logger.text().find("[18] point"));
+    ASSERT_EQ(z0.size(), flow.nPoints());
+    for (size_t j = 0; j < z0.size(); j++) {
+        EXPECT_DOUBLE_EQ(z0[j], flow.grid(j));
+    }
+    EXPECT_NEAR(speed, flameSpeed(), 1e-4 * speed);
+}
+
+TEST_F(CoarseGridTest, relaxedRefinement)
+{
+    sim->solve(0, true);
+    double speed = flameSpeed();
+
+    reset();
+    sim->setCoarseGridSolve(1, 20.0);
+    sim->solve(1, true);
+    EXPECT_NE(std::string::npos,
+              logger.text().find("Solving with the original tolerances"));
+    EXPECT_NEAR(speed, flameSpeed(), 1e-3 * speed);
+
+    // The original tolerances are restored
+    EXPECT_DOUBLE_EQ(1.0e-5, flow.steadyRtol(c_offset_T));
+    EXPECT_DOUBLE_EQ(1.0e-9, flow.steadyAtol(c_offset_T));
+
+    EXPECT_THROW(sim->setCoarseGridSolve(1, 0.5), CanteraError);
+}
+
+}
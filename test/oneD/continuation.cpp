@@ -0,0 +1,146 @@
+#include "gtest/gtest.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/Inlet1D.h"
+#include "cantera/numerics/Func1.h"
+
+namespace Cantera
+{
+
+//! The Bratu problem, u'' + lambda*exp(u) = 0 with u(0) = u(1) = 0, which has
+//! two solutions for lambda below a turning point at lambda = 3.5138, and no
+//! solutions above it.
+class BratuDomain : public Domain1D
+{
+public:
+    BratuDomain(size_t points) : Domain1D(1, points), lambda(1.0) {
+        vector_fp z(points);
+        for (size_t j = 0; j < points; j++) {
+            z[j] = j / (points - 1.0);
+        }
+        setupGrid(points, z.data());
+        setBounds(0, -1.0, 100.0);
+        setSteadyTolerances(1.0e-6, 1.0e-9);
+        setTransientTolerances(1.0e-6, 1.0e-9);
+    }
+
+    virtual void eval(size_t jg, doublereal* xg, doublereal* rg,
+                      integer* diagg, doublereal rdt) {
+        doublereal* x = xg + loc();
+        doublereal* r = rg + loc();
+        integer* diag = diagg + loc();
+        size_t np = nPoints();
+        r[0] = x[0];
+        r[np-1] = x[np-1];
+        diag[0] = diag[np-1] = 0;
+        for (size_t j = 1; j < np - 1; j++) {
+            doublereal h = z(j+1) - z(j);
+            r[j] = (x[j+1] - 2*x[j] + x[j-1]) / (h*h) + lambda * exp(x[j])
+                   - rdt * (x[j] - prevSoln(0, j));
+            diag[j] = 1;
+        }
+    }
+
+    virtual void _getInitialSoln(doublereal* x) {
+        std::fill(x, x + nPoints(), 0.0);
+    }
+
+    doublereal lambda;
+};
+
+//! Sets the parameter of the Bratu problem
+class SetLambda : public Func1
+{
+public:
+    SetLambda(BratuDomain& d) : m_domain(d) {}
+    virtual doublereal eval(doublereal lambda) const {
+        m_domain.lambda = lambda;
+        return 0.0;
+    }
+
+protected:
+    BratuDomain& m_domain;
+};
+
+class ContinuationTest : public testing::Test
+{
+public:
+    ContinuationTest() : bratu(41), setLambda(bratu) {
+        std::vector<Domain1D*> domains { &left, &bratu, &right };
+        sim.reset(new Sim1D(domains));
+        sim->setContinuationParameter(&setLambda);
+    }
+
+    //! Value of u(1/2) for the exact solution on the lower branch, which is
+    //! u = -2*log(cosh((x - 1/2)*theta/2) / cosh(theta/4)), where theta
+    //! satisfies theta = sqrt(2*lambda)*cosh(theta/4)
+    double exactMidpoint(double lambda) {
+        double theta = 0.0;
+        for (int i = 0; i < 200; i++) {
+            theta = sqrt(2 * lambda) * cosh(theta / 4);
+        }
+        return 2 * log(cosh(theta / 4));
+    }
+
+    double midpoint() {
+        return sim->value(1, 0, 20);
+    }
+
+    Empty1D left, right;
+    BratuDomain bratu;
+    SetLambda setLambda;
+    std::unique_ptr<Sim1D> sim;
+};
+
+TEST_F(ContinuationTest, natural)
+{
+    EXPECT_TRUE(sim->solveContinuation(0.5, 3.0, 0.5, 0, false));
+    const vector_fp& p = sim->continuationParameters();
+    EXPECT_DOUBLE_EQ(p.front(), 0.5);
+    EXPECT_DOUBLE_EQ(p.back(), 3.0);
+    EXPECT_DOUBLE_EQ(bratu.lambda, 3.0);
+    EXPECT_NEAR(midpoint(), exactMidpoint(3.0), 1e-3 * exactMidpoint(3.0));
+}
+
+TEST_F(ContinuationTest, naturalBeyondTurningPoint)
+{
+    EXPECT_FALSE(sim->solveContinuation(2.0, 4.0, 0.5, 0, false));
+    double p = sim->continuationParameters().back();
+    EXPECT_GT(p, 3.45);
+    EXPECT_LT(p, 3.514);
+    EXPECT_DOUBLE_EQ(bratu.lambda, p);
+}
+
+TEST_F(ContinuationTest, callback)
+{
+    // Stop once the midpoint value exceeds 0.3
+    class Stop : public Func1 {
+    public:
+        Stop(ContinuationTest& t) : m_test(t) {}
+        virtual doublereal eval(doublereal p) const {
+            return (m_test.midpoint() > 0.3) ? -1.0 : 0.0;
+        }
+        ContinuationTest& m_test;
+    } stop(*this);
+    sim->setContinuationCallback(&stop);
+    EXPECT_FALSE(sim->solveContinuation(0.5, 3.4, 0.1, 0, false));
+    EXPECT_GT(midpoint(), 0.3);
+    EXPECT_LT(bratu.lambda, 3.0);
+    EXPECT_DOUBLE_EQ(bratu.lambda, sim->continuationParameters().back());
+}
+
+TEST_F(ContinuationTest, arclength)
+{
+    size_t nsteps = sim->solveArclength(1.0, 0.1, 20, 0, false);
+    EXPECT_EQ(nsteps, 20u);
+    ASSERT_EQ(sim->turningPoints().size(), 1u);
+    EXPECT_NEAR(sim->turningPoints()[0], 3.5138, 0.005);
+
+    // The continuation should end on the upper branch, where the solution is
+    // larger than on the lower branch at the same value of the parameter
+    double p = sim->continuationParameters().back();
+    EXPECT_DOUBLE_EQ(bratu.lambda, p);
+    EXPECT_LT(p, 3.5);
+    EXPECT_GT(midpoint(), 2 * exactMidpoint(p));
+}
+
+}
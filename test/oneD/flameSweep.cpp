@@ -0,0 +1,75 @@
+#include "gtest/gtest.h"
+#include "cantera/oneD/FlameSweep.h"
+#include "hydrogen_flame.h"
+
+namespace Cantera
+{
+
+//! Sets the equivalence ratio and unburned gas temperature of a hydrogen/air
+//! flame
+class HydrogenSweep : public FlameSweep
+{
+public:
+    HydrogenSweep(Sim1D& sim) : FlameSweep(sim) {}
+
+protected:
+    virtual void setCase(Sim1D& sim, const vector_fp& params) {
+        Inlet1D& inlet = dynamic_cast<Inlet1D&>(sim.domain(0));
+        inlet.setMoleFractions(fmt::format("H2:{}, O2:0.5, N2:1.88",
+                                           params[0]));
+        inlet.setTemperature(params[1]);
+    }
+};
+
+class FlameSweepTest : public testing::Test, public HydrogenFlame
+{
+public:
+    FlameSweepTest() : HydrogenFlame(8) {
+        sim->setFixedTemperature(700.0);
+    }
+};
+
+TEST_F(FlameSweepTest, solve)
+{
+    HydrogenSweep sweep(*sim);
+    sweep.setThreads(2);
+    EXPECT_EQ(2u, sweep.threads());
+    sweep.addCase({1.0, 300.0});
+    sweep.addCase({1.0, 400.0});
+    sweep.addCase({0.8, 300.0});
+    EXPECT_THROW(sweep.addCase({1.0}), CanteraError);
+    EXPECT_EQ(3u, sweep.nCases());
+    sweep.solve(1);
+
+    vector_fp speeds;
+    for (size_t i = 0; i < sweep.nCases(); i++) {
+        ASSERT_TRUE(sweep.converged(i)) << sweep.log(i);
+        // The output of each case is kept separately
+        EXPECT_NE(std::string::npos, sweep.log(i).find("Problem solved"));
+        sweep.restoreCase(i);
+        EXPECT_DOUBLE_EQ(inlet.temperature(), sweep.parameters(i)[1]);
+        speeds.push_back(flameSpeed());
+    }
+    EXPECT_GT(speeds[1], 1.2 * speeds[0]);
+    EXPECT_LT(speeds[2], 0.9 * speeds[0]);
+
+    // The template is unchanged by the sweep, and solving it directly gives
+    // the same result as the sweep
+    sweep.restoreCase(0);
+    sim->solve(0);
+    EXPECT_NEAR(flameSpeed(), speeds[0], 1e-3 * speeds[0]);
+}
+
+TEST_F(FlameSweepTest, setCaseNotImplemented)
+{
+    FlameSweep sweep(*sim);
+    sweep.addCase({1.0});
+    sweep.setThreads(1);
+    // setCase must be implemented by a derived class
+    sweep.solve();
+    EXPECT_FALSE(sweep.converged(0));
+    EXPECT_NE(std::string::npos, sweep.log(0).find("Not implemented"));
+    EXPECT_THROW(sweep.restoreCase(0), CanteraError);
+}
+
+}
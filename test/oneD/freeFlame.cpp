@@ -0,0 +1,510 @@
+#include "gtest/gtest.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/Inlet1D.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/IdealGasMix.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/base/global.h"
+#include "hydrogen_flame.h"
+
+#include <sstream>
+
+namespace Cantera
+{
+
+//! Evaluate the steady-state Jacobian at the current solution, and return its
+//! elements within the band
+vector_fp bandedJacobian(Sim1D& sim)
+{
+    vector_fp x(sim.solution(), sim.solution() + sim.size());
+    vector_fp r(sim.size());
+    sim.OneDim::eval(npos, x.data(), r.data(), 0.0, 0);
+    MultiJac& jac = sim.OneDim::jacobian();
+    jac.eval(x.data(), r.data(), 0.0);
+    vector_fp J;
+    size_t n = jac.nRows();
+    for (size_t i = 0; i < n; i++) {
+        size_t jmin = (i > jac.nSubDiagonals()) ? i - jac.nSubDiagonals() : 0;
+        size_t jmax = std::min(n - 1, i + jac.nSuperDiagonals());
+        for (size_t j = jmin; j <= jmax; j++) {
+            J.push_back(jac(i, j));
+        }
+    }
+    return J;
+}
+
+//! Compare the elements of two Jacobians returned by bandedJacobian(),
+//! relative to the largest element in each row
+void compareBandedJacobians(Sim1D& sim, const vector_fp& J1,
+                            const vector_fp& J2, double rtol)
+{
+    ASSERT_EQ(J1.size(), J2.size());
+    MultiJac& jac = sim.OneDim::jacobian();
+    size_t n = jac.nRows();
+    size_t ipt = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t jmin = (i > jac.nSubDiagonals()) ? i - jac.nSubDiagonals() : 0;
+        size_t jmax = std::min(n - 1, i + jac.nSuperDiagonals());
+        double scale = 0.0;
+        for (size_t j = 0; j <= jmax - jmin; j++) {
+            scale = std::max(scale, std::abs(J1[ipt + j]));
+        }
+        for (size_t j = jmin; j <= jmax; j++) {
+            EXPECT_NEAR(J1[ipt], J2[ipt], rtol * scale) << i << ", " << j;
+            ipt++;
+        }
+    }
+}
+
+class FreeFlameTest : public testing::Test
+{
+public:
+    FreeFlameTest()
+        : gas("gri30.xml", "gri30_mix")
+        , flow(&gas)
+    {
+        T0 = 300.0;
+        gas.setState_TPX(T0, OneAtm, "CH4:1.0, O2:2.0, N2:7.52");
+        size_t nsp = gas.nSpecies();
+        X.resize(nsp);
+        Yin.resize(nsp);
+        Yout.resize(nsp);
+        gas.getMoleFractions(X.data());
+        gas.getMassFractions(Yin.data());
+        double rho_in = gas.density();
+        gas.equilibrate("HP");
+        gas.getMassFractions(Yout.data());
+        rho_out = gas.density();
+        Tad = gas.temperature();
+
+        vector_fp z(12);
+        for (size_t i = 0; i < z.size(); i++) {
+            z[i] = 0.02 * i / (z.size() - 1);
+        }
+        flow.setupGrid(z.size(), z.data());
+        trans.reset(newTransportMgr("Mix", &gas));
+        flow.setTransport(*trans);
+        flow.setKinetics(gas);
+        flow.setPressure(OneAtm);
+
+        mdot = 0.3 * rho_in;
+        inlet.setMdot(mdot);
+        inlet.setTemperature(T0);
+        std::vector<Domain1D*> domains { &inlet, &flow, &outlet };
+        sim.reset(new Sim1D(domains));
+        inlet.setMoleFractions(X.data());
+        setInitialGuess();
+    }
+
+    void setInitialGuess() {
+        vector_fp locs{0.0, 0.3, 1.0};
+        vector_fp value{0.3, mdot/rho_out, mdot/rho_out};
+        sim->setInitialGuess("u", locs, value);
+        value = {T0, Tad, Tad};
+        sim->setInitialGuess("T", locs, value);
+        for (size_t k = 0; k < gas.nSpecies(); k++) {
+            value = {Yin[k], Yout[k], Yout[k]};
+            sim->setInitialGuess(gas.speciesName(k), locs, value);
+        }
+    }
+
+    //! Evaluate the residual at the current solution
+    vector_fp evalResidual() {
+        vector_fp x(sim->solution(), sim->solution() + sim->size());
+        vector_fp r(sim->size());
+        sim->OneDim::eval(npos, x.data(), r.data(), 0.0, 0);
+        return r;
+    }
+
+    vector_fp evalJacobian() {
+        return bandedJacobian(*sim);
+    }
+
+    void compareJacobians(const vector_fp& J1, const vector_fp& J2,
+                          double rtol) {
+        compareBandedJacobians(*sim, J1, J2, rtol);
+    }
+
+    IdealGasMix gas;
+    double T0, Tad, mdot, rho_out;
+    vector_fp X, Yin, Yout;
+    std::unique_ptr<Transport> trans;
+    FreeFlame flow;
+    Inlet1D inlet;
+    Outlet1D outlet;
+    std::unique_ptr<Sim1D> sim;
+};
+
+TEST_F(FreeFlameTest, coloredJacobian)
+{
+    vector_fp J1 = evalJacobian();
+    int nevals = sim->OneDim::jacobian().nEvals();
+    sim->setJacobianColoring(true);
+    vector_fp J2 = evalJacobian();
+    EXPECT_EQ(nevals + 1, sim->OneDim::jacobian().nEvals());
+    ASSERT_EQ(J1.size(), J2.size());
+    for (size_t i = 0; i < J1.size(); i++) {
+        EXPECT_EQ(J1[i], J2[i]) << i;
+    }
+
+    // The coloring option is kept when the grid changes
+    flow.setupGrid(8, vector_fp{0, 0.001, 0.002, 0.005, 0.01, 0.012, 0.015, 0.02}.data());
+    sim->resize();
+    EXPECT_TRUE(sim->OneDim::jacobian().coloring());
+}
+
+TEST_F(FreeFlameTest, coloredJacobianRadiation)
+{
+    flow.solveEnergyEqn();
+    flow.enableRadiation(true);
+    flow.setBoundaryEmissivities(0.3, 0.4);
+    vector_fp J1 = evalJacobian();
+    sim->setJacobianColoring(true);
+    vector_fp J2 = evalJacobian();
+    ASSERT_EQ(J1.size(), J2.size());
+    for (size_t i = 0; i < J1.size(); i++) {
+        EXPECT_EQ(J1[i], J2[i]) << i;
+    }
+}
+
+TEST_F(FreeFlameTest, radiationJacobianLeftBoundary)
+{
+    // The radiative heat loss at each interior point depends on the flux
+    // from the left boundary. Compare the part of the Jacobian due to that
+    // flux with the change in the full residual.
+    flow.solveEnergyEqn();
+    flow.enableRadiation(true);
+    MultiJac& jac = sim->OneDim::jacobian();
+    size_t iT0 = flow.loc() + flow.index(c_offset_T, 0);
+    size_t iT1 = flow.loc() + flow.index(c_offset_T, 1);
+    double T0 = sim->value(1, c_offset_T, 0);
+    double dT = 1e-6 * T0;
+    vector_fp dJ, dr;
+    for (double eps : {0.0, 0.8}) {
+        flow.setBoundaryEmissivities(eps, 0.0);
+        evalJacobian();
+        dJ.push_back(jac(iT1, iT0));
+        double r1 = evalResidual()[iT1];
+        sim->setValue(1, c_offset_T, 0, T0 + dT);
+        double r2 = evalResidual()[iT1];
+        sim->setValue(1, c_offset_T, 0, T0);
+        dr.push_back((r2 - r1) / dT);
+    }
+    double drad = dr[1] - dr[0];
+    EXPECT_NE(0.0, drad);
+    EXPECT_NEAR(drad, dJ[1] - dJ[0], 1e-3 * std::abs(drad));
+}
+
+TEST_F(FreeFlameTest, analyticJacobian)
+{
+    flow.solveEnergyEqn();
+    flow.enableRadiation(true);
+    flow.setBoundaryEmissivities(0.3, 0.4);
+    vector_fp J1 = evalJacobian();
+    sim->setAnalyticJacobian(true);
+    vector_fp J2 = evalJacobian();
+    compareJacobians(J1, J2, 1e-5);
+}
+
+TEST_F(FreeFlameTest, analyticJacobianMulti)
+{
+    trans.reset(newTransportMgr("Multi", &gas));
+    flow.setTransport(*trans, true);
+    flow.solveEnergyEqn();
+    vector_fp J1 = evalJacobian();
+    sim->setAnalyticJacobian(true);
+    vector_fp J2 = evalJacobian();
+    compareJacobians(J1, J2, 1e-5);
+}
+
+//! A premixed methane/air flame between opposed jets of reactants and
+//! equilibrium products, which uses AxiStagnFlow
+class CounterflowTest : public testing::Test
+{
+public:
+    CounterflowTest()
+        : gas("gri30.xml", "gri30_mix")
+        , flow(&gas)
+    {
+        gas.setState_TPX(300.0, OneAtm, "CH4:1.0, O2:2.0, N2:7.52");
+        size_t nsp = gas.nSpecies();
+        vector_fp X(nsp), Yin(nsp), Yout(nsp);
+        gas.getMoleFractions(X.data());
+        gas.getMassFractions(Yin.data());
+        double rho_in = gas.density();
+        reactants.setMoleFractions(X.data());
+        gas.equilibrate("HP");
+        gas.getMoleFractions(X.data());
+        gas.getMassFractions(Yout.data());
+        double rho_out = gas.density();
+        double Tad = gas.temperature();
+        products.setMoleFractions(X.data());
+
+        vector_fp z(12);
+        for (size_t i = 0; i < z.size(); i++) {
+            z[i] = 0.02 * i / (z.size() - 1);
+        }
+        flow.setupGrid(z.size(), z.data());
+        trans.reset(newTransportMgr("Mix", &gas));
+        flow.setTransport(*trans);
+        flow.setKinetics(gas);
+        flow.setPressure(OneAtm);
+
+        reactants.setMdot(1.0 * rho_in);
+        reactants.setTemperature(300.0);
+        products.setMdot(1.0 * rho_out);
+        products.setTemperature(Tad);
+        std::vector<Domain1D*> domains { &reactants, &flow, &products };
+        sim.reset(new Sim1D(domains));
+
+        vector_fp locs{0.0, 0.5, 1.0};
+        vector_fp value{1.0, 0.0, -1.0};
+        sim->setInitialGuess("u", locs, value);
+        value = {300.0, Tad, Tad};
+        sim->setInitialGuess("T", locs, value);
+        for (size_t k = 0; k < nsp; k++) {
+            value = {Yin[k], Yout[k], Yout[k]};
+            sim->setInitialGuess(gas.speciesName(k), locs, value);
+        }
+    }
+
+    IdealGasMix gas;
+    std::unique_ptr<Transport> trans;
+    AxiStagnFlow flow;
+    Inlet1D reactants, products;
+    std::unique_ptr<Sim1D> sim;
+};
+
+TEST_F(CounterflowTest, analyticJacobian)
+{
+    flow.solveEnergyEqn();
+    flow.enableRadiation(true);
+    flow.setBoundaryEmissivities(0.3, 0.4);
+    vector_fp J1 = bandedJacobian(*sim);
+    sim->setAnalyticJacobian(true);
+    vector_fp J2 = bandedJacobian(*sim);
+    compareBandedJacobians(*sim, J1, J2, 1e-5);
+}
+
+TEST_F(FreeFlameTest, blockTridiagonalSolver)
+{
+    flow.solveEnergyEqn();
+    sim->setFixedTemperature(900.0);
+    evalJacobian();
+    MultiJac& jac = sim->OneDim::jacobian();
+    size_t n = jac.nRows();
+    vector_fp b(n), x1(n), x2(n), prod(n);
+    for (size_t i = 0; i < n; i++) {
+        b[i] = 1.0 + 0.01 * i;
+    }
+    ASSERT_EQ(0, jac.solve(b.data(), x1.data()));
+
+    sim->setBlockTridiagonalSolver(true);
+    EXPECT_FALSE(jac.factored());
+    ASSERT_EQ(0, jac.solve(b.data(), x2.data()));
+    // The steady-state Jacobian for the initial guess is poorly conditioned,
+    // so compare the residuals to those obtained with the banded solver
+    jac.mult(x1.data(), prod.data());
+    double resid1 = 0.0, xmax = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        resid1 = std::max(resid1, std::abs(prod[i] - b[i]));
+        xmax = std::max(xmax, std::abs(x1[i]));
+    }
+    jac.mult(x2.data(), prod.data());
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_NEAR(b[i], prod[i], 10 * resid1) << i;
+        EXPECT_NEAR(x1[i], x2[i], 1e-8 * xmax) << i;
+    }
+
+    // The option is kept when the grid changes
+    flow.setupGrid(8, vector_fp{0, 0.001, 0.002, 0.005, 0.01, 0.012, 0.015, 0.02}.data());
+    sim->resize();
+    EXPECT_TRUE(sim->OneDim::jacobian().blockSolver());
+}
+
+TEST_F(FreeFlameTest, broydenUpdate)
+{
+    flow.solveEnergyEqn();
+    sim->setFixedTemperature(900.0);
+    sim->setBroydenUpdates(2);
+    evalJacobian();
+    MultiJac& jac = sim->OneDim::jacobian();
+    EXPECT_EQ(2u, jac.broydenUpdates());
+    size_t n = jac.nRows();
+    vector_fp x(sim->solution(), sim->solution() + n);
+    vector_fp dx(n), dx2(n), df(n), y(n), y0(n);
+    for (size_t i = 0; i < n; i++) {
+        dx[i] = 1e-4 * (std::abs(x[i]) + 1e-3) * (1 + 0.1 * (i % 7));
+        dx2[i] = dx[i] * (1.0 + 0.2 * (i % 3));
+    }
+    // A change in the residual which is not consistent with the current
+    // Jacobian
+    jac.mult(dx2.data(), df.data());
+    ASSERT_EQ(0, jac.solve(df.data(), y0.data()));
+
+    // The updated Jacobian satisfies the secant condition
+    vector_fp w(n, 2.0);
+    EXPECT_TRUE(jac.broydenUpdate(dx.data(), df.data(), w.data()));
+    EXPECT_EQ(1, jac.nBroydenUpdates());
+    ASSERT_EQ(0, jac.solve(df.data(), y.data()));
+    double dxmax = *std::max_element(dx.begin(), dx.end());
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_NEAR(dx[i], y[i], 1e-6 * dxmax) << i;
+    }
+
+    // Only the specified number of updates is applied
+    EXPECT_TRUE(jac.broydenUpdate(dx2.data(), df.data()));
+    EXPECT_FALSE(jac.broydenUpdate(dx.data(), df.data()));
+    EXPECT_EQ(2, jac.nBroydenUpdates());
+
+    // The updates are discarded when the Jacobian is factored again
+    jac.updateTransient(0.0, jac.transientMask().data());
+    ASSERT_EQ(0, jac.solve(df.data(), y.data()));
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(y0[i], y[i]) << i;
+    }
+
+    // The option is kept when the grid changes
+    flow.setupGrid(8, vector_fp{0, 0.001, 0.002, 0.005, 0.01, 0.012, 0.015, 0.02}.data());
+    sim->resize();
+    EXPECT_EQ(2u, sim->OneDim::jacobian().broydenUpdates());
+}
+
+TEST_F(FreeFlameTest, threadedEval)
+{
+    vector_fp z(100);
+    for (size_t i = 0; i < z.size(); i++) {
+        z[i] = 0.02 * i / (z.size() - 1);
+    }
+    flow.setupGrid(z.size(), z.data());
+    std::vector<Domain1D*> domains { &inlet, &flow, &outlet };
+    sim.reset(new Sim1D(domains));
+    setInitialGuess();
+    flow.solveEnergyEqn();
+    flow.enableRadiation(true);
+    flow.setBoundaryEmissivities(0.3, 0.4);
+    sim->setFixedTemperature(900.0);
+
+    vector_fp r1 = evalResidual();
+    vector_fp J1 = evalJacobian();
+    sim->setJacobianColoring(true);
+    vector_fp J1c = evalJacobian();
+
+    flow.setThreads(4);
+    EXPECT_EQ(4u, flow.threads());
+    vector_fp r2 = evalResidual();
+    vector_fp J2c = evalJacobian();
+    sim->setJacobianColoring(false);
+    vector_fp J2 = evalJacobian();
+
+    // Results are identical to those obtained using a single thread
+    ASSERT_EQ(r1.size(), r2.size());
+    for (size_t i = 0; i < r1.size(); i++) {
+        EXPECT_EQ(r1[i], r2[i]) << i;
+    }
+    ASSERT_EQ(J1.size(), J2.size());
+    ASSERT_EQ(J1.size(), J2c.size());
+    for (size_t i = 0; i < J1.size(); i++) {
+        EXPECT_EQ(J1[i], J2[i]) << i;
+        EXPECT_EQ(J1c[i], J2c[i]) << i;
+    }
+}
+
+//! Solve `flame`, increase its temperature by 2%, and take `nsteps` time
+//! steps from there, starting with a step of `dt` and a new Jacobian.
+//! Returns the ratios of the sizes of successive successful steps, read
+//! from the output of OneDim::timeStep().
+vector_fp perturbedTimeSteps(HydrogenFlame& flame, int nsteps, double dt)
+{
+    flame.sim->setFixedTemperature(700.0);
+    flame.sim->solve(0, false);
+    vector_fp x(flame.sim->solution(),
+                flame.sim->solution() + flame.sim->size());
+    vector_fp r(x.size());
+    for (size_t j = 0; j < flame.flow.nPoints(); j++) {
+        x[flame.flow.loc() + flame.flow.index(c_offset_T, j)] *= 1.02;
+    }
+    flame.sim->OneDim::jacobian().setAge(10000);
+    flame.sim->clearStats();
+    flame.logger.clear();
+    Logger* previous = redirectLogger(&flame.logger);
+    flame.sim->timeStep(nsteps, dt, x.data(), r.data(), 1);
+    redirectLogger(previous);
+
+    // Each attempted step is logged as its number and size. A failed step
+    // is retried with the same number.
+    std::istringstream log(flame.logger.text());
+    std::string line;
+    vector_fp ratios;
+    int nlast = -1;
+    double dtlast = 0.0;
+    while (std::getline(log, line)) {
+        std::istringstream fields(line);
+        int n;
+        if (fields >> n >> dt) {
+            if (nlast >= 0 && n == nlast + 1) {
+                ratios.push_back(dt / dtlast);
+            }
+            nlast = n;
+            dtlast = dt;
+        }
+    }
+    return ratios;
+}
+
+TEST(TimeStepController, default)
+{
+    HydrogenFlame flame(20);
+    // The step grows by at most a factor of 1.5
+    vector_fp ratios = perturbedTimeSteps(flame, 20, 1e-6);
+    ASSERT_EQ(19u, ratios.size());
+    for (double f : ratios) {
+        EXPECT_LE(f, 1.501);
+    }
+    EXPECT_EQ(20, flame.sim->nTimeSteps());
+    EXPECT_GT(flame.sim->nTimeStepJacobians(), 0);
+
+    // All of the steps are taken, even after the maximum step is reached
+    flame.sim->setMaxTimeStep(1e-6);
+    perturbedTimeSteps(flame, 20, 1e-6);
+    EXPECT_EQ(20, flame.sim->nTimeSteps());
+
+    flame.sim->clearStats();
+    EXPECT_EQ(0, flame.sim->nTimeSteps());
+    EXPECT_EQ(0, flame.sim->nTimeStepFailures());
+    EXPECT_EQ(0, flame.sim->nTimeStepJacobians());
+}
+
+TEST(TimeStepController, ser)
+{
+    HydrogenFlame flame(20);
+    flame.sim->setTimeStepController(true, 1.0, 4.0);
+    // The step grows faster than with the default controller as the
+    // residual decreases, by at most `maxFactor`
+    vector_fp ratios = perturbedTimeSteps(flame, 20, 1e-6);
+    ASSERT_EQ(19u, ratios.size());
+    double fmax = *std::max_element(ratios.begin(), ratios.end());
+    EXPECT_GT(fmax, 2.0);
+    EXPECT_LE(fmax, 4.001);
+    EXPECT_EQ(20, flame.sim->nTimeSteps());
+
+    // Time stepping stops once a step of the maximum size has been taken
+    flame.sim->setMaxTimeStep(1e-4);
+    perturbedTimeSteps(flame, 50, 1e-6);
+    EXPECT_LT(flame.sim->nTimeSteps(), 50);
+
+    EXPECT_THROW(flame.sim->setTimeStepController(true, 0.0), CanteraError);
+    EXPECT_THROW(flame.sim->setTimeStepController(true, 1.0, 1.0),
+                 CanteraError);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    printf("Running main() from freeFlame.cpp\n");
+    testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+    Cantera::appdelete();
+    return result;
+}
@@ -0,0 +1,84 @@
+#ifndef CT_TEST_HYDROGEN_FLAME_H
+#define CT_TEST_HYDROGEN_FLAME_H
+
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/Inlet1D.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/IdealGasMix.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/base/logger.h"
+
+namespace Cantera
+{
+
+//! An unsolved, freely-propagating hydrogen/air flame on a uniform grid, with
+//! an initial guess interpolated between the unburned and equilibrium states.
+//! The output of the solver is collected by #logger.
+class HydrogenFlame
+{
+public:
+    HydrogenFlame(size_t points)
+        : gas("h2o2-plus.xml", "ohmech")
+        , flow(&gas)
+    {
+        gas.setState_TPX(300.0, OneAtm, "H2:1.0, O2:0.5, N2:1.88");
+        size_t nsp = gas.nSpecies();
+        vector_fp Yin(nsp), Yout(nsp);
+        gas.getMassFractions(Yin.data());
+        double rho_in = gas.density();
+        gas.equilibrate("HP");
+        gas.getMassFractions(Yout.data());
+        double rho_out = gas.density();
+        double Tad = gas.temperature();
+        gas.setState_TPY(300.0, OneAtm, Yin.data());
+
+        vector_fp z(points);
+        for (size_t i = 0; i < z.size(); i++) {
+            z[i] = 0.01 * i / (z.size() - 1);
+        }
+        flow.setupGrid(z.size(), z.data());
+        trans.reset(newTransportMgr("Mix", &gas));
+        flow.setTransport(*trans);
+        flow.setKinetics(gas);
+        flow.setPressure(OneAtm);
+        flow.setSteadyTolerances(1.0e-5, 1.0e-9);
+        flow.setTransientTolerances(1.0e-4, 1.0e-11);
+
+        double mdot = 2.0 * rho_in;
+        inlet.setMdot(mdot);
+        inlet.setTemperature(300.0);
+        inlet.setMoleFractions("H2:1.0, O2:0.5, N2:1.88");
+        std::vector<Domain1D*> domains { &inlet, &flow, &outlet };
+        sim.reset(new Sim1D(domains));
+        sim->setRefineCriteria(1, 5.0, 0.5, 0.5, 0.1);
+        sim->setLogger(&logger);
+
+        vector_fp locs{0.0, 0.3, 1.0};
+        vector_fp value{2.0, mdot/rho_out, mdot/rho_out};
+        sim->setInitialGuess("u", locs, value);
+        value = {300.0, Tad, Tad};
+        sim->setInitialGuess("T", locs, value);
+        for (size_t k = 0; k < nsp; k++) {
+            value = {Yin[k], Yout[k], Yout[k]};
+            sim->setInitialGuess(gas.speciesName(k), locs, value);
+        }
+        flow.solveEnergyEqn();
+    }
+
+    //! The flame speed for the current solution
+    double flameSpeed() {
+        return sim->value(1, c_offset_U, 0);
+    }
+
+    IdealGasMix gas;
+    std::unique_ptr<Transport> trans;
+    FreeFlame flow;
+    Inlet1D inlet;
+    Outlet1D outlet;
+    std::unique_ptr<Sim1D> sim;
+    StringLogger logger;
+};
+
+}
+
+#endif
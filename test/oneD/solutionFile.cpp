@@ -0,0 +1,127 @@
+#include "gtest/gtest.h"
+#include "cantera/oneD/SolutionFile.h"
+#include "hydrogen_flame.h"
+
+#include <cstdio>
+#include <fstream>
+
+namespace Cantera
+{
+
+//! An unsolved hydrogen/air flame, with an initial guess that has been
+//! perturbed so that its values are not exactly representable as text
+class SolutionFlame : public HydrogenFlame
+{
+public:
+    SolutionFlame(size_t points) : HydrogenFlame(points) {
+        for (size_t j = 0; j < flow.nPoints(); j++) {
+            sim->setValue(1, c_offset_T, j,
+                          sim->value(1, c_offset_T, j) * (1.0 + 1e-13 * j / 3));
+        }
+    }
+};
+
+class SolutionFileTest : public testing::Test
+{
+public:
+    SolutionFileTest() : fname("test_solution_file.ctsol") {
+        std::remove(fname.c_str());
+    }
+    ~SolutionFileTest() {
+        std::remove(fname.c_str());
+    }
+
+    std::string fname;
+};
+
+TEST_F(SolutionFileTest, saveRestore)
+{
+    SolutionFlame a(9);
+    SolutionFlame b(5);
+    {
+        SolutionFile file(fname);
+        EXPECT_EQ(0u, file.nSolutions());
+        a.sim->save(file, "first", "nine points", 0);
+        b.sim->save(file, "second", "five points", 0);
+        EXPECT_EQ(2u, file.nSolutions());
+    }
+
+    // The solutions are read back from a new object
+    SolutionFile file(fname);
+    ASSERT_EQ(2u, file.nSolutions());
+    EXPECT_EQ("first", file.solutionIds()[0]);
+    EXPECT_TRUE(file.hasSolution("second"));
+    EXPECT_FALSE(file.hasSolution("third"));
+    EXPECT_EQ("five points", file.description("second"));
+    EXPECT_LE(std::abs(std::time(0) - file.saveTime("first")), 60);
+    EXPECT_THROW(file.domains("third"), CanteraError);
+
+    std::vector<SolutionFile::DomainData> data = file.domains("first");
+    ASSERT_EQ(3u, data.size());
+    EXPECT_EQ(a.flow.id(), data[1].id);
+    EXPECT_EQ(9u, data[1].nPoints);
+    EXPECT_EQ("lambda", data[1].components[c_offset_L]);
+
+    // Restoring changes the grid, and gives exactly the saved values
+    SolutionFlame c(5);
+    c.sim->restore(file, "first", 0);
+    ASSERT_EQ(9u, c.flow.nPoints());
+    ASSERT_EQ(a.sim->size(), c.sim->size());
+    for (size_t i = 0; i < a.sim->size(); i++) {
+        EXPECT_EQ(a.sim->solution()[i], c.sim->solution()[i]);
+    }
+    for (size_t j = 0; j < 9; j++) {
+        EXPECT_EQ(a.flow.grid(j), c.flow.grid(j));
+    }
+}
+
+TEST_F(SolutionFileTest, replace)
+{
+    SolutionFlame a(9);
+    SolutionFile file(fname);
+    a.sim->save(file, "first", "", 0);
+    a.sim->save(file, "second", "", 0);
+    a.sim->setValue(1, c_offset_T, 4, 1234.5);
+    a.sim->save(file, "first", "replaced", 0);
+    ASSERT_EQ(2u, file.nSolutions());
+    EXPECT_EQ("first", file.solutionIds()[0]);
+    EXPECT_EQ("replaced", file.description("first"));
+
+    SolutionFlame b(5);
+    b.sim->restore(file, "first", 0);
+    EXPECT_DOUBLE_EQ(1234.5, b.sim->value(1, c_offset_T, 4));
+    b.sim->restore(file, "second", 0);
+    EXPECT_NE(1234.5, b.sim->value(1, c_offset_T, 4));
+}
+
+TEST_F(SolutionFileTest, restartFreeFlame)
+{
+    HydrogenFlame a(8);
+    a.sim->setFixedTemperature(700.0);
+    a.sim->solve(0, true);
+    double speed = a.flameSpeed();
+    {
+        SolutionFile file(fname);
+        a.sim->save(file, "solved", "", 0);
+    }
+
+    // The fixed temperature point is restored along with the solution, so
+    // the flame speed is still determined when solving the restored flame
+    SolutionFile file(fname);
+    HydrogenFlame b(5);
+    b.sim->restore(file, "solved", 0);
+    EXPECT_DOUBLE_EQ(a.flow.m_zfixed, b.flow.m_zfixed);
+    EXPECT_DOUBLE_EQ(a.flow.m_tfixed, b.flow.m_tfixed);
+    b.sim->solve(0, false);
+    EXPECT_NEAR(speed, b.flameSpeed(), 1e-6 * speed);
+}
+
+TEST_F(SolutionFileTest, invalidFile)
+{
+    std::ofstream s(fname);
+    s << "This is not a solution file\n";
+    s.close();
+    EXPECT_THROW(SolutionFile file(fname), CanteraError);
+}
+
+}
@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/HMWSoln.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+namespace Cantera
+{
+
+class HMWSoln_Test : public testing::Test
+{
+public:
+    HMWSoln_Test() {
+        test_phase.reset(newHMW());
+    }
+
+    HMWSoln* newHMW() {
+        return dynamic_cast<HMWSoln*>(newPhase("../data/HMW_NaCl_tc.xml",
+                                               "NaCl_electrolyte"));
+    }
+
+    //! Properties that depend on the Pitzer coefficients, the g functions and
+    //! their temperature and pressure derivatives
+    vector_fp getProperties(HMWSoln& phase) {
+        size_t K = phase.nSpecies();
+        vector_fp props{phase.density(), phase.enthalpy_mole(),
+                        phase.entropy_mole(), phase.cp_mole()};
+        vector_fp x(5*K);
+        phase.getMolalityActivityCoefficients(&x[0]);
+        phase.getChemPotentials(&x[K]);
+        phase.getPartialMolarEnthalpies(&x[2*K]);
+        phase.getPartialMolarCp(&x[3*K]);
+        phase.getPartialMolarVolumes(&x[4*K]);
+        props.insert(props.end(), x.begin(), x.end());
+        return props;
+    }
+
+    std::unique_ptr<HMWSoln> test_phase;
+};
+
+TEST_F(HMWSoln_Test, stateChanges)
+{
+    // Change the composition, the temperature and the pressure separately,
+    // and compare with a phase that is set directly to each state
+    struct State {
+        double T;
+        double P;
+        const char* M;
+    };
+    std::vector<State> states {
+        {298.15, OneAtm, "Na+:6.0954, Cl-:6.0954, H+:2.1628E-9, OH-:1.3977E-6"},
+        {298.15, OneAtm, "Na+:1.5, Cl-:1.5, H+:2.1628E-9, OH-:1.3977E-6"},
+        {350.0, OneAtm, "Na+:1.5, Cl-:1.5, H+:2.1628E-9, OH-:1.3977E-6"},
+        {350.0, 2e7, "Na+:1.5, Cl-:1.5, H+:2.1628E-9, OH-:1.3977E-6"},
+        {350.0, 2e7, "Na+:1.5, Cl-:1.5, H+:1.0E-7, OH-:1.0E-7"},
+        {298.15, OneAtm, "Na+:6.0954, Cl-:6.0954, H+:2.1628E-9, OH-:1.3977E-6"},
+    };
+    std::vector<vector_fp> props;
+    for (const auto& state : states) {
+        test_phase->setState_TPM(state.T, state.P, state.M);
+        props.push_back(getProperties(*test_phase));
+
+        std::unique_ptr<HMWSoln> fresh(newHMW());
+        fresh->setState_TPM(state.T, state.P, state.M);
+        vector_fp expected = getProperties(*fresh);
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_NEAR(expected[i], props.back()[i],
+                        1e-12 * std::abs(expected[i]))
+                << state.T << ", " << state.P << ", " << i;
+        }
+    }
+    // The water density is found iteratively from the previous state, so the
+    // results only agree to within the solver tolerance
+    for (size_t i = 0; i < props[0].size(); i++) {
+        EXPECT_NEAR(props[0][i], props.back()[i], 1e-12 * std::abs(props[0][i]));
+    }
+    // Each change affects the chemical potential of H+
+    size_t i = 4 + test_phase->nSpecies() + test_phase->speciesIndex("H+");
+    for (size_t n = 1; n < props.size(); n++) {
+        EXPECT_GT(std::abs(props[n][i] - props[n-1][i]), 1.0) << n;
+    }
+}
+
+}
@@ -87,6 +87,28 @@ TEST_F(RedlichKister_Test, dlnActivities)
     }
 }
 
+TEST_F(RedlichKister_Test, dlnActCoeffds)
+{
+    // Compare the composition derivatives with finite differences of the
+    // activity coefficients, which also checks that cached values are
+    // updated when the composition changes.
+    test_phase->setState_TP(298.15, 101325.);
+    const double dXds[2] = {1.0, -1.0};
+    const double h = 1e-6;
+    vector_fp lnac1(2), lnac2(2), dlnac(2);
+    for (int i = 0; i < 9; ++i) {
+        const double r = 0.6 + i * 0.3 / 8;
+        set_r(r);
+        test_phase->getdlnActCoeffds(0.0, dXds, &dlnac[0]);
+        test_phase->getLnActivityCoefficients(&lnac1[0]);
+        set_r(r + h);
+        test_phase->getLnActivityCoefficients(&lnac2[0]);
+        for (size_t k = 0; k < 2; k++) {
+            EXPECT_NEAR(dlnac[k], (lnac2[k] - lnac1[k]) / h, 1e-4);
+        }
+    }
+}
+
 TEST_F(RedlichKister_Test, activityCoeffs)
 {
     test_phase->setState_TP(298., 1.);
@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/RedlichKwongMFTP.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+namespace Cantera
+{
+
+class RedlichKwongMFTP_Test : public testing::Test
+{
+public:
+    RedlichKwongMFTP_Test() {
+        test_phase.reset(newPhase("../data/RedlichKwongMFTP_HighP.xml",
+                                  "rk-linear"));
+    }
+
+    //! Properties that depend on the a and b parameters and the density
+    vector_fp getProperties(ThermoPhase& phase) {
+        vector_fp props{phase.density(), phase.pressure(), phase.cp_mass(),
+                        phase.enthalpy_mass(), phase.entropy_mass()};
+        vector_fp mu(phase.nSpecies());
+        phase.getChemPotentials(mu.data());
+        props.insert(props.end(), mu.begin(), mu.end());
+        return props;
+    }
+
+    std::unique_ptr<ThermoPhase> test_phase;
+};
+
+TEST_F(RedlichKwongMFTP_Test, construct_from_xml)
+{
+    RedlichKwongMFTP* rk = dynamic_cast<RedlichKwongMFTP*>(test_phase.get());
+    EXPECT_TRUE(rk != NULL);
+}
+
+TEST_F(RedlichKwongMFTP_Test, densitiesCalc)
+{
+    RedlichKwongMFTP& rk = dynamic_cast<RedlichKwongMFTP&>(*test_phase);
+    vector_fp T{300.0, 400.0, 500.0, 700.0, 1000.0, 350.0};
+    vector_fp P{1e5, 2e6, 5e6, 2e7, 5e7, 1e7};
+    vector_fp rho(T.size());
+    for (int phase : {FLUID_GAS, FLUID_LIQUID_0}) {
+        for (const char* X : {"CO2:0.5, N2:0.3, H2O:0.1, H2:0.1",
+                              "CO2:0.1, H2O:0.9"}) {
+            test_phase->setState_TPX(500.0, 5e6, X);
+            vector_fp props = getProperties(rk);
+            rk.densitiesCalc(T.size(), T.data(), P.data(), phase, rho.data());
+
+            // The state of the phase is not changed
+            vector_fp props2 = getProperties(rk);
+            for (size_t i = 0; i < props.size(); i++) {
+                EXPECT_DOUBLE_EQ(props[i], props2[i]) << i;
+            }
+
+            // The mixing sums are evaluated in a different order
+            for (size_t n = 0; n < T.size(); n++) {
+                EXPECT_NEAR(rk.densityCalc(T[n], P[n], phase, -1.0), rho[n],
+                            1e-12 * std::abs(rho[n])) << X << ", " << n;
+            }
+        }
+    }
+}
+
+TEST_F(RedlichKwongMFTP_Test, stateChanges)
+{
+    // Change the composition, the temperature and the pressure separately,
+    // and compare with a phase that is set directly to each state
+    struct State {
+        double T;
+        double P;
+        const char* X;
+    };
+    std::vector<State> states {
+        {500.0, 5e6, "CO2:0.5, N2:0.3, H2O:0.1, H2:0.1"},
+        {500.0, 5e6, "CO2:0.2, N2:0.1, H2O:0.6, H2:0.1"},
+        {650.0, 5e6, "CO2:0.2, N2:0.1, H2O:0.6, H2:0.1"},
+        {650.0, 2e7, "CO2:0.2, N2:0.1, H2O:0.6, H2:0.1"},
+        {500.0, 5e6, "CO2:0.5, N2:0.3, H2O:0.1, H2:0.1"},
+    };
+    std::vector<vector_fp> props;
+    for (const auto& state : states) {
+        test_phase->setState_TPX(state.T, state.P, state.X);
+        props.push_back(getProperties(*test_phase));
+
+        std::unique_ptr<ThermoPhase> fresh(newPhase(
+            "../data/RedlichKwongMFTP_HighP.xml", "rk-linear"));
+        fresh->setState_TPX(state.T, state.P, state.X);
+        vector_fp expected = getProperties(*fresh);
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_NEAR(expected[i], props.back()[i],
+                        1e-12 * std::abs(expected[i])) << state.T << ", " << i;
+        }
+    }
+    for (size_t i = 0; i < props[0].size(); i++) {
+        EXPECT_DOUBLE_EQ(props[0][i], props.back()[i]);
+    }
+    EXPECT_GT(std::abs(props[2][0] - props[1][0]), 1e-3 * props[1][0]);
+}
+
+}
@@ -0,0 +1,60 @@
+#include "gtest/gtest.h"
+#include "cantera/tpx/utils.h"
+#include <sstream>
+
+using namespace tpx;
+
+class SatTableTest : public testing::Test
+{
+public:
+    SatTableTest() : exact(GetSub(5)), tabulated(GetSub(5)) {}
+
+    std::unique_ptr<Substance> exact;
+    std::unique_ptr<Substance> tabulated;
+};
+
+TEST_F(SatTableTest, saturation_state)
+{
+    tabulated->buildSatTable(50);
+    EXPECT_GT(tabulated->nSatTable(), (size_t) 40);
+    for (double T = 200.0; T < 370.0; T += 13.7) {
+        exact->Set(PropertyPair::TX, T, 0.3);
+        tabulated->Set(PropertyPair::TX, T, 0.3);
+        EXPECT_NEAR(tabulated->P(), exact->P(), 1e-6 * exact->P());
+        EXPECT_NEAR(tabulated->v(), exact->v(), 1e-6 * exact->v());
+        double p = exact->P();
+        EXPECT_NEAR(tabulated->Tsat(p), exact->Tsat(p), 1e-6 * T);
+    }
+}
+
+TEST_F(SatTableTest, serialize)
+{
+    exact->buildSatTable(30);
+    std::stringstream s;
+    exact->writeSatTable(s);
+    tabulated->readSatTable(s);
+    EXPECT_EQ(tabulated->nSatTable(), exact->nSatTable());
+    tabulated->Set(PropertyPair::PX, 5.0e5, 0.5);
+    exact->clearSatTable();
+    exact->Set(PropertyPair::PX, 5.0e5, 0.5);
+    EXPECT_NEAR(tabulated->Temp(), exact->Temp(), 1e-4);
+
+    // Tables can't be used for a different substance
+    std::unique_ptr<Substance> water(GetSub(0));
+    s.clear();
+    s.seekg(0);
+    EXPECT_THROW(water->readSatTable(s), Cantera::CanteraError);
+}
+
+TEST_F(SatTableTest, dPsdT)
+{
+    // Compare the Clausius-Clapeyron equation with a central difference
+    double T = 300.0;
+    double dT = 1e-2;
+    exact->Set(PropertyPair::TX, T + dT, 0.0);
+    double P2 = exact->P();
+    exact->Set(PropertyPair::TX, T - dT, 0.0);
+    double P1 = exact->P();
+    exact->Set(PropertyPair::TX, T, 0.0);
+    EXPECT_NEAR(exact->dPsdT(), (P2 - P1) / (2 * dT), 1e-4 * (P2 - P1) / dT);
+}
@@ -141,3 +141,36 @@ TEST_F(WaterPropsIAPWS_Test, expansion_coeffs)
                     beta_num[i], 2e-10 * beta_num[i]);
     }
 }
+
+TEST_F(WaterPropsIAPWS_Test, density_table)
+{
+    shared_ptr<WaterDensityTable> table(
+        new WaterDensityTable(300.0, 800.0, 1.0E4, 5.0E7, 51, 31, 1.0E-4));
+    EXPECT_GT(table->nValidCells(), table->nCells() / 2);
+    EXPECT_LE(table->maxError(), 1.0E-4);
+    EXPECT_GT(table->density(300.0, OneAtm, WATER_LIQUID), 0.0);
+    EXPECT_EQ(table->density(300.0, OneAtm, WATER_GAS), -1.0);
+    EXPECT_EQ(table->density(900.0, OneAtm), -1.0);
+
+    // Points in the liquid, gas and supercritical regions, next to the
+    // saturation curve, and outside of the table
+    vector_fp TT{300.0, 350.0, 372.0, 373.124, 500.0, 640.0, 700.0, 900.0};
+    vector_fp PP{OneAtm, 2.0E7, OneAtm, 101324.0, 1.0E5, 3.0E7, 2.5E7, 1.0E6};
+    WaterPropsIAPWS tabulated;
+    tabulated.setDensityTable(table);
+    for (size_t i = 0; i < TT.size(); i++) {
+        for (int phase = WATER_GAS; phase <= WATER_LIQUID; phase++) {
+            double rho = water.density(TT[i], PP[i], phase);
+            double rho_table = tabulated.density(TT[i], PP[i], phase);
+            EXPECT_NEAR(rho_table, rho, 1e-8 * fabs(rho));
+            if (rho > 0.0) {
+                EXPECT_NEAR(tabulated.enthalpy(), water.enthalpy(),
+                            1e-8 * fabs(water.enthalpy()));
+            }
+        }
+    }
+
+    // Tables are shared between copies
+    WaterPropsIAPWS copy(tabulated);
+    EXPECT_EQ(copy.densityTable(), table);
+}
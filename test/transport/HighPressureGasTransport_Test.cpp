@@ -0,0 +1,120 @@
+#include "gtest/gtest.h"
+#include "cantera/transport/HighPressureGasTransport.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+namespace Cantera
+{
+
+class HighPressureTransportTest : public testing::Test
+{
+public:
+    HighPressureTransportTest() {
+        gas.reset(newPhase("../data/RedlichKwongMFTP_HighP.xml"));
+        tran.reset(newTransportMgr("HighP", gas.get()));
+    }
+
+    std::unique_ptr<ThermoPhase> gas;
+    std::unique_ptr<Transport> tran;
+};
+
+TEST_F(HighPressureTransportTest, compositionChanges)
+{
+    gas->setState_TPX(600, 8e6, "CO2:0.6, N2:0.2, H2O:0.1, H2:0.1");
+    double mu1 = tran->viscosity();
+    size_t K = gas->nSpecies();
+    vector_fp D1(K*K), D2(K*K);
+    tran->getBinaryDiffCoeffs(K, D1.data());
+
+    gas->setState_TPX(600, 8e6, "CO2:0.2, N2:0.6, H2O:0.1, H2:0.1");
+    double mu2 = tran->viscosity();
+    tran->getBinaryDiffCoeffs(K, D2.data());
+    EXPECT_GT(fabs(mu2 - mu1), 1e-3 * mu1);
+    EXPECT_NE(D1[1], D2[1]);
+
+    gas->setState_TPX(600, 8e6, "CO2:0.6, N2:0.2, H2O:0.1, H2:0.1");
+    EXPECT_DOUBLE_EQ(mu1, tran->viscosity());
+    tran->getBinaryDiffCoeffs(K, D2.data());
+    for (size_t i = 0; i < K*K; i++) {
+        EXPECT_DOUBLE_EQ(D1[i], D2[i]) << i;
+    }
+}
+
+TEST_F(HighPressureTransportTest, referenceValues)
+{
+    // Values computed before the corresponding states data were cached
+    struct State {
+        double T;
+        double P;
+        const char* X;
+        double visc; // viscosity
+        double D[3]; // D(CO2,N2), D(H2O,H2), D(H2O,H2O)
+    };
+    std::vector<State> states {
+        {280, 1e5, "CO2:0.85, N2:0.05, H2O:0.05, H2:0.05", 1.3877705043e-05,
+            {1.4059903184e-05, 7.6157551623e-05, 1.5536292271e-05}},
+        {500, 5e6, "CO2:0.5, N2:0.3, H2O:0.1, H2:0.1", 2.0997976623e-05,
+            {7.9476278971e-07, 4.4701100074e-06, 9.9585215032e-07}},
+        {600, 8e6, "CO2:0.2, N2:0.6, H2O:0.1, H2:0.1", 2.4264221567e-05,
+            {7.0472983954e-07, 3.8878290453e-06, 9.2061096528e-07}},
+        {800, 2e7, "CO2:0.25, N2:0.05, H2O:0.65, H2:0.05", 2.5511585331e-05,
+            {4.7445969902e-07, 2.1614769478e-06, 5.7233152923e-07}},
+        {1200, 1e7, "CO2:0.05, N2:0.05, H2O:0.85, H2:0.05", 3.3666268999e-05,
+            {1.9047533090e-06, 9.7833749139e-06, 3.1144999785e-06}},
+    };
+    size_t K = gas->nSpecies();
+    size_t iCO2 = gas->speciesIndex("CO2");
+    size_t iH2O = gas->speciesIndex("H2O");
+    size_t iN2 = gas->speciesIndex("N2");
+    size_t iH2 = gas->speciesIndex("H2");
+    vector_fp D(K*K);
+    for (const auto& state : states) {
+        gas->setState_TPX(state.T, state.P, state.X);
+        EXPECT_NEAR(state.visc, tran->viscosity(), 1e-9 * state.visc);
+        tran->getBinaryDiffCoeffs(K, D.data());
+        EXPECT_NEAR(state.D[0], D[iCO2*K + iN2], 1e-9 * state.D[0]);
+        EXPECT_NEAR(state.D[1], D[iH2O*K + iH2], 1e-9 * state.D[1]);
+        EXPECT_NEAR(state.D[2], D[iH2O*K + iH2O], 1e-9 * state.D[2]);
+    }
+}
+
+TEST_F(HighPressureTransportTest, batched)
+{
+    auto tr = dynamic_cast<HighPressureGasTransport*>(tran.get());
+    ASSERT_TRUE(tr != nullptr);
+    size_t K = gas->nSpecies();
+    const size_t N = 4;
+    // The first state is below the pseudo-critical temperature of the
+    // mixture, where the Lucas model uses the saturation pressure
+    double T[N] = {280, 500, 800, 1200};
+    double P[N] = {1e5, 5e6, 2e7, 1e7};
+    vector_fp X(N*K);
+    for (size_t n = 0; n < N; n++) {
+        X[n*K] = 0.85 - 0.2*n;
+        X[n*K + 1] = 0.05;
+        X[n*K + 2] = 0.05 + 0.2*n;
+        X[n*K + 3] = 0.05;
+    }
+    gas->setState_TPX(400, 2e5, "CO2:1.0");
+    double mu0 = tran->viscosity();
+
+    vector_fp visc(N), D(N*K*K), Dref(K*K);
+    tr->getHighPressureProperties(N, T, P, X.data(), K, visc.data(),
+                                  D.data(), K);
+
+    // The state of the phase is unchanged
+    EXPECT_DOUBLE_EQ(400, gas->temperature());
+    EXPECT_DOUBLE_EQ(1.0, gas->moleFraction("CO2"));
+    EXPECT_DOUBLE_EQ(mu0, tran->viscosity());
+
+    for (size_t n = 0; n < N; n++) {
+        gas->setState_TPX(T[n], P[n], &X[n*K]);
+        EXPECT_NEAR(tran->viscosity(), visc[n], 1e-12 * visc[n]) << n;
+        tran->getBinaryDiffCoeffs(K, Dref.data());
+        for (size_t i = 0; i < K*K; i++) {
+            EXPECT_NEAR(Dref[i], D[n*K*K + i], 1e-12 * Dref[i]) << n << ", " << i;
+        }
+    }
+}
+
+}
@@ -0,0 +1,123 @@
+#include "gtest/gtest.h"
+#include "cantera/transport/LiquidTransport.h"
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+namespace Cantera
+{
+
+class LiquidTransportTest : public testing::Test
+{
+public:
+    LiquidTransportTest() {
+        liquid.reset(newPhase("../data/liquid-transport.xml", "liquid"));
+        // The density of an IdealSolidSolnPhase is not an independent
+        // variable, so it has to be consistent with the composition before
+        // the phase is saved and restored by newTransportMgr().
+        liquid->setState_TP(300.0, OneAtm);
+        tran.reset(newTransportMgr("Liquid", liquid.get()));
+        liquid->setState_TPX(300.0, OneAtm,
+                             "H2O(l):0.6, CH3OH(l):0.3, C2H5OH(l):0.1");
+        ltran = dynamic_cast<LiquidTransport*>(tran.get());
+    }
+
+    //! Get the transport properties at temperature `T` for the current
+    //! composition
+    void getProperties(double T, vector_fp& props) {
+        size_t K = liquid->nSpecies();
+        liquid->setState_TP(T, OneAtm);
+        props.resize(2 + K + K*K);
+        props[0] = tran->viscosity();
+        props[1] = tran->thermalConductivity();
+        tran->getSpeciesViscosities(&props[2]);
+        tran->getBinaryDiffCoeffs(K, &props[2+K]);
+    }
+
+    std::unique_ptr<ThermoPhase> liquid;
+    std::unique_ptr<Transport> tran;
+    LiquidTransport* ltran;
+};
+
+TEST_F(LiquidTransportTest, temperatureTable)
+{
+    ASSERT_TRUE(ltran != nullptr);
+    size_t K = liquid->nSpecies();
+    // Temperatures between, on and next to the nodes of the table, and one
+    // outside of it
+    vector_fp temps{290.0, 300.0, 301.0, 333.3, 349.0, 350.0, 450.0};
+    std::vector<vector_fp> direct(temps.size());
+    for (size_t i = 0; i < temps.size(); i++) {
+        getProperties(temps[i], direct[i]);
+    }
+
+    ltran->setTemperatureTable(290.0, 350.0, 31);
+    vector_fp tabulated;
+    for (size_t i = 0; i < temps.size(); i++) {
+        getProperties(temps[i], tabulated);
+        for (size_t n = 0; n < tabulated.size(); n++) {
+            if (n >= 2 + K && (n - 2 - K) % (K + 1) == 0) {
+                // No self-diffusion coefficients are given
+                continue;
+            }
+            EXPECT_NEAR(direct[i][n], tabulated[n], 1e-6 * direct[i][n])
+                << "T = " << temps[i] << ", n = " << n;
+        }
+    }
+
+    // Outside of the table, the properties are evaluated directly
+    EXPECT_DOUBLE_EQ(direct.back()[0], tabulated[0]);
+
+    // Removing the table restores the direct evaluation
+    ltran->setTemperatureTable(0.0, 0.0, 0);
+    getProperties(temps[2], tabulated);
+    for (size_t n = 0; n < 2 + K; n++) {
+        EXPECT_DOUBLE_EQ(direct[2][n], tabulated[n]);
+    }
+
+    EXPECT_THROW(ltran->setTemperatureTable(300.0, 350.0, 3), CanteraError);
+    EXPECT_THROW(ltran->setTemperatureTable(350.0, 300.0, 10), CanteraError);
+}
+
+TEST_F(LiquidTransportTest, mixtureProperties)
+{
+    size_t K = liquid->nSpecies();
+    // Parameters of the species thermal conductivities
+    double A[] = {1.5, 0.5, 0.42};
+    double weight[] = {1.0, 1.0, 0.8};
+    double E = 2.27e6 / GasConstant;
+
+    vector_fp states{300.0, 0.6, 0.3, 0.1,
+                     320.0, 0.6, 0.3, 0.1,
+                     320.0, 0.2, 0.3, 0.5,
+                     300.0, 0.6, 0.3, 0.1};
+    vector_fp visc(K), Y(K);
+    vector_fp mu, lambda;
+    for (size_t i = 0; i < states.size(); i += K + 1) {
+        double T = states[i];
+        liquid->setState_TPX(T, OneAtm, &states[i+1]);
+        mu.push_back(tran->viscosity());
+        lambda.push_back(tran->thermalConductivity());
+
+        // The mixture properties are found from the species properties and
+        // the current composition, using the mixing rules given in the input
+        // file, and are only recomputed after the state changes.
+        tran->getSpeciesViscosities(visc.data());
+        liquid->getMassFractions(Y.data());
+        double logmu = 0.0, lambda_mix = 0.0;
+        for (size_t k = 0; k < K; k++) {
+            logmu += liquid->moleFraction(k) * log(visc[k]);
+            lambda_mix += weight[k] * Y[k] * A[k] * exp(-E / T);
+        }
+        EXPECT_NEAR(exp(logmu), mu.back(), 1e-12 * mu.back());
+        EXPECT_NEAR(lambda_mix, lambda.back(), 1e-12 * lambda.back());
+        EXPECT_EQ(mu.back(), tran->viscosity());
+        EXPECT_EQ(lambda.back(), tran->thermalConductivity());
+    }
+    EXPECT_GT(std::abs(mu[1] - mu[0]), 1e-3 * mu[0]);
+    EXPECT_GT(std::abs(mu[2] - mu[1]), 1e-3 * mu[1]);
+    EXPECT_GT(std::abs(lambda[2] - lambda[1]), 1e-3 * lambda[1]);
+    EXPECT_DOUBLE_EQ(mu[0], mu[3]);
+    EXPECT_DOUBLE_EQ(lambda[0], lambda[3]);
+}
+
+}
@@ -3,15 +3,19 @@
 #include "cantera/transport/TransportData.h"
 #include "cantera/transport/MixTransport.h"
 #include "cantera/transport/MultiTransport.h"
+#include "cantera/transport/DustyGasTransport.h"
 #include "cantera/transport/TransportFactory.h"
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/NasaPoly2.h"
 #include "cantera/base/global.h"
+#include "cantera/base/logger.h"
 #include "cantera/base/stringUtils.h"
 
 #include "../thermo/thermo_data.h"
 
+#include <fstream>
+
 using namespace Cantera;
 
 class TransportFromScratch : public testing::Test
@@ -115,6 +119,53 @@ TEST_F(TransportFromScratch, viscosity)
     }
 }
 
+//! Mixture viscosity from the Wilke mixture rule, evaluated term by term
+static double wilkeReference(Transport& tr, ThermoPhase& phase)
+{
+    size_t K = phase.nSpecies();
+    vector_fp visc(K), X(K);
+    tr.getSpeciesViscosities(visc.data());
+    phase.getMoleFractions(X.data());
+    const vector_fp& mw = phase.molecularWeights();
+    double mu = 0.0;
+    for (size_t k = 0; k < K; k++) {
+        X[k] = std::max(X[k], Tiny);
+    }
+    for (size_t k = 0; k < K; k++) {
+        double denom = 0.0;
+        for (size_t j = 0; j < K; j++) {
+            double f = 1.0 + sqrt(visc[k] / visc[j]) * pow(mw[j] / mw[k], 0.25);
+            denom += X[j] * f * f / sqrt(8.0 * (1.0 + mw[k] / mw[j]));
+        }
+        mu += X[k] * visc[k] / denom;
+    }
+    return mu;
+}
+
+TEST_F(TransportFromScratch, viscosityWilke)
+{
+    std::unique_ptr<ThermoPhase> gas(newPhase("gri30.xml", "gri30_mix"));
+    for (const char* model : {"Mix", "CK_Mix"}) {
+        std::unique_ptr<Transport> tr(newTransportMgr(model, gas.get()));
+        for (int i = 0; i < 8; i++) {
+            double T = 300 + 350*i;
+            gas->setState_TPX(T, OneAtm, "CH4:1, O2:2, N2:7.52");
+            if (i % 2) {
+                gas->setState_TPX(T, OneAtm,
+                                  "H2:0.1, H:0.05, OH:0.1, H2O:0.3, CO2:0.2, "
+                                  "AR:0.05, N2:0.2");
+            }
+            double mu = tr->viscosity();
+            EXPECT_NEAR(wilkeReference(*tr, *gas), mu, 1e-13 * mu)
+                << model << ", T = " << T;
+        }
+        // pure species
+        gas->setState_TPX(1000, OneAtm, "H2:1.0");
+        double mu = tr->viscosity();
+        EXPECT_NEAR(wilkeReference(*tr, *gas), mu, 1e-13 * mu) << model;
+    }
+}
+
 TEST_F(TransportFromScratch, thermalConductivityMix)
 {
     Transport* trRef = newTransportMgr("Mix", ref.get());
@@ -166,6 +217,313 @@ TEST_F(TransportFromScratch, thermalConductivityMulti)
     }
 }
 
+TEST_F(TransportFromScratch, mixBatched)
+{
+    Transport* tr = newTransportMgr("Mix", ref.get());
+    MixTransport* trMix = dynamic_cast<MixTransport*>(tr);
+    ASSERT_TRUE(trMix != 0);
+
+    const size_t K = 3, N = 6;
+    double T[N], P[N], X[N*K], visc[N], cond[N], D[N*K];
+    for (size_t j = 0; j < N; j++) {
+        T[j] = 300 + 311*j;
+        P[j] = 1e5 * (j + 1);
+        X[j*K] = 0.5 - 0.08*j;
+        X[j*K+1] = 0.1 + 0.05*j;
+        X[j*K+2] = 1.0 - X[j*K] - X[j*K+1];
+    }
+    // a pure species
+    X[(N-1)*K] = 1.0;
+    X[(N-1)*K+1] = 0.0;
+    X[(N-1)*K+2] = 0.0;
+
+    ref->setState_TPX(400, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+    double visc0 = tr->viscosity();
+    trMix->getMixTransportProperties(N, T, P, X, K, visc, cond, D, K);
+    // the transport object should still be consistent with the phase
+    EXPECT_DOUBLE_EQ(visc0, tr->viscosity());
+
+    vector_fp Dref(K);
+    for (size_t j = 0; j < N; j++) {
+        ref->setState_TPX(T[j], P[j], &X[j*K]);
+        EXPECT_NEAR(tr->viscosity(), visc[j], 1e-12 * visc[j]) << j;
+        EXPECT_NEAR(tr->thermalConductivity(), cond[j], 1e-12 * cond[j]) << j;
+        tr->getMixDiffCoeffs(Dref.data());
+        for (size_t k = 0; k < K; k++) {
+            EXPECT_NEAR(Dref[k], D[j*K+k], 1e-12 * Dref[k]) << j << ", " << k;
+        }
+    }
+}
+
+TEST_F(TransportFromScratch, multiSequence)
+{
+    // Results should not depend on the previous states seen by the transport
+    // manager, which are used to start the iterative solution of the L matrix
+    // equations
+    std::unique_ptr<ThermoPhase> gas(newPhase("gri30.xml", "gri30_mix"));
+    size_t K = gas->nSpecies();
+    std::unique_ptr<Transport> tr(newTransportMgr("Multi", gas.get()));
+    vector_fp X(K), dt(K), dtRef(K);
+    for (int i = 0; i < 10; i++) {
+        for (size_t k = 0; k < K; k++) {
+            X[k] = 0.01 + exp(-5.0 * pow(0.1*i - double(k)/K, 2));
+        }
+        gas->setState_TPX(300 + 200*i, OneAtm, X.data());
+        double lambda = tr->thermalConductivity();
+        tr->getThermalDiffCoeffs(dt.data());
+
+        std::unique_ptr<Transport> trRef(newTransportMgr("Multi", gas.get()));
+        EXPECT_NEAR(trRef->thermalConductivity(), lambda, 1e-11 * lambda);
+        trRef->getThermalDiffCoeffs(dtRef.data());
+        double dtmax = 0.0;
+        for (size_t k = 0; k < K; k++) {
+            dtmax = std::max(dtmax, fabs(dtRef[k]));
+        }
+        for (size_t k = 0; k < K; k++) {
+            EXPECT_NEAR(dtRef[k], dt[k], 1e-11 * dtmax) << i << ", " << k;
+        }
+    }
+}
+
+TEST_F(TransportFromScratch, multiIterativeFluxes)
+{
+    std::unique_ptr<ThermoPhase> gas(newPhase("gri30.xml", "gri30_mix"));
+    size_t K = gas->nSpecies();
+    std::unique_ptr<Transport> trRef(newTransportMgr("Multi", gas.get()));
+    std::unique_ptr<Transport> tr(newTransportMgr("Multi", gas.get()));
+    dynamic_cast<MultiTransport&>(*tr).setIterativeFluxSolver(true, 1e-10);
+    vector_fp X1(K), X2(K), state1(K+2), state2(K+2), flux(K), fluxRef(K);
+    for (int i = 0; i < 5; i++) {
+        for (size_t k = 0; k < K; k++) {
+            X1[k] = 1e-10 + exp(-5.0 * pow(0.2*i - double(k)/K, 2));
+            X2[k] = 1e-10 + exp(-5.0 * pow(0.2*i + 0.05 - double(k)/K, 2));
+        }
+        gas->setState_TPX(500 + 300*i, OneAtm, X1.data());
+        gas->saveState(state1);
+        gas->setState_TPX(520 + 300*i, OneAtm, X2.data());
+        gas->saveState(state2);
+
+        trRef->getMassFluxes(state1.data(), state2.data(), 1e-3, fluxRef.data());
+        tr->getMassFluxes(state1.data(), state2.data(), 1e-3, flux.data());
+        double fmax = 0.0;
+        double fsum = 0.0;
+        for (size_t k = 0; k < K; k++) {
+            fmax = std::max(fmax, fabs(fluxRef[k]));
+            fsum += flux[k];
+        }
+        EXPECT_NEAR(fsum, 0.0, 1e-12 * fmax);
+        for (size_t k = 0; k < K; k++) {
+            EXPECT_NEAR(fluxRef[k], flux[k], 1e-8 * fmax) << i << ", " << k;
+        }
+    }
+}
+
+TEST_F(TransportFromScratch, dustyGasFluxes)
+{
+    std::unique_ptr<ThermoPhase> gas(newPhase("gri30.xml", "gri30_mix"));
+    size_t K = gas->nSpecies();
+    std::unique_ptr<Transport> tr(newTransportMgr("DustyGas", gas.get()));
+    DustyGasTransport& dg = dynamic_cast<DustyGasTransport&>(*tr);
+    dg.setPorosity(0.4);
+    dg.setTortuosity(3.0);
+    dg.setMeanPoreRadius(1.0e-6);
+    dg.setMeanParticleDiameter(5.0e-6);
+
+    const size_t npairs = 4;
+    const double delta = 1e-5;
+    vector_fp X(K), states(K+2), D(K*K), gradc(K), deltas(npairs, delta);
+    vector_fp state1((K+2)*npairs), state2((K+2)*npairs);
+    vector_fp fluxes(K*npairs), fluxRef(K);
+    for (size_t n = 0; n <= npairs; n++) {
+        for (size_t k = 0; k < K; k++) {
+            X[k] = 0.01 + exp(-5.0 * pow(0.1*n - double(k)/K, 2));
+        }
+        // Equal pressures, so there is no Darcy flux
+        gas->setState_TPX(1000.0, OneAtm, X.data());
+        gas->saveState(states);
+        if (n < npairs) {
+            std::copy(states.begin(), states.end(), &state1[n*(K+2)]);
+        }
+        if (n > 0) {
+            std::copy(states.begin(), states.end(), &state2[(n-1)*(K+2)]);
+        }
+    }
+    dg.getMolarFluxes(npairs, state1.data(), state2.data(), deltas.data(),
+                      fluxes.data());
+
+    for (size_t n = 0; n < npairs; n++) {
+        const double* s1 = &state1[n*(K+2)];
+        const double* s2 = &state2[n*(K+2)];
+        dg.getMolarFluxes(s1, s2, delta, fluxRef.data());
+
+        // Compare with the fluxes computed from the inverse of the H matrix
+        // at the mean state, where getMolarFluxes leaves the phase
+        dg.getMultiDiffCoeffs(K, D.data());
+        double fmax = 0.0;
+        for (size_t k = 0; k < K; k++) {
+            gradc[k] = (s2[1]*s2[k+2] - s1[1]*s1[k+2]) / (gas->molecularWeight(k) * delta);
+            fmax = std::max(fmax, fabs(fluxRef[k]));
+        }
+        for (size_t k = 0; k < K; k++) {
+            double J = 0.0;
+            for (size_t j = 0; j < K; j++) {
+                J -= D[K*j + k] * gradc[j];
+            }
+            EXPECT_NEAR(fluxRef[k], J, 1e-10 * fmax) << n << ", " << k;
+            EXPECT_DOUBLE_EQ(fluxRef[k], fluxes[n*K + k]) << n << ", " << k;
+        }
+    }
+
+    // Reusing the factorization for a slightly different composition
+    // introduces a correspondingly small error
+    vector_fp fluxApprox(K);
+    dg.setCompositionTolerance(1e-3);
+    dg.getMolarFluxes(&state1[0], &state2[0], delta, fluxRef.data());
+    for (size_t k = 0; k < K; k++) {
+        state1[k+2] *= 1.0 + 1e-5 * k;
+        state2[k+2] *= 1.0 + 1e-5 * k;
+    }
+    dg.getMolarFluxes(&state1[0], &state2[0], delta, fluxApprox.data());
+    dg.setCompositionTolerance(0.0);
+    dg.getMolarFluxes(&state1[0], &state2[0], delta, fluxRef.data());
+    double fmax = 0.0;
+    for (size_t k = 0; k < K; k++) {
+        fmax = std::max(fmax, fabs(fluxRef[k]));
+    }
+    for (size_t k = 0; k < K; k++) {
+        EXPECT_NEAR(fluxRef[k], fluxApprox[k], 1e-2 * fmax);
+    }
+    EXPECT_NE(fluxRef[K-1], fluxApprox[K-1]);
+}
+
+class CachedMixTransport : public MixTransport
+{
+public:
+    std::string cacheKey() {
+        return fitCacheKey();
+    }
+    std::string cacheFile() {
+        return fitCacheDirectory() + "/transport-fits-" + fitCacheKey() +
+            ".txt";
+    }
+};
+
+TEST_F(TransportFromScratch, fitCache)
+{
+    size_t K = ref->nSpecies();
+    GasTransport::setFitCacheDirectory("");
+    MixTransport trRef;
+    trRef.init(ref.get());
+
+    GasTransport::setFitCacheDirectory(".");
+    CachedMixTransport trWrite, trRead;
+    trWrite.init(ref.get());
+    std::string fname = trWrite.cacheFile();
+    EXPECT_TRUE(std::ifstream(fname).good());
+
+    // Replace the fits in the cache file with the ones for a different set
+    // of species data, to check that they are actually used
+    tH2O->diameter *= 1.1;
+    CachedMixTransport trOther;
+    trOther.init(test.get());
+    std::string otherFile = trOther.cacheFile();
+    ASSERT_NE(fname, otherFile);
+    {
+        std::ifstream in(otherFile);
+        std::ofstream out(fname);
+        std::string line;
+        std::getline(in, line);
+        out << trWrite.cacheKey() << "\n" << in.rdbuf();
+    }
+    std::remove(otherFile.c_str());
+
+    trRead.init(ref.get());
+    std::remove(fname.c_str());
+    GasTransport::setFitCacheDirectory("");
+
+    ref->setState_TPX(1200, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+    test->setState_TPX(1200, 5e5, "H2:0.5, O2:0.3, H2O:0.2");
+    EXPECT_DOUBLE_EQ(trRef.viscosity(), trWrite.viscosity());
+    EXPECT_DOUBLE_EQ(trOther.viscosity(), trRead.viscosity());
+    EXPECT_DOUBLE_EQ(trOther.thermalConductivity(),
+                     trRead.thermalConductivity());
+    EXPECT_NE(trRef.viscosity(), trRead.viscosity());
+
+    vector_fp Dref(K*K), Dread(K*K);
+    trOther.getBinaryDiffCoeffs(K, Dref.data());
+    trRead.getBinaryDiffCoeffs(K, Dread.data());
+    for (size_t i = 0; i < K*K; i++) {
+        EXPECT_DOUBLE_EQ(Dref[i], Dread[i]) << i;
+    }
+}
+
+TEST_F(TransportFromScratch, fitThreads)
+{
+    shared_ptr<ThermoPhase> gas(newPhase("gri30.xml", "gri30_mix"));
+    size_t K = gas->nSpecies();
+    GasTransport::setFitThreads(1);
+    std::unique_ptr<Transport> tr1(newTransportMgr("Multi", gas.get()));
+    GasTransport::setFitThreads(4);
+    std::unique_ptr<Transport> tr4(newTransportMgr("Multi", gas.get()));
+    GasTransport::setFitThreads(0);
+
+    gas->setState_TPX(1500, 2e5, "H2:0.3, O2:0.2, H2O:0.2, OH:0.1, N2:0.2");
+    EXPECT_EQ(tr1->viscosity(), tr4->viscosity());
+    EXPECT_EQ(tr1->thermalConductivity(), tr4->thermalConductivity());
+    vector_fp D1(K*K), D4(K*K);
+    tr1->getMultiDiffCoeffs(K, D1.data());
+    tr4->getMultiDiffCoeffs(K, D4.data());
+    for (size_t i = 0; i < K*K; i++) {
+        EXPECT_EQ(D1[i], D4[i]) << i;
+    }
+}
+
+TEST_F(TransportFromScratch, fitThreadsLog)
+{
+    // Messages written while generating the fits go to the logger of the
+    // calling thread, in the same order for any number of threads
+    shared_ptr<ThermoPhase> gas(newPhase("gri30.xml", "gri30_mix"));
+    StringLogger log1, log4;
+    Logger* previous = redirectLogger(&log1);
+    GasTransport::setFitThreads(1);
+    std::unique_ptr<Transport> tr1(newTransportMgr("Mix", gas.get(), 1));
+    redirectLogger(&log4);
+    GasTransport::setFitThreads(4);
+    std::unique_ptr<Transport> tr4(newTransportMgr("Mix", gas.get(), 1));
+    GasTransport::setFitThreads(0);
+    redirectLogger(previous);
+    EXPECT_NE(std::string::npos, log1.text().find("Collision Integral"));
+    EXPECT_EQ(log1.text(), log4.text());
+}
+
+TEST_F(TransportFromScratch, duplicateMix)
+{
+    std::unique_ptr<Transport> tr(newTransportMgr("Mix", ref.get()));
+    shared_ptr<ThermoPhase> gas2(ref->duplMyselfAsThermoPhase());
+    std::unique_ptr<Transport> tr2(tr->duplMyselfAsTransport());
+    tr2->setThermo(*gas2);
+    EXPECT_EQ(tr->model(), tr2->model());
+
+    ref->setState_TPX(1200, 2e5, "H2:0.4, O2:0.1, H2O:0.5");
+    gas2->setState_TPX(1200, 2e5, "H2:0.4, O2:0.1, H2O:0.5");
+    EXPECT_EQ(tr->viscosity(), tr2->viscosity());
+    EXPECT_EQ(tr->thermalConductivity(), tr2->thermalConductivity());
+    vector_fp D(3), D2(3);
+    tr->getMixDiffCoeffs(D.data());
+    tr2->getMixDiffCoeffs(D2.data());
+    for (size_t k = 0; k < 3; k++) {
+        EXPECT_EQ(D[k], D2[k]) << k;
+    }
+
+    // the copy does not depend on the state of the original phase
+    ref->setState_TPX(500, 1e5, "O2:1.0");
+    EXPECT_EQ(gas2->temperature(), 1200);
+    tr2->getMixDiffCoeffs(D.data());
+    for (size_t k = 0; k < 3; k++) {
+        EXPECT_EQ(D[k], D2[k]) << k;
+    }
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from transportFromScratch.cpp\n");